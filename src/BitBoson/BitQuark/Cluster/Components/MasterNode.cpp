@@ -20,6 +20,8 @@
  */
 
 #include <thread>
+#include <vector>
+#include <unordered_map>
 #include <algorithm>
 #include <BitBoson/StandardModel/Crypto/Crypto.h>
 #include <BitBoson/BitQuark/Networking/Requests.h>
@@ -31,12 +33,16 @@ using namespace BitBoson::BitQuark;
 /**
  * Constructor used to setup the servable for the master node
  *
- * @param hostname String representing the hostname for the server
+ * @param hostname String representing the hostname for the server (or a local
+ *                 transport URL such as "inproc://name" to serve the node on)
  * @param port Integer representing the port to serve/listen on
  * @param nodeId String representing a node id for the master node
+ * @param binaryPort Integer representing the port to serve the internal
+ *                   (node-to-node) routes on using the binary transport
+ *                   (which is then advertised to the other nodes) or zero
  */
 MasterNode::MasterNode(const std::string& hostname, int port,
-        const std::string& nodeId) : Servable(port)
+        const std::string& nodeId, int binaryPort) : Servable(port)
 {
 
     // TODO: Sanitize node id to be alpha-numeric
@@ -53,16 +59,23 @@ MasterNode::MasterNode(const std::string& hostname, int port,
     _nodeId = (nodeId.empty() ? StandardModel::Crypto::getRandomSha256() : nodeId);
     _nodeUrl = ("http://" + hostname + ":" + std::to_string(port));
 
+    // Serve the node over the local transport instead (if one was given)
+    if (enableLocalTransport(hostname))
+        _nodeUrl = hostname;
+
+    // Otherwise, serve the internal routes over the binary transport (if a
+    // port was given) to be advertised once started so the other nodes'
+    // heartbeats and requests are sent over it
+    else if (binaryPort > 0)
+    {
+        enableBinaryTransport(binaryPort, "/internal/");
+        _binaryNodeUrl = ("bq://" + hostname + ":" + std::to_string(binaryPort));
+    }
+
     // Create an asynchronous queue to store additional master nodes
     // this node would like to join if needed
     _masterNodesToJoin = std::make_shared<StandardModel::AsyncQueue<std::pair<std::string, std::string>>>();
 
-    // Setup the thread-pools for making requests to other components
-    _masterThreadPool = std::make_shared<StandardModel::ThreadPool<std::string>>(
-        [this](std::shared_ptr<std::string> value) {
-            handleMasterNodeStatusRequest(*value);
-        });
-
     // Setup the asynchronous event loops
     _masterEventLoop = std::make_shared<StandardModel::AsyncEventLoop>(
         [this]() {
@@ -303,24 +316,34 @@ bool MasterNode::isInQuorum()
 void MasterNode::handleMasterEventLoop()
 {
 
-    // Enqueue all of the connected node's to be updated
-    // via contacting their individual status APIs
+    // Get all of the connected node's to be updated
     // Do this in a separate context to leverage RAII for the mutex/lock
+    std::vector<std::string> nodeUrls;
+    std::unordered_map<std::string, std::string> nodeIdsByUrl;
     {
 
         // Lock before we attempt to access shared-memory
         std::unique_lock<std::mutex> lock(_masterLock);
 
-        // Actually dispatch the different request items
+        // Actually copy over the node ids and urls
         for (const auto& nodeState : _masterNodes)
-            _masterThreadPool->enqueue(
-                    std::make_shared<std::string>(nodeState.first));
+        {
+            auto nodeUrl = (nodeState.second.url + "/internal/master/status");
+            nodeIdsByUrl[nodeUrl] = nodeState.first;
+            nodeUrls.push_back(nodeUrl);
+        }
     }
 
-    // Wait until the queue is empty before allowing the
-    // system to re-query for status again
-    while (!_masterThreadPool->isQueueEmpty())
-        std::this_thread::sleep_for(std::chrono::seconds(1));
+    // Contact all of the nodes' individual status APIs at once so that
+    // the update takes roughly one round-trip regardless of cluster size
+    // and wait for all of them before allowing the system to re-query
+    auto broadcastResult = Requests::broadcast(nodeUrls, Servable::HttpMethod::GET, {});
+    for (const auto& responseItem : broadcastResult.responses)
+        handleMasterNodeStatusResponse(nodeIdsByUrl[responseItem.first], responseItem.second);
+
+    // Nodes which did not respond in time are no longer contactable
+    for (const auto& pendingUrl : broadcastResult.pendingUrls)
+        handleMasterNodeStatusResponse(nodeIdsByUrl[pendingUrl], ResponseObj{408, {}});
 
     // Handle updating the left-nodes vecter by removing expired nodes
     // Do this in a separate context to leverage RAII for the mutex/lock
@@ -466,12 +489,13 @@ void MasterNode::handleWorkerEventLoop()
 }
 
 /**
- * Internal function used to handle the asynchronous request for a
- * master-node's status to update status/quorum information
+ * Internal function used to handle the response to the asynchronous
+ * request for a master-node's status to update status/quorum information
  *
- * @param nodeId String representing the node id to request
+ * @param nodeId String representing the node id which was requested
+ * @param response ResponseObj representing the node's status response
  */
-void MasterNode::handleMasterNodeStatusRequest(const std::string& nodeId)
+void MasterNode::handleMasterNodeStatusResponse(const std::string& nodeId, ResponseObj response)
 {
 
     // Get the node's information (i.e url, etc)
@@ -490,10 +514,6 @@ void MasterNode::handleMasterNodeStatusRequest(const std::string& nodeId)
         thisNodeId = _nodeId;
     }
 
-    // Make a request on the provided node
-    auto response = Requests::makeRequest(
-            Servable::HttpMethod::GET, nodeState.url + "/internal/master/status", {});
-
     // TODO: Validate some kind of token from the other node
 
     // Handle the response we receive to update the node's state
@@ -505,12 +525,28 @@ void MasterNode::handleMasterNodeStatusRequest(const std::string& nodeId)
     if (response.body[thisNodeId].empty())
             _masterNodesToJoin->enqueue(std::make_pair(nodeState.id, nodeState.url));
 
-    // Extract just the nodes in the response
+    // Extract just the nodes (and their URLs) in the response, preferring
+    // the typed membership list over the flat per-node string values
     std::vector<std::string> remoteNodes;
-    for (const auto& responseItem : response.body)
-        if ((responseItem.second == "Connected")
-                || (responseItem.second == "NotConnected"))
-            remoteNodes.push_back(responseItem.first);
+    std::unordered_map<std::string, std::string> remoteNodeUrls;
+    if (response.data.has("Members"))
+    {
+        for (const auto& member : response.data.get("Members").getItems())
+        {
+            remoteNodes.push_back(member.get("Id").getString());
+            remoteNodeUrls[member.get("Id").getString()] = member.get("Url").getString();
+        }
+    }
+    else
+    {
+        for (const auto& responseItem : response.body)
+            if ((responseItem.second == "Connected")
+                    || (responseItem.second == "NotConnected"))
+            {
+                remoteNodes.push_back(responseItem.first);
+                remoteNodeUrls[responseItem.first] = response.body["URL-" + responseItem.first];
+            }
+    }
 
     // Additionally, we'll look at the response object we got back
     // and determine if any of the nodes in it are not in our list
@@ -544,7 +580,7 @@ void MasterNode::handleMasterNodeStatusRequest(const std::string& nodeId)
             if (remoteNode != thisNodeId)
                 if (std::find(ourMasterNodes.begin(),
                         ourMasterNodes.end(), remoteNode) == ourMasterNodes.end())
-                    _masterNodesToJoin->enqueue(std::make_pair(remoteNode, response.body["URL-" + remoteNode]));
+                    _masterNodesToJoin->enqueue(std::make_pair(remoteNode, remoteNodeUrls[remoteNode]));
     }
 
     // Update the node's state for the managing node's instance
@@ -590,6 +626,17 @@ MasterNode::ResponseObj MasterNode::handlerGetInternalMasterStatus(
         // Actually add the url items from our local list
         for (const auto& masterNode : _masterNodes)
             retObj.body["URL-" + masterNode.first] = masterNode.second.url;
+
+        // Also add the typed membership list with the same details
+        auto& members = retObj.data["Members"];
+        members = Payload::array();
+        for (const auto& masterNode : _masterNodes)
+        {
+            auto& member = members.push(Payload::object());
+            member["Id"] = masterNode.first;
+            member["Url"] = masterNode.second.url;
+            member["Connected"] = masterNode.second.contactable;
+        }
     }
 
     // If we were supplied a route argument, that means we had status requested
@@ -840,24 +887,63 @@ MasterNode::ResponseObj MasterNode::handlerGetClusterStatus(
     // and the build-up unordered map for connection info
     retObj = ResponseObj{200, connectionStatus};
 
+    // Add-in the same cluster details as typed values so that
+    // callers do not need to parse them back out of strings
+    auto& clusterData = retObj.data["Cluster"];
+    clusterData["ConnectedNodes"] = connectedNodes;
+    clusterData["TotalNodes"] = (connectionStatus.size() - 2);
+    clusterData["QuorumMet"] = quorumMet;
+
     // Return the response object
     return retObj;
 }
 
+/**
+ * Overridden function used to start the service, advertising the binary
+ * transport (if enabled) only once it is actually listening
+ * NOTE: This is a non-blocking operation
+ *
+ * @param workerThreads Integer represeting the number of threads
+ *                      (defaults to the hardware concurrency)
+ * @return Boolean indicating whether the service was started with all of
+ *         its enabled transports listening (false if any failed to bind)
+ */
+bool MasterNode::start(int workerThreads)
+{
+
+    // Start the service along with its transports
+    bool retFlag = Servable::start(workerThreads);
+
+    // Advertise the binary transport only if it is listening, otherwise
+    // the other nodes keep using the (HTTP) URL the node is served on
+    if (retFlag && !_binaryNodeUrl.empty())
+    {
+
+        // Lock before we attempt to access shared-memory
+        std::unique_lock<std::mutex> lock(_masterLock);
+
+        // Actually advertise the binary transport's URL
+        _nodeUrl = _binaryNodeUrl;
+    }
+
+    // Return the return flag
+    return retFlag;
+}
+
 /**
  * Destructor used to cleanup the instance
  */
 MasterNode::~MasterNode()
 {
 
+    // Stop serving requests first so that no handler (on any of the
+    // worker threads) can run against partially destroyed members
+    stop();
+
     // Stop the event loops
     _masterEventLoop = nullptr;
     _workerEventLoop = nullptr;
 
-    // Stop the background thread pool
-    _masterThreadPool->flushQueue();
-    _masterThreadPool = nullptr;
-
     // Stop all nodes-to-join queing and flush
     _masterNodesToJoin->flushQueue();
 
@@ -24,7 +24,6 @@
 
 #include <vector>
 #include <unordered_map>
-#include <BitBoson/StandardModel/Threading/ThreadPool.hpp>
 #include <BitBoson/StandardModel/Threading/AsyncQueue.hpp>
 #include <BitBoson/StandardModel/Threading/AsyncEventLoop.hpp>
 #include <BitBoson/BitQuark/Networking/Servable.h>
@@ -53,6 +52,7 @@ namespace BitBoson::BitQuark
             long _workerTimeout;
             std::string _nodeId;
             std::string _nodeUrl;
+            std::string _binaryNodeUrl;
             std::mutex _masterLock;
             std::vector<std::string> _leftMasterNodes;
             std::shared_ptr<S3Credentials> _s3Credentials;
@@ -61,7 +61,6 @@ namespace BitBoson::BitQuark
             std::shared_ptr<StandardModel::AsyncEventLoop> _workerEventLoop;
             std::unordered_map<std::string, long> _leftMasterNodeTimes;
             std::unordered_map<std::string, long> _connectedWorkerNodes;
-            std::shared_ptr<StandardModel::ThreadPool<std::string>> _masterThreadPool;
             std::unordered_map<std::string, MasterNodeState> _masterNodes;
             std::unordered_map<std::string, std::string> _workerNodes; // <--- TODO: CHECK IF WE CAN DELETE
             std::shared_ptr<StandardModel::AsyncQueue<std::pair<std::string, std::string>>> _masterNodesToJoin;
@@ -72,12 +71,16 @@ namespace BitBoson::BitQuark
             /**
              * Constructor used to setup the servable for the master node
              *
-             * @param hostname String representing the hostname for the server
+             * @param hostname String representing the hostname for the server (or a local
+             *                 transport URL such as "inproc://name" to serve the node on)
              * @param port Integer representing the port to serve/listen on
              * @param nodeId String representing a node id for the master node
+             * @param binaryPort Integer representing the port to serve the internal
+             *                   (node-to-node) routes on using the binary transport
+             *                   (which is then advertised to the other nodes) or zero
              */
             MasterNode(const std::string& hostname, int port,
-                    const std::string& nodeId="");
+                    const std::string& nodeId="", int binaryPort=0);
 
             /**
              * Function used to set the time-out value for nodes which have
@@ -128,6 +131,18 @@ namespace BitBoson::BitQuark
              */
             bool isInQuorum();
 
+            /**
+             * Overridden function used to start the service, advertising the binary
+             * transport (if enabled) only once it is actually listening
+             * NOTE: This is a non-blocking operation
+             *
+             * @param workerThreads Integer represeting the number of threads
+             *                      (defaults to the hardware concurrency)
+             * @return Boolean indicating whether the service was started with all of
+             *         its enabled transports listening (false if any failed to bind)
+             */
+            bool start(int workerThreads=0) override;
+
             /**
              * Destructor used to cleanup the instance
              */
@@ -147,12 +162,13 @@ namespace BitBoson::BitQuark
             void handleWorkerEventLoop();
 
             /**
-             * Internal function used to handle the asynchronous request for a
-             * master-node's status to update status/quorum information
+             * Internal function used to handle the response to the asynchronous
+             * request for a master-node's status to update status/quorum information
              *
-             * @param nodeId String representing the node id to request
+             * @param nodeId String representing the node id which was requested
+             * @param response ResponseObj representing the node's status response
              */
-            void handleMasterNodeStatusRequest(const std::string& nodeId);
+            void handleMasterNodeStatusResponse(const std::string& nodeId, ResponseObj response);
 
             /**
              * Internal handler function used to get the internal status of the master node
@@ -30,12 +30,16 @@ using namespace BitBoson::BitQuark;
 /**
  * Constructor used to setup the servable for the worker node
  *
- * @param hostname String representing the hostname for the server
+ * @param hostname String representing the hostname for the server (or a local
+ *                 transport URL such as "inproc://name" to serve the node on)
  * @param port Integer representing the port to serve/listen on
  * @param nodeId String representing a node id for the worker node
+ * @param binaryPort Integer representing the port to serve the internal
+ *                   (node-to-node) routes on using the binary transport
+ *                   (which is then advertised to the other nodes) or zero
  */
 WorkerNode::WorkerNode(const std::string& hostname, int port,
-        const std::string& nodeId) : Servable(port)
+        const std::string& nodeId, int binaryPort) : Servable(port)
 {
 
     // TODO: Sanitize node id to be alpha-numeric
@@ -54,6 +58,19 @@ WorkerNode::WorkerNode(const std::string& hostname, int port,
     _nodeId = (nodeId.empty() ? StandardModel::Crypto::getRandomSha256() : nodeId);
     _nodeUrl = ("http://" + hostname + ":" + std::to_string(port));
 
+    // Serve the node over the local transport instead (if one was given)
+    if (enableLocalTransport(hostname))
+        _nodeUrl = hostname;
+
+    // Otherwise, serve the internal routes over the binary transport (if a
+    // port was given) to be advertised once started so the other nodes'
+    // heartbeats and requests are sent over it
+    else if (binaryPort > 0)
+    {
+        enableBinaryTransport(binaryPort, "/internal/");
+        _binaryNodeUrl = ("bq://" + hostname + ":" + std::to_string(binaryPort));
+    }
+
     // Setup the asynchronous event loops
     _workerEventLoop = std::make_shared<StandardModel::AsyncEventLoop>(
         [this]() {
@@ -528,12 +545,48 @@ WorkerNode::ResponseObj WorkerNode::handlerPostInternalMasterJoin(
     return retObj;
 }
 
+/**
+ * Overridden function used to start the service, advertising the binary
+ * transport (if enabled) only once it is actually listening
+ * NOTE: This is a non-blocking operation
+ *
+ * @param workerThreads Integer represeting the number of threads
+ *                      (defaults to the hardware concurrency)
+ * @return Boolean indicating whether the service was started with all of
+ *         its enabled transports listening (false if any failed to bind)
+ */
+bool WorkerNode::start(int workerThreads)
+{
+
+    // Start the service along with its transports
+    bool retFlag = Servable::start(workerThreads);
+
+    // Advertise the binary transport only if it is listening, otherwise
+    // the other nodes keep using the (HTTP) URL the node is served on
+    if (retFlag && !_binaryNodeUrl.empty())
+    {
+
+        // Lock before we attempt to access shared-memory
+        std::unique_lock<std::mutex> lock(_workerLock);
+
+        // Actually advertise the binary transport's URL
+        _nodeUrl = _binaryNodeUrl;
+    }
+
+    // Return the return flag
+    return retFlag;
+}
+
 /**
  * Destructor used to cleanup the instance
  */
 WorkerNode::~WorkerNode()
 {
 
+    // Stop serving requests first so that no handler (on any of the
+    // worker threads) can run against partially destroyed members
+    stop();
+
     // Stop the event loop
     _workerEventLoop = nullptr;
 
@@ -49,6 +49,7 @@ namespace BitBoson::BitQuark
             long _masterTimout;
             std::string _nodeId;
             std::string _nodeUrl;
+            std::string _binaryNodeUrl;
             std::mutex _workerLock;
             unsigned long _currMasterNode;
             std::vector<KnownMasterNode> _knownMasterNodes;
@@ -60,12 +61,16 @@ namespace BitBoson::BitQuark
             /**
              * Constructor used to setup the servable for the worker node
              *
-             * @param hostname String representing the hostname for the server
+             * @param hostname String representing the hostname for the server (or a local
+             *                 transport URL such as "inproc://name" to serve the node on)
              * @param port Integer representing the port to serve/listen on
              * @param nodeId String representing a node id for the worker node
+             * @param binaryPort Integer representing the port to serve the internal
+             *                   (node-to-node) routes on using the binary transport
+             *                   (which is then advertised to the other nodes) or zero
              */
             WorkerNode(const std::string& hostname, int port,
-                    const std::string& nodeId="");
+                    const std::string& nodeId="", int binaryPort=0);
 
             /**
              * Function used to set the time-out value for the master node before
@@ -97,6 +102,18 @@ namespace BitBoson::BitQuark
              */
             bool isInQuorum();
 
+            /**
+             * Overridden function used to start the service, advertising the binary
+             * transport (if enabled) only once it is actually listening
+             * NOTE: This is a non-blocking operation
+             *
+             * @param workerThreads Integer represeting the number of threads
+             *                      (defaults to the hardware concurrency)
+             * @return Boolean indicating whether the service was started with all of
+             *         its enabled transports listening (false if any failed to bind)
+             */
+            bool start(int workerThreads=0) override;
+
             /**
              * Destructor used to cleanup the instance
              */
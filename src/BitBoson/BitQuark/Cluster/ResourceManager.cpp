@@ -20,6 +20,8 @@
  */
 
 #include <cstdlib>
+#include <vector>
+#include <unordered_map>
 #include <BitBoson/BitQuark/Networking/Requests.h>
 #include <BitBoson/BitQuark/Cluster/ResourceManager.h>
 
@@ -340,9 +342,13 @@ ResourceManager::ManagedResources::getManagedResourceGroups()
  * @param hostname String representing the hostname for the server
  * @param port Integer representing the port to serve/listen on
  * @param credentials S3Credentials to setup the instance on/using
+ * @param binaryPort Integer representing the port to serve the internal
+ *                   (node-to-node) routes on using the binary transport
+ *                   (which is then advertised to the other nodes) or zero
  */
 ResourceManager::ResourceManager(const std::string& hostname, int port,
-        std::shared_ptr<S3Credentials> credentials) : MasterNode(hostname, port)
+        std::shared_ptr<S3Credentials> credentials, int binaryPort)
+        : MasterNode(hostname, port, "", binaryPort)
 {
 
     // Setup the default member values
@@ -592,42 +598,54 @@ void ResourceManager::handleClaimResourceRequest(const std::string& resourceGrou
                     (((int)(connectedNodes.size() / 2) + 1)));
         }
 
-        // Make a claim (REST API request) for the desired resource
-        // to all other, known/connected resource managers
+        // Determine the URLs of all other, known/connected resource managers
+        std::vector<std::string> masterUrls;
+        std::unordered_map<std::string, std::string> masterNodesByUrl;
         for (const auto& masterNode : connectedNodes)
         {
 
             // Only continue if we are not making a request to ourselves
             if (masterNode != _nodeId)
             {
+                auto masterUrl = (getUrlForConnectedMasterNode(masterNode) + "/internal/master/resources");
+                masterNodesByUrl[masterUrl] = masterNode;
+                masterUrls.push_back(masterUrl);
+            }
+        }
 
-                // Make the REST API request to the other nodes
-                auto masterUrl = getUrlForConnectedMasterNode(masterNode);
-                auto response = Requests::makeRequest(
-                            Servable::HttpMethod::POST, masterUrl + "/internal/master/resources",
-                            {{"ResourceManagerId", _nodeId},
-                            {"ResourceGroup", resourceGroup},
-                            {"ResourceOperation", "MANAGE"}});
-
-                // Add successful responses to the current proposal
-                // Do this in a separate context to leverage RAII for the mutex/lock
-                if (response.code < 300)
-                {
+        // Make a claim (REST API request) for the desired resource to all
+        // of the other resource managers at once, only waiting until enough
+        // of them have voted to reach quorum
+        auto broadcastResult = Requests::broadcast(masterUrls, Servable::HttpMethod::POST,
+                {{"ResourceManagerId", _nodeId},
+                {"ResourceGroup", resourceGroup},
+                {"ResourceOperation", "MANAGE"}},
+                (((int)(connectedNodes.size() / 2) + 1)));
+
+        // Add successful responses to the current proposal
+        for (auto& responseItem : broadcastResult.responses)
+        {
 
-                    // Lock before we attempt to destroy shared-memory
-                    std::unique_lock<std::mutex> lock(_lock);
+            // Only continue for successful responses
+            // Do this in a separate context to leverage RAII for the mutex/lock
+            auto& response = responseItem.second;
+            if (response.code < 300)
+            {
 
-                    // Determine the vote from the response
-                    auto vote = ResourceRequest::Vote::NAY;
-                    if (response.body["Vote"] == "YAY")
-                        vote = ResourceRequest::Vote::YAY;
+                // Lock before we attempt to destroy shared-memory
+                std::unique_lock<std::mutex> lock(_lock);
 
-                    // Search for and update the current pending proposal
-                    // for the affected resource group
-                    if (_pendingRequests.find(resourceGroup) != _pendingRequests.end())
-                        if (_pendingRequests[resourceGroup]->getResourceGroup() == resourceGroup)
-                            _pendingRequests[resourceGroup]->vote(masterNode, vote);
-                }
+                // Determine the vote from the response
+                auto vote = ResourceRequest::Vote::NAY;
+                if (response.body["Vote"] == "YAY")
+                    vote = ResourceRequest::Vote::YAY;
+
+                // Search for and update the current pending proposal
+                // for the affected resource group
+                if (_pendingRequests.find(resourceGroup) != _pendingRequests.end())
+                    if (_pendingRequests[resourceGroup]->getResourceGroup() == resourceGroup)
+                        _pendingRequests[resourceGroup]->vote(
+                                masterNodesByUrl[responseItem.first], vote);
             }
         }
     }
@@ -705,6 +723,10 @@ ResourceManager::ResponseObj ResourceManager::handlerGetInternalMasterResources(
 ResourceManager::~ResourceManager()
 {
 
+    // Stop serving requests first so that no handler (on any of the
+    // worker threads) can run against partially destroyed members
+    stop();
+
     // Stop the event loop
     _resourceEventLoop = nullptr;
 
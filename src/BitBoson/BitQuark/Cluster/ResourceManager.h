@@ -285,9 +285,12 @@ namespace BitBoson::BitQuark
              * @param hostname String representing the hostname for the server
              * @param port Integer representing the port to serve/listen on
              * @param credentials S3Credentials to setup the instance on/using
+             * @param binaryPort Integer representing the port to serve the internal
+             *                   (node-to-node) routes on using the binary transport
+             *                   (which is then advertised to the other nodes) or zero
              */
             ResourceManager(const std::string& hostname, int port,
-                    std::shared_ptr<S3Credentials> credentials);
+                    std::shared_ptr<S3Credentials> credentials, int binaryPort=0);
 
             /**
              * Function used to set the maximum request age timeout for new resources
@@ -19,6 +19,8 @@
  *     - Tyler Parcell <OriginLegend>
  */
 
+#include <chrono>
+#include <cstdlib>
 #include <BitBoson/StandardModel/Utils/Utils.h>
 #include <BitBoson/BitQuark/Cluster/State/GlobalState.h>
 
@@ -151,7 +153,12 @@ GlobalState::GlobalState(std::shared_ptr<S3Credentials> credentials,
 
     // Setup the instance using the provided values
     _accessMode = mode;
+    _claimTimeoutMs = 60000;
     _dataStore = std::make_shared<S3DataStore>(credentials);
+
+    // Cache the (repeatedly read) state records in-process, re-validating
+    // them on every read so that other instances' changes are always seen
+    _dataStore->enableObjectCache(64ULL * 1024 * 1024);
 }
 
 /**
@@ -171,21 +178,52 @@ bool GlobalState::claimManagedResourceGroup(
 
     // Only continue if the resource group is not already accounted for
     // Basically check if the group id is in the unassigned directory
+    // (either unclaimed or with a claim abandoned by a crashed manager)
+    std::string claimantId;
+    std::string unassignedETag;
     auto unassignedResource = getUnassignedPrefixedKey(groupId);
-    if (_dataStore->getItem(unassignedResource) == "UNASSIGNED")
+    auto unassignedValue = _dataStore->getItemWithETag(unassignedResource, unassignedETag);
+    bool isClaimable = (unassignedValue == "UNASSIGNED");
+
+    // An expired claim is abandoned (and so up-for-grabs) unless its manager
+    // got as far as assigning the group, in which case it is completed instead
+    if (!isClaimable && isClaimExpired(unassignedValue, claimantId))
+        isClaimable = !completeExpiredClaim(groupId, claimantId, unassignedETag);
+    if (isClaimable)
     {
 
-        // If we get here, it means the resource is up-for-grabs and
-        // thus is not assigned, so we'll add it to the assigned resources
-        auto assignedResource = getAssignedPrefixedKey(
-                resourceManagerId, groupId);
-        if (_dataStore->addItem(assignedResource, "ASSIGNED"))
+        // If we get here, it means the resource is up-for-grabs, so we'll
+        // atomically mark it as claimed by us - this only succeeds if no
+        // other manager has claimed the resource since we read it
+        auto claimMarker = getClaimMarker(resourceManagerId);
+        if (_dataStore->compareAndSet(unassignedResource, unassignedETag, claimMarker))
         {
 
-            // Once we get here, it means we have successfully assigned
-            // the resource to ourselves, so we'll delete it from the
-            // unassigned area (and assign the return flag accordingly)
-            retFlag = _dataStore->deleteItem(unassignedResource);
+            // Now that the resource is exclusively ours, add it
+            // to the assigned resources
+            auto assignedResource = getAssignedPrefixedKey(
+                    resourceManagerId, groupId);
+            if (_dataStore->addItem(assignedResource, "ASSIGNED"))
+            {
+
+                // Only finish the claim if it is still ours (it may have
+                // expired and been re-claimed if we took too long) or if it
+                // was already completed (deleted) on our behalf
+                std::string currentETag;
+                auto currentValue = _dataStore->getItemWithETag(unassignedResource, currentETag);
+                if (currentValue == claimMarker)
+                    retFlag = _dataStore->deleteItem(unassignedResource);
+                else if (currentValue.empty())
+                    retFlag = true;
+
+                // Otherwise, back-out of the assignment since we lost the claim
+                else
+                    _dataStore->deleteItem(assignedResource);
+            }
+
+            // Otherwise, release the claim so the resource can be claimed again
+            else
+                _dataStore->addItem(unassignedResource, "UNASSIGNED");
         }
     }
 
@@ -193,6 +231,73 @@ bool GlobalState::claimManagedResourceGroup(
     return retFlag;
 }
 
+/**
+ * Function used to set how long a resource group claim may stay
+ * in-progress before it is considered abandoned (by a crashed
+ * manager) and the resource group is made claimable again
+ *
+ * @param claimTimeoutMs Long representing the claim timeout (in ms)
+ */
+void GlobalState::setClaimTimeout(long claimTimeoutMs)
+{
+
+    // Simply setup the claim timeout accordingly
+    _claimTimeoutMs = claimTimeoutMs;
+}
+
+/**
+ * Function used to get the claim timeout for the instance
+ *
+ * @return Long representing the claim timeout (in ms)
+ */
+long GlobalState::getClaimTimeout() const
+{
+
+    // Simply return the claim timeout
+    return _claimTimeoutMs;
+}
+
+/**
+ * Function used to release all abandoned (expired) resource group
+ * claims so that the resource groups can be claimed again
+ * NOTE: Claiming takes-over abandoned claims on its own, so this is
+ *       only needed to tidy-up the global state (ie. administratively)
+ *
+ * @return Unsigned Long representing the number of claims released
+ */
+unsigned long GlobalState::sweepStaleClaims()
+{
+
+    // Create a return count
+    unsigned long retCount = 0;
+
+    // Loop through all of the groups in the unassigned directory
+    auto unmanagedResourceGroups = listUnmanagedResourceGroups();
+    while (unmanagedResourceGroups->hasMoreItems())
+    {
+
+        // Only continue if the group's claim has expired
+        std::string claimantId;
+        std::string unassignedETag;
+        auto groupId = unmanagedResourceGroups->getNextItem();
+        auto unassignedResource = getUnassignedPrefixedKey(groupId);
+        auto unassignedValue = _dataStore->getItemWithETag(unassignedResource, unassignedETag);
+        if (isClaimExpired(unassignedValue, claimantId))
+        {
+
+            // Complete the claim if the group was assigned, otherwise release
+            // the abandoned claim (only if no other manager has touched the
+            // group since we read it)
+            if (!completeExpiredClaim(groupId, claimantId, unassignedETag)
+                    && _dataStore->compareAndSet(unassignedResource, unassignedETag, "UNASSIGNED"))
+                retCount++;
+        }
+    }
+
+    // Return the return count
+    return retCount;
+}
+
 /**
  * Function used to drop a resource group from the provided
  * resource-manager Id
@@ -315,15 +420,15 @@ bool GlobalState::addResourceGroup(const std::string& groupId)
     if (_accessMode == Mode::READ_WRITE)
     {
 
-        // Only continue if the group doesn't already exist
+        // Only continue if the group id is valid
         auto groupPrefixedkey = getResourceGroupPrefixedKey(groupId);
-        if (!groupId.empty() && _dataStore->getItem(groupPrefixedkey).empty())
+        if (!groupId.empty())
         {
 
-            // If we get here, it means the group doesn't exist
-            // so we'll add it with a value of (zero - the size)
+            // Add the group with a value of (zero - the size) only if
+            // it doesn't already exist (as a single atomic write)
             // The value of the group-id represents the size of the group
-            retFlag = _dataStore->addItem(groupPrefixedkey,
+            retFlag = _dataStore->putIfAbsent(groupPrefixedkey,
                     StandardModel::Utils::getFileString({"0", "0", "0", "0"}));
 
             // If the resource group addition was successful, then
@@ -373,8 +478,7 @@ bool GlobalState::removeResourceGroup(const std::string& groupId)
 
                 // If we get here, it means the group exists and is
                 // empty, so we'll remove it from the data-store
-                retFlag = _dataStore->deleteItem(groupPrefixedkey);
-                retFlag &= _dataStore->deleteItem(unassignedKey);
+                retFlag = _dataStore->deleteItems({groupPrefixedkey, unassignedKey});
             }
         }
     }
@@ -474,6 +578,11 @@ bool GlobalState::setResourceInGroup(const std::string& groupId,
         if (!groupId.empty() && !resourceId.empty() && !resourceData.empty())
         {
 
+            // Read the existing resource itself (if present) while the
+            // resource group's details are being read
+            auto resourcePrefixedKey = getResourcePrefixedKey(groupId, resourceId);
+            auto resourceItemFuture = _dataStore->getItemAsync(resourcePrefixedKey);
+
             // Get the current details of the resource group cost
             auto groupPrefixedkey = getResourceGroupPrefixedKey(groupId);
             std::vector<std::string> currDetailsVect;
@@ -482,7 +591,7 @@ bool GlobalState::setResourceInGroup(const std::string& groupId,
                 currDetailsVect = currDetailsVectRaw->rawVect;
 
             // Get the current cost details of the existing resource itself (if present)
-            auto resourceItemCost = getResourceInGroupCost(groupId, resourceId);
+            auto resourceItemCost = SimpleResourceWrapper(resourceItemFuture.get()).getResourceCost();
 
             // Only continue if the resource group already exists
             if (currDetailsVect.size() >= 4)
@@ -495,7 +604,6 @@ bool GlobalState::setResourceInGroup(const std::string& groupId,
                 auto currCount = std::stoi(currDetailsVect[3]);
 
                 // Simply add the resource to the resource group
-                auto resourcePrefixedKey = getResourcePrefixedKey(groupId, resourceId);
                 auto addFlag = _dataStore->addItem(resourcePrefixedKey, resourceData);
 
                 // Only continue if the add resource data operation was successful
@@ -556,12 +664,18 @@ bool GlobalState::removeResourceInGroup(const std::string& groupId,
         if (!groupId.empty() && !resourceId.empty())
         {
 
+            // Read the resource being removed while the
+            // resource group's details are being read
+            auto resourcePrefixedKey = getResourcePrefixedKey(groupId, resourceId);
+            auto resourceToRemoveFuture = _dataStore->getItemAsync(resourcePrefixedKey);
+
             // Get the current details of the resource group cost
             auto groupPrefixedkey = getResourceGroupPrefixedKey(groupId);
             std::vector<std::string> currDetailsVect;
             auto currDetailsVectRaw = StandardModel::Utils::parseFileString(_dataStore->getItem(groupPrefixedkey));
             if (currDetailsVectRaw != nullptr)
                 currDetailsVect = currDetailsVectRaw->rawVect;
+            auto resourceToRemove = resourceToRemoveFuture.get();
 
             // Only continue if the resource group already exists
             if (currDetailsVect.size() >= 4)
@@ -574,8 +688,6 @@ bool GlobalState::removeResourceInGroup(const std::string& groupId,
                 auto currCount = std::stoi(currDetailsVect[3]);
 
                 // Simply remove the resource from the resource group
-                auto resourcePrefixedKey = getResourcePrefixedKey(groupId, resourceId);
-                auto resourceToRemove = _dataStore->getItem(resourcePrefixedKey);
                 auto removeFlag = _dataStore->deleteItem(resourcePrefixedKey);
 
                 // Only continue if the remove resource data operation was successful
@@ -628,8 +740,9 @@ std::shared_ptr<StandardModel::Generator<std::string>> GlobalState::listResource
 {
 
     // List all of the keys under the resource-group prefixed directory
+    // NOTE: Large groups are listed as several key-ranges in parallel
     auto prefix = getResourcePrefixedKey(groupId);
-    auto listedItems = _dataStore->listItems(prefix);
+    auto listedItems = _dataStore->listItems(prefix, 4);
 
     // Create and return a generator for the listing under the resource-prefix
     return std::make_shared<StandardModel::Generator<std::string>>(
@@ -730,3 +843,90 @@ std::string GlobalState::getAssignedPrefixedKey(const std::string& resourceManag
     return std::string("Assignments/Assigned/")
             + resourceManagerId + std::string("/") + groupId;
 }
+
+/**
+ * Internal function used to get a (timestamped) claim marker for
+ * the given resource-manager Id
+ *
+ * @param resourceManagerId String representing the manager Id to use
+ * @return String representing the claim marker to use
+ */
+std::string GlobalState::getClaimMarker(const std::string& resourceManagerId) const
+{
+
+    // Mark the claim with its owner and when it was made (as wall-clock
+    // time, since the marker is compared across different machines)
+    auto claimTime = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+    return StandardModel::Utils::getFileString(
+            {"CLAIMED", resourceManagerId, std::to_string(claimTime)});
+}
+
+/**
+ * Internal function used to determine whether the given unassigned
+ * value is a claim marker which has expired (without being completed)
+ *
+ * @param unassignedValue String representing the unassigned value
+ * @param claimantId String representing the expired claim's manager Id
+ * @return Boolean indicating whether the value is an expired claim or not
+ */
+bool GlobalState::isClaimExpired(const std::string& unassignedValue,
+        std::string& claimantId) const
+{
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Only continue if the value is a valid claim marker
+    auto claimMarker = StandardModel::Utils::parseFileString(unassignedValue);
+    if ((claimMarker != nullptr) && (claimMarker->rawVect.size() >= 3)
+            && (claimMarker->rawVect[0] == "CLAIMED"))
+    {
+
+        // Determine whether the claim has expired
+        auto claimTime = std::strtoll(claimMarker->rawVect[2].c_str(), nullptr, 10);
+        auto currentTime = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::system_clock::now().time_since_epoch()).count();
+        if ((currentTime - claimTime) > _claimTimeoutMs)
+        {
+            claimantId = claimMarker->rawVect[1];
+            retFlag = true;
+        }
+    }
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Internal function used to complete an expired claim if its manager
+ * got as far as assigning the resource group to itself (by removing
+ * the claim marker, provided it is unchanged)
+ *
+ * @param groupId String representing the group Id to use
+ * @param claimantId String representing the expired claim's manager Id
+ * @param unassignedETag String representing the claim marker's ETag
+ * @return Boolean indicating whether the group was assigned to the manager
+ */
+bool GlobalState::completeExpiredClaim(const std::string& groupId,
+        const std::string& claimantId, const std::string& unassignedETag)
+{
+
+    // Only continue if the claiming manager assigned the group to itself
+    bool wasAssigned = (_dataStore->getItem(
+            getAssignedPrefixedKey(claimantId, groupId)) == "ASSIGNED");
+    if (wasAssigned)
+    {
+
+        // Remove the claim marker, but only if it has not changed since
+        // it was read (as the group may have been dropped in the meantime)
+        std::string currentETag;
+        auto unassignedResource = getUnassignedPrefixedKey(groupId);
+        _dataStore->getItemWithETag(unassignedResource, currentETag);
+        if (currentETag == unassignedETag)
+            _dataStore->deleteItem(unassignedResource);
+    }
+
+    // Return whether the group was assigned
+    return wasAssigned;
+}
@@ -112,6 +112,7 @@ namespace BitBoson::BitQuark
         // Private member variables
         private:
             Mode _accessMode;
+            long _claimTimeoutMs;
             std::shared_ptr<S3DataStore> _dataStore;
 
         // Public member functions
@@ -137,6 +138,32 @@ namespace BitBoson::BitQuark
             bool claimManagedResourceGroup(const std::string& resourceManagerId,
                     const std::string& groupId);
 
+            /**
+             * Function used to set how long a resource group claim may stay
+             * in-progress before it is considered abandoned (by a crashed
+             * manager) and the resource group is made claimable again
+             *
+             * @param claimTimeoutMs Long representing the claim timeout (in ms)
+             */
+            void setClaimTimeout(long claimTimeoutMs);
+
+            /**
+             * Function used to get the claim timeout for the instance
+             *
+             * @return Long representing the claim timeout (in ms)
+             */
+            long getClaimTimeout() const;
+
+            /**
+             * Function used to release all abandoned (expired) resource group
+             * claims so that the resource groups can be claimed again
+             * NOTE: Claiming takes-over abandoned claims on its own, so this is
+             *       only needed to tidy-up the global state (ie. administratively)
+             *
+             * @return Unsigned Long representing the number of claims released
+             */
+            unsigned long sweepStaleClaims();
+
             /**
              * Function used to drop a resource group from the provided
              * resource-manager Id
@@ -296,6 +323,39 @@ namespace BitBoson::BitQuark
              */
             std::string getAssignedPrefixedKey(const std::string& resourceManagerId,
                     const std::string& groupId="") const;
+
+            /**
+             * Internal function used to get a (timestamped) claim marker for
+             * the given resource-manager Id
+             *
+             * @param resourceManagerId String representing the manager Id to use
+             * @return String representing the claim marker to use
+             */
+            std::string getClaimMarker(const std::string& resourceManagerId) const;
+
+            /**
+             * Internal function used to determine whether the given unassigned
+             * value is a claim marker which has expired (without being completed)
+             *
+             * @param unassignedValue String representing the unassigned value
+             * @param claimantId String representing the expired claim's manager Id
+             * @return Boolean indicating whether the value is an expired claim or not
+             */
+            bool isClaimExpired(const std::string& unassignedValue,
+                    std::string& claimantId) const;
+
+            /**
+             * Internal function used to complete an expired claim if its manager
+             * got as far as assigning the resource group to itself (by removing
+             * the claim marker, provided it is unchanged)
+             *
+             * @param groupId String representing the group Id to use
+             * @param claimantId String representing the expired claim's manager Id
+             * @param unassignedETag String representing the claim marker's ETag
+             * @return Boolean indicating whether the group was assigned to the manager
+             */
+            bool completeExpiredClaim(const std::string& groupId,
+                    const std::string& claimantId, const std::string& unassignedETag);
     };
 }
 
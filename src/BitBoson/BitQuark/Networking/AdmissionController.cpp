@@ -0,0 +1,662 @@
+/* This file is part of bit-quark.
+ *
+ * Copyright (c) BitBoson
+ *
+ * bit-quark is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bit-quark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bit-quark.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#include <mutex>
+#include <deque>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+#include <sstream>
+#include <utility>
+#include <functional>
+#include <condition_variable>
+#include <BitBoson/BitQuark/Networking/AdmissionController.h>
+
+using namespace BitBoson;
+using namespace BitBoson::BitQuark;
+
+/**
+ * Constructor used to setup the admission controller instance
+ * NOTE: All limits default to zero, meaning everything is admitted
+ *
+ * @param maxConcurrent Long representing the maximum number of requests
+ *                      handled at once across all route classes
+ * @param queueTimeout Long representing the time (in milliseconds) a
+ *                     queued request waits before being shed
+ * @param retryAfter Long representing the time (in seconds) shed
+ *                   callers are told to wait before retrying
+ */
+AdmissionController::AdmissionController(long maxConcurrent, long queueTimeout, long retryAfter)
+{
+
+    // Setup the member variables
+    _retryAfter = retryAfter;
+    _queueTimeout = queueTimeout;
+    _maxConcurrent = maxConcurrent;
+    _totalActive = 0;
+    _isStopping = false;
+}
+
+/**
+ * Function used to set the maximum number of requests handled at
+ * once across all route classes
+ *
+ * @param maxConcurrent Long representing the limit (or zero for no limit)
+ */
+void AdmissionController::setMaxConcurrent(long maxConcurrent)
+{
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_lock);
+
+    // Setup the limit and let any waiting requests re-check it
+    _maxConcurrent = (maxConcurrent < 0 ? 0 : maxConcurrent);
+    _releasedCondition.notify_all();
+}
+
+/**
+ * Function used to set the limits for an individual route class
+ *
+ * @param routeClass Route Class representing the class to set the limits for
+ * @param maxConcurrent Long representing the maximum number of the class's
+ *                      requests handled at once (or zero for no limit)
+ * @param maxQueued Long representing the maximum number of the class's
+ *                  requests waiting to be handled before shedding
+ */
+void AdmissionController::setClassLimits(RouteClass routeClass, long maxConcurrent, long maxQueued)
+{
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_lock);
+
+    // Setup the limits and let any waiting requests re-check them
+    _classStates[routeClass].maxConcurrent = (maxConcurrent < 0 ? 0 : maxConcurrent);
+    _classStates[routeClass].maxQueued = (maxQueued < 0 ? 0 : maxQueued);
+    _releasedCondition.notify_all();
+}
+
+/**
+ * Function used to set the time a queued request waits before being shed
+ *
+ * @param queueTimeout Long representing the time (in milliseconds) to wait
+ */
+void AdmissionController::setQueueTimeout(long queueTimeout)
+{
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_lock);
+
+    // Setup the queue timeout
+    _queueTimeout = (queueTimeout < 0 ? 0 : queueTimeout);
+}
+
+/**
+ * Function used to get the time shed callers are told to wait before retrying
+ *
+ * @return Long representing the time (in seconds) to wait
+ */
+long AdmissionController::getRetryAfter()
+{
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_lock);
+
+    // Return the retry-after time
+    return _retryAfter;
+}
+
+/**
+ * Static function used to get the route class for the given route
+ * NOTE: Internal (node-to-node) routes take priority over all others
+ *
+ * @param route String representing the route to classify
+ * @return Route Class representing the class of the route
+ */
+AdmissionController::RouteClass AdmissionController::classify(const std::string& route)
+{
+
+    // Return the class based on the route's prefix
+    return (route.compare(0, 10, "/internal/") == 0 ? RouteClass::INTERNAL : RouteClass::EXTERNAL);
+}
+
+/**
+ * Function used to admit a request of the given class, waiting (in
+ * priority order) for capacity if it is not available right away
+ * NOTE: Every admitted request must be released once handled
+ *
+ * @param routeClass Route Class representing the class of the request
+ * @return Boolean indicating whether the request was admitted (or shed)
+ */
+bool AdmissionController::admit(RouteClass routeClass)
+{
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_lock);
+    auto& classState = _classStates[routeClass];
+
+    // Wait for capacity (if there is room in the queue) unless it is available already
+    bool admitted = canAdmitUnlocked(routeClass);
+    if (!admitted && (classState.queued < classState.maxQueued))
+    {
+        classState.queued++;
+        admitted = _releasedCondition.wait_for(lock, std::chrono::milliseconds(_queueTimeout),
+            [this, routeClass]()
+            {
+                return canAdmitUnlocked(routeClass);
+            });
+        classState.queued--;
+
+        // Leaving the queue may unblock lower-priority requests
+        if (!admitted)
+            _releasedCondition.notify_all();
+    }
+
+    // Either admit or shed the request
+    if (admitted)
+        admitUnlocked(routeClass);
+    else
+        classState.shed++;
+
+    // Return whether the request was admitted
+    return admitted;
+}
+
+/**
+ * Function used to admit a request of the given class without blocking,
+ * parking it (in priority order) until capacity is released if it is
+ * not available right away
+ * NOTE: The resume function is called exactly once, either right away
+ *       or from the thread releasing the capacity, indicating whether
+ *       the request was admitted (and so must be released) or shed
+ * NOTE: Parked requests are shed as soon as their queue timeout passes
+ *
+ * @param routeClass Route Class representing the class of the request
+ * @param resumeFunction Callback Function used to resume the request
+ */
+void AdmissionController::admit(RouteClass routeClass, std::function<void(bool)> resumeFunction)
+{
+
+    // Determine which requests to resume (outside of the lock)
+    // NOTE: Do this in a separate context to leverage RAII for the mutex/lock
+    Resumptions resumptions;
+    {
+
+        // Lock the thread for safe operation
+        std::unique_lock<std::mutex> lock(_lock);
+        auto& classState = _classStates[routeClass];
+
+        // Shed any parked requests which have waited too long
+        collectParkedUnlocked(resumptions);
+
+        // Admit the request right away if there is capacity for it
+        if (canAdmitUnlocked(routeClass))
+        {
+            admitUnlocked(routeClass);
+            resumptions.emplace_back(std::move(resumeFunction), true);
+        }
+
+        // Otherwise, park the request (if there is room in the queue)
+        else if (classState.queued < classState.maxQueued)
+        {
+            classState.queued++;
+            classState.parkedRequests.push_back(ParkedRequest{std::move(resumeFunction),
+                    (std::chrono::steady_clock::now() + std::chrono::milliseconds(_queueTimeout))});
+
+            // Have the request shed on time, even if nothing else is released
+            if (!_expiryThread.joinable())
+                _expiryThread = std::thread([this]() { runParkedExpiry(); });
+            _parkedCondition.notify_all();
+        }
+
+        // Otherwise, shed the request
+        else
+        {
+            classState.shed++;
+            resumptions.emplace_back(std::move(resumeFunction), false);
+        }
+    }
+
+    // Resume the requests now that the lock is no longer held
+    resumeParked(resumptions);
+}
+
+/**
+ * Function used to release a previously admitted request
+ *
+ * @param routeClass Route Class representing the class of the request
+ */
+void AdmissionController::release(RouteClass routeClass)
+{
+
+    // Determine which requests to resume (outside of the lock)
+    // NOTE: Do this in a separate context to leverage RAII for the mutex/lock
+    Resumptions resumptions;
+    {
+
+        // Lock the thread for safe operation
+        std::unique_lock<std::mutex> lock(_lock);
+
+        // Free-up the request's capacity, handing it to the parked requests
+        // first and then letting the waiting requests re-check it
+        // NOTE: All are notified as only those of the highest priority may proceed
+        _classStates[routeClass].active--;
+        _totalActive--;
+        collectParkedUnlocked(resumptions);
+        _releasedCondition.notify_all();
+    }
+
+    // Resume the requests now that the lock is no longer held
+    resumeParked(resumptions);
+}
+
+/**
+ * Function used to shed all of the requests which are currently parked
+ * NOTE: This is used when stopping so parked requests are not stranded
+ */
+void AdmissionController::shedParkedRequests()
+{
+
+    // Determine which requests to resume (outside of the lock)
+    // NOTE: Do this in a separate context to leverage RAII for the mutex/lock
+    Resumptions resumptions;
+    {
+
+        // Lock the thread for safe operation
+        std::unique_lock<std::mutex> lock(_lock);
+
+        // Shed every parked request
+        for (auto& classState : _classStates)
+        {
+            for (auto& parkedRequest : classState.parkedRequests)
+                resumptions.emplace_back(std::move(parkedRequest.resumeFunction), false);
+            classState.shed += classState.parkedRequests.size();
+            classState.queued -= (long) classState.parkedRequests.size();
+            classState.parkedRequests.clear();
+        }
+
+        // Leaving the queue may unblock lower-priority requests
+        _releasedCondition.notify_all();
+    }
+
+    // Resume the requests now that the lock is no longer held
+    resumeParked(resumptions);
+}
+
+/**
+ * Function used to get the number of requests being handled for the class
+ *
+ * @param routeClass Route Class representing the class to check
+ * @return Long representing the number of active requests
+ */
+long AdmissionController::getActiveCount(RouteClass routeClass)
+{
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_lock);
+
+    // Return the number of active requests
+    return _classStates[routeClass].active;
+}
+
+/**
+ * Function used to get the number of requests waiting for the class
+ *
+ * @param routeClass Route Class representing the class to check
+ * @return Long representing the number of queued requests
+ */
+long AdmissionController::getQueuedCount(RouteClass routeClass)
+{
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_lock);
+
+    // Return the number of queued requests
+    return _classStates[routeClass].queued;
+}
+
+/**
+ * Function used to get the number of requests admitted for the class
+ *
+ * @param routeClass Route Class representing the class to check
+ * @return Unsigned Long representing the number of admitted requests
+ */
+unsigned long AdmissionController::getAdmittedCount(RouteClass routeClass)
+{
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_lock);
+
+    // Return the number of admitted requests
+    return _classStates[routeClass].admitted;
+}
+
+/**
+ * Function used to get the number of requests shed for the class
+ *
+ * @param routeClass Route Class representing the class to check
+ * @return Unsigned Long representing the number of shed requests
+ */
+unsigned long AdmissionController::getShedCount(RouteClass routeClass)
+{
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_lock);
+
+    // Return the number of shed requests
+    return _classStates[routeClass].shed;
+}
+
+/**
+ * Function used to get the admission metrics in the Prometheus text format
+ *
+ * @return String representing the metrics in the Prometheus text format
+ */
+std::string AdmissionController::toPrometheus()
+{
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_lock);
+
+    // Write the counters and gauges for each route class
+    const char* classNames[NUM_ROUTE_CLASSES] = {"internal", "external"};
+    std::ostringstream output;
+    output << "# HELP bitquark_admission_admitted_total Requests admitted by route class\n";
+    output << "# TYPE bitquark_admission_admitted_total counter\n";
+    for (int routeClass = 0; routeClass < NUM_ROUTE_CLASSES; routeClass++)
+        output << "bitquark_admission_admitted_total{class=\"" << classNames[routeClass] << "\"} "
+               << _classStates[routeClass].admitted << "\n";
+    output << "# HELP bitquark_admission_shed_total Requests shed (503) by route class\n";
+    output << "# TYPE bitquark_admission_shed_total counter\n";
+    for (int routeClass = 0; routeClass < NUM_ROUTE_CLASSES; routeClass++)
+        output << "bitquark_admission_shed_total{class=\"" << classNames[routeClass] << "\"} "
+               << _classStates[routeClass].shed << "\n";
+    output << "# HELP bitquark_admission_queued Requests waiting for admission by route class\n";
+    output << "# TYPE bitquark_admission_queued gauge\n";
+    for (int routeClass = 0; routeClass < NUM_ROUTE_CLASSES; routeClass++)
+        output << "bitquark_admission_queued{class=\"" << classNames[routeClass] << "\"} "
+               << _classStates[routeClass].queued << "\n";
+
+    // Return the metrics text
+    return output.str();
+}
+
+/**
+ * Internal function used to determine whether a request of the given
+ * class can be admitted right now
+ * NOTE: The controller's lock must be held when calling this function
+ *
+ * @param routeClass Route Class representing the class of the request
+ * @return Boolean indicating whether the request can be admitted
+ */
+bool AdmissionController::canAdmitUnlocked(RouteClass routeClass)
+{
+
+    // Never admit ahead of higher-priority requests which are waiting
+    // for capacity they could actually use
+    for (int higherClass = 0; higherClass < routeClass; higherClass++)
+        if ((_classStates[higherClass].queued > 0) && hasCapacityUnlocked((RouteClass) higherClass))
+            return false;
+
+    // Otherwise, admit the request if there is capacity for it
+    return hasCapacityUnlocked(routeClass);
+}
+
+/**
+ * Internal function used to determine whether the class has capacity
+ * NOTE: The controller's lock must be held when calling this function
+ *
+ * @param routeClass Route Class representing the class to check
+ * @return Boolean indicating whether the class has capacity
+ */
+bool AdmissionController::hasCapacityUnlocked(RouteClass routeClass)
+{
+
+    // Return whether both the overall and class limits have room
+    const auto& classState = _classStates[routeClass];
+    return (((_maxConcurrent <= 0) || (_totalActive < _maxConcurrent))
+            && ((classState.maxConcurrent <= 0) || (classState.active < classState.maxConcurrent)));
+}
+
+/**
+ * Internal function used to admit a request of the given class
+ * NOTE: The controller's lock must be held when calling this function
+ *
+ * @param routeClass Route Class representing the class of the request
+ */
+void AdmissionController::admitUnlocked(RouteClass routeClass)
+{
+
+    // Take-up the request's capacity
+    auto& classState = _classStates[routeClass];
+    classState.active++;
+    classState.admitted++;
+    _totalActive++;
+}
+
+/**
+ * Internal function used to collect the parked requests which have
+ * waited past their queue timeout (and so should be shed)
+ * NOTE: The controller's lock must be held when calling this function
+ *
+ * @param resumptions Resumptions to add the requests to resume onto
+ */
+void AdmissionController::collectExpiredUnlocked(Resumptions& resumptions)
+{
+
+    // Shed all of the parked requests which have waited too long
+    auto currentTime = std::chrono::steady_clock::now();
+    bool hasShed = false;
+    for (auto& classState : _classStates)
+    {
+        auto& parkedRequests = classState.parkedRequests;
+        for (auto parkedIter = parkedRequests.begin(); parkedIter != parkedRequests.end();)
+        {
+            if (parkedIter->deadline <= currentTime)
+            {
+                resumptions.emplace_back(std::move(parkedIter->resumeFunction), false);
+                classState.queued--;
+                classState.shed++;
+                parkedIter = parkedRequests.erase(parkedIter);
+                hasShed = true;
+            }
+            else
+            {
+                parkedIter++;
+            }
+        }
+    }
+
+    // Leaving the queue may unblock lower-priority requests
+    if (hasShed)
+        _releasedCondition.notify_all();
+}
+
+/**
+ * Internal function used to collect the parked requests which should
+ * be resumed, either since they can be admitted or have expired
+ * NOTE: The controller's lock must be held when calling this function
+ *
+ * @param resumptions Resumptions to add the requests to resume onto
+ */
+void AdmissionController::collectParkedUnlocked(Resumptions& resumptions)
+{
+
+    // Shed all of the parked requests which have waited too long
+    collectExpiredUnlocked(resumptions);
+
+    // Admit the parked requests (in priority and then arrival order)
+    // for as long as there is capacity for them
+    for (int routeClass = 0; routeClass < NUM_ROUTE_CLASSES; routeClass++)
+    {
+        auto& classState = _classStates[routeClass];
+        while (!classState.parkedRequests.empty() && canAdmitUnlocked((RouteClass) routeClass))
+        {
+            resumptions.emplace_back(std::move(classState.parkedRequests.front().resumeFunction), true);
+            classState.parkedRequests.pop_front();
+            classState.queued--;
+            admitUnlocked((RouteClass) routeClass);
+        }
+    }
+}
+
+/**
+ * Internal static function used to resume the given parked requests
+ * NOTE: Resumptions made while already resuming on the same thread are
+ *       run by the outer-most call so that the stack does not grow
+ *       with each request resumed by a resumed request's release
+ *
+ * @param resumptions Resumptions representing the requests to resume
+ */
+void AdmissionController::resumeParked(Resumptions& resumptions)
+{
+
+    // Add the requests onto this thread's pending resumptions
+    thread_local bool isResuming = false;
+    thread_local std::deque<std::pair<std::function<void(bool)>, bool>> pendingResumptions;
+    for (auto& resumption : resumptions)
+        pendingResumptions.push_back(std::move(resumption));
+    resumptions.clear();
+
+    // Only resume the requests if this is the outer-most call on the thread
+    if (!isResuming)
+    {
+        isResuming = true;
+        while (!pendingResumptions.empty())
+        {
+            auto resumption = std::move(pendingResumptions.front());
+            pendingResumptions.pop_front();
+            // NOTE: Errors are dropped (rather than propagated out of the
+            //       release of an unrelated request) so that the remaining
+            //       requests, which already hold their capacity, still resume
+            try
+            {
+                resumption.first(resumption.second);
+            }
+            catch (...)
+            {
+            }
+        }
+        isResuming = false;
+    }
+}
+
+/**
+ * Destructor used to cleanup the instance
+ */
+AdmissionController::~AdmissionController()
+{
+
+    // Signal the expiry thread to stop
+    // Do this in a separate context to leverage RAII for the mutex/lock
+    {
+
+        // Lock the thread for safe operation
+        std::unique_lock<std::mutex> lock(_lock);
+
+        // Indicate that the expiry thread should stop
+        _isStopping = true;
+        _parkedCondition.notify_all();
+    }
+
+    // Wait for the expiry thread to finish
+    if (_expiryThread.joinable())
+        _expiryThread.join();
+}
+
+/**
+ * Internal function used to continuously shed the parked requests as
+ * their queue timeouts pass (until the instance is destroyed)
+ * NOTE: This only sheds requests so that it never runs a handler
+ */
+void AdmissionController::runParkedExpiry()
+{
+
+    // Continuously shed the expired parked requests until stopped
+    while (true)
+    {
+
+        // Wait until the earliest parked request's deadline (if any)
+        // Do this in a separate context to leverage RAII for the mutex/lock
+        Resumptions resumptions;
+        {
+
+            // Lock the thread for safe operation
+            std::unique_lock<std::mutex> lock(_lock);
+
+            // Find the earliest deadline of all of the parked requests
+            bool hasParked = false;
+            std::chrono::steady_clock::time_point earliestDeadline;
+            for (const auto& classState : _classStates)
+            {
+                for (const auto& parkedRequest : classState.parkedRequests)
+                {
+                    if (!hasParked || (parkedRequest.deadline < earliestDeadline))
+                        earliestDeadline = parkedRequest.deadline;
+                    hasParked = true;
+                }
+            }
+
+            // Wait for the deadline or for a request to be parked
+            if (!_isStopping)
+            {
+                if (hasParked)
+                    _parkedCondition.wait_until(lock, earliestDeadline);
+                else
+                    _parkedCondition.wait(lock);
+            }
+
+            // Exit the expiry thread if it is stopping
+            if (_isStopping)
+                break;
+
+            // Collect the requests which have now expired
+            collectExpiredUnlocked(resumptions);
+        }
+
+        // Shed the requests now that the lock is no longer held
+        resumeParked(resumptions);
+    }
+}
+
+/**
+ * Constructor used to take ownership of an admitted request
+ * NOTE: The request is released when the guard is destroyed,
+ *       even if its handler throws an exception
+ *
+ * @param admissionController Admission Controller the request was admitted by
+ * @param routeClass Route Class representing the class of the request
+ */
+AdmissionController::Guard::Guard(AdmissionController& admissionController, RouteClass routeClass)
+    : _routeClass(routeClass), _admissionController(admissionController)
+{
+}
+
+/**
+ * Destructor used to release the admitted request
+ */
+AdmissionController::Guard::~Guard()
+{
+
+    // Release the admitted request
+    _admissionController.release(_routeClass);
+}
@@ -0,0 +1,335 @@
+/* This file is part of bit-quark.
+ *
+ * Copyright (c) BitBoson
+ *
+ * bit-quark is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bit-quark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bit-quark.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#ifndef BITQUARK_ADMISSIONCONTROLLER_H
+#define BITQUARK_ADMISSIONCONTROLLER_H
+
+#include <mutex>
+#include <array>
+#include <deque>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+#include <utility>
+#include <functional>
+#include <condition_variable>
+
+namespace BitBoson::BitQuark
+{
+
+    class AdmissionController
+    {
+
+        // Public enumerations
+        public:
+            enum RouteClass
+            {
+                INTERNAL,
+                EXTERNAL
+            };
+
+        // Public internal class
+        public:
+            class Guard
+            {
+
+                // Private member variables
+                private:
+                    RouteClass _routeClass;
+                    AdmissionController& _admissionController;
+
+                // Public member functions
+                public:
+
+                    /**
+                     * Constructor used to take ownership of an admitted request
+                     * NOTE: The request is released when the guard is destroyed,
+                     *       even if its handler throws an exception
+                     *
+                     * @param admissionController Admission Controller the request was admitted by
+                     * @param routeClass Route Class representing the class of the request
+                     */
+                    Guard(AdmissionController& admissionController, RouteClass routeClass);
+
+                    /**
+                     * Deleted copy constructor (since the request is released only once)
+                     */
+                    Guard(const Guard&) = delete;
+
+                    /**
+                     * Deleted copy assignment operator (since the request is released only once)
+                     */
+                    Guard& operator=(const Guard&) = delete;
+
+                    /**
+                     * Destructor used to release the admitted request
+                     */
+                    virtual ~Guard();
+            };
+
+        // Private structures
+        private:
+            struct ParkedRequest
+            {
+                std::function<void(bool)> resumeFunction;
+                std::chrono::steady_clock::time_point deadline;
+            };
+            struct ClassState
+            {
+                long maxConcurrent = 0;
+                long maxQueued = 0;
+                long active = 0;
+                long queued = 0;
+                unsigned long admitted = 0;
+                unsigned long shed = 0;
+                std::deque<ParkedRequest> parkedRequests;
+            };
+            typedef std::vector<std::pair<std::function<void(bool)>, bool>> Resumptions;
+
+        // Private constants
+        private:
+            static const int NUM_ROUTE_CLASSES = 2;
+
+        // Private member variables
+        private:
+            std::mutex _lock;
+            long _retryAfter;
+            long _queueTimeout;
+            long _maxConcurrent;
+            long _totalActive;
+            bool _isStopping;
+            std::thread _expiryThread;
+            std::condition_variable _parkedCondition;
+            std::condition_variable _releasedCondition;
+            std::array<ClassState, NUM_ROUTE_CLASSES> _classStates;
+
+        // Public member functions
+        public:
+
+            /**
+             * Constructor used to setup the admission controller instance
+             * NOTE: All limits default to zero, meaning everything is admitted
+             *
+             * @param maxConcurrent Long representing the maximum number of requests
+             *                      handled at once across all route classes
+             * @param queueTimeout Long representing the time (in milliseconds) a
+             *                     queued request waits before being shed
+             * @param retryAfter Long representing the time (in seconds) shed
+             *                   callers are told to wait before retrying
+             */
+            explicit AdmissionController(long maxConcurrent=0, long queueTimeout=1000,
+                    long retryAfter=1);
+
+            /**
+             * Function used to set the maximum number of requests handled at
+             * once across all route classes
+             *
+             * @param maxConcurrent Long representing the limit (or zero for no limit)
+             */
+            void setMaxConcurrent(long maxConcurrent);
+
+            /**
+             * Function used to set the limits for an individual route class
+             *
+             * @param routeClass Route Class representing the class to set the limits for
+             * @param maxConcurrent Long representing the maximum number of the class's
+             *                      requests handled at once (or zero for no limit)
+             * @param maxQueued Long representing the maximum number of the class's
+             *                  requests waiting to be handled before shedding
+             */
+            void setClassLimits(RouteClass routeClass, long maxConcurrent, long maxQueued);
+
+            /**
+             * Function used to set the time a queued request waits before being shed
+             *
+             * @param queueTimeout Long representing the time (in milliseconds) to wait
+             */
+            void setQueueTimeout(long queueTimeout);
+
+            /**
+             * Function used to get the time shed callers are told to wait before retrying
+             *
+             * @return Long representing the time (in seconds) to wait
+             */
+            long getRetryAfter();
+
+            /**
+             * Static function used to get the route class for the given route
+             * NOTE: Internal (node-to-node) routes take priority over all others
+             *
+             * @param route String representing the route to classify
+             * @return Route Class representing the class of the route
+             */
+            static RouteClass classify(const std::string& route);
+
+            /**
+             * Function used to admit a request of the given class, waiting (in
+             * priority order) for capacity if it is not available right away
+             * NOTE: Every admitted request must be released once handled
+             * NOTE: This blocks the calling thread while queued, so it is only
+             *       meant for transports which dedicate a thread to the caller
+             *
+             * @param routeClass Route Class representing the class of the request
+             * @return Boolean indicating whether the request was admitted (or shed)
+             */
+            bool admit(RouteClass routeClass);
+
+            /**
+             * Function used to admit a request of the given class without blocking,
+             * parking it (in priority order) until capacity is released if it is
+             * not available right away
+             * NOTE: The resume function is called exactly once, either right away
+             *       or from the thread releasing the capacity, indicating whether
+             *       the request was admitted (and so must be released) or shed
+             * NOTE: Parked requests are shed as soon as their queue timeout passes
+             *
+             * @param routeClass Route Class representing the class of the request
+             * @param resumeFunction Callback Function used to resume the request
+             */
+            void admit(RouteClass routeClass, std::function<void(bool)> resumeFunction);
+
+            /**
+             * Function used to release a previously admitted request
+             *
+             * @param routeClass Route Class representing the class of the request
+             */
+            void release(RouteClass routeClass);
+
+            /**
+             * Function used to shed all of the requests which are currently parked
+             * NOTE: This is used when stopping so parked requests are not stranded
+             */
+            void shedParkedRequests();
+
+            /**
+             * Function used to get the number of requests being handled for the class
+             *
+             * @param routeClass Route Class representing the class to check
+             * @return Long representing the number of active requests
+             */
+            long getActiveCount(RouteClass routeClass);
+
+            /**
+             * Function used to get the number of requests waiting for the class
+             *
+             * @param routeClass Route Class representing the class to check
+             * @return Long representing the number of queued requests
+             */
+            long getQueuedCount(RouteClass routeClass);
+
+            /**
+             * Function used to get the number of requests admitted for the class
+             *
+             * @param routeClass Route Class representing the class to check
+             * @return Unsigned Long representing the number of admitted requests
+             */
+            unsigned long getAdmittedCount(RouteClass routeClass);
+
+            /**
+             * Function used to get the number of requests shed for the class
+             *
+             * @param routeClass Route Class representing the class to check
+             * @return Unsigned Long representing the number of shed requests
+             */
+            unsigned long getShedCount(RouteClass routeClass);
+
+            /**
+             * Function used to get the admission metrics in the Prometheus text format
+             *
+             * @return String representing the metrics in the Prometheus text format
+             */
+            std::string toPrometheus();
+
+            /**
+             * Destructor used to cleanup the instance
+             */
+            virtual ~AdmissionController();
+
+        // Private member functions
+        private:
+
+            /**
+             * Internal function used to determine whether a request of the given
+             * class can be admitted right now
+             * NOTE: The controller's lock must be held when calling this function
+             *
+             * @param routeClass Route Class representing the class of the request
+             * @return Boolean indicating whether the request can be admitted
+             */
+            bool canAdmitUnlocked(RouteClass routeClass);
+
+            /**
+             * Internal function used to determine whether the class has capacity
+             * NOTE: The controller's lock must be held when calling this function
+             *
+             * @param routeClass Route Class representing the class to check
+             * @return Boolean indicating whether the class has capacity
+             */
+            bool hasCapacityUnlocked(RouteClass routeClass);
+
+            /**
+             * Internal function used to admit a request of the given class
+             * NOTE: The controller's lock must be held when calling this function
+             *
+             * @param routeClass Route Class representing the class of the request
+             */
+            void admitUnlocked(RouteClass routeClass);
+
+            /**
+             * Internal function used to collect the parked requests which have
+             * waited past their queue timeout (and so should be shed)
+             * NOTE: The controller's lock must be held when calling this function
+             *
+             * @param resumptions Resumptions to add the requests to resume onto
+             */
+            void collectExpiredUnlocked(Resumptions& resumptions);
+
+            /**
+             * Internal function used to collect the parked requests which should
+             * be resumed, either since they can be admitted or have expired
+             * NOTE: The controller's lock must be held when calling this function
+             *
+             * @param resumptions Resumptions to add the requests to resume onto
+             */
+            void collectParkedUnlocked(Resumptions& resumptions);
+
+            /**
+             * Internal static function used to resume the given parked requests
+             * NOTE: Resumptions made while already resuming on the same thread are
+             *       run by the outer-most call so that the stack does not grow
+             *       with each request resumed by a resumed request's release
+             *
+             * @param resumptions Resumptions representing the requests to resume
+             */
+            static void resumeParked(Resumptions& resumptions);
+
+            /**
+             * Internal function used to continuously shed the parked requests as
+             * their queue timeouts pass (until the instance is destroyed)
+             * NOTE: This only sheds requests so that it never runs a handler
+             */
+            void runParkedExpiry();
+    };
+}
+
+#endif //BITQUARK_ADMISSIONCONTROLLER_H
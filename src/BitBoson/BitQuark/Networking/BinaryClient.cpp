@@ -0,0 +1,447 @@
+/* This file is part of bit-quark.
+ *
+ * Copyright (c) BitBoson
+ *
+ * bit-quark is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bit-quark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bit-quark.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#include <mutex>
+#include <chrono>
+#include <limits>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <unordered_map>
+#include <cctype>
+#include <cerrno>
+#include <fcntl.h>
+#include <poll.h>
+#include <netdb.h>
+#include <unistd.h>
+#include <sys/time.h>
+#include <sys/types.h>
+#include <sys/un.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <BitBoson/BitQuark/Networking/Payload.h>
+#include <BitBoson/BitQuark/Networking/Servable.h>
+#include <BitBoson/BitQuark/Networking/BinaryCodec.h>
+#include <BitBoson/BitQuark/Networking/BinaryClient.h>
+
+using namespace BitBoson;
+using namespace BitBoson::BitQuark;
+
+/**
+ * Constructor used to setup the binary (length-prefixed frame) client
+ *
+ * @param maxIdleConnectionsPerHost Unsigned Long representing the maximum
+ *                                  number of idle connections kept per host
+ * @param idleTimeoutMs Long representing how long (in milliseconds)
+ *                      an idle connection is kept before eviction
+ */
+BinaryClient::BinaryClient(unsigned long maxIdleConnectionsPerHost, long idleTimeoutMs)
+{
+
+    // Setup the member variables
+    _idleTimeoutMs = idleTimeoutMs;
+    _maxIdleConnectionsPerHost = maxIdleConnectionsPerHost;
+}
+
+/**
+ * Static function used to get the process-wide default binary client
+ *
+ * @return Binary Client reference used by default for binary requests
+ */
+BinaryClient& BinaryClient::getDefaultClient()
+{
+
+    // Setup the default client instance
+    static BinaryClient defaultClient;
+
+    // Return the default client instance
+    return defaultClient;
+}
+
+/**
+ * Static function used to determine whether the URL uses the binary transport
+ * NOTE: Both the "bq://" (TCP) and "unix://" (Unix domain socket) schemes
+ *       are sent over the binary transport
+ *
+ * @param url String representing the URL/URI to check
+ * @return Boolean indicating whether the URL uses the binary transport
+ */
+bool BinaryClient::isBinaryUrl(const std::string& url)
+{
+
+    // Return whether the URL uses one of the binary schemes
+    return ((url.compare(0, 5, "bq://") == 0) || (url.compare(0, 7, "unix://") == 0));
+}
+
+/**
+ * Function used to make a request on the provided (binary) endpoint
+ * re-using a persistent connection to the host where possible
+ *
+ * @param method Servable HTTP Method indicating the method to use
+ * @param url String representing the URL/URI for the request
+ * @param body Unordered String-String map representing the string values
+ * @param data Payload representing the typed (object) members
+ * @param timeout Integer representing the timeout (in milliseconds) to use
+ * @param transportFailed Boolean set to indicate no response was received
+ * @return Servable Response-Object representing the response information
+ */
+Servable::ResponseObj BinaryClient::request(Servable::HttpMethod method, const std::string& url,
+        const std::unordered_map<std::string, std::string>& body,
+        const Payload& data, int timeout, bool& transportFailed)
+{
+
+    // Split the URL into the destination and the path to request
+    transportFailed = true;
+    std::string destination;
+    std::string path;
+    if (!splitUrl(url, destination, path))
+        return Servable::ResponseObj{400, {{"Status", "Error"}, {"Message", "Invalid Binary URL"}}};
+
+    // Encode the request frame once for all attempts
+    auto frame = BinaryCodec::encodeRequest((int) method, path, body, data);
+
+    // Make the request, trying again on a new connection if a re-used one
+    // fails since the server may have closed it while it was idle
+    bool reused = true;
+    for (int attempt = 0; (attempt < 2) && reused; attempt++)
+    {
+
+        // Acquire a connection to the destination
+        int socket = acquire(destination, timeout, reused);
+        if (socket < 0)
+            break;
+
+        // Bound the time spent sending the request and waiting for the response
+        timeval requestTimeout{(timeout / 1000), ((timeout % 1000) * 1000)};
+        ::setsockopt(socket, SOL_SOCKET, SO_RCVTIMEO, &requestTimeout, sizeof(requestTimeout));
+        ::setsockopt(socket, SOL_SOCKET, SO_SNDTIMEO, &requestTimeout, sizeof(requestTimeout));
+
+        // Actually perform the request
+        std::string contents;
+        bool tooLarge = false;
+        if (BinaryCodec::sendFrame(socket, frame) && BinaryCodec::receiveFrame(socket,
+                contents, std::numeric_limits<long>::max(), tooLarge))
+        {
+
+            // Parse the results into our version of the response object
+            Servable::ResponseObj response;
+            response.code = 400;
+            bool parseResult = BinaryCodec::decodeResponse(contents.data(), contents.size(),
+                    response.code, response.body, response.data);
+            release(destination, socket, parseResult);
+
+            // Handle the case where the parsing was unsuccessful
+            transportFailed = false;
+            if (!parseResult)
+                response = Servable::ResponseObj{400,
+                        {{"Status", "Error"}, {"Message", "Invalid Binary Response"}}};
+            return response;
+        }
+
+        // Drop the connection since its state is unknown
+        release(destination, socket, false);
+    }
+
+    // Return an error if the request could not be completed
+    return Servable::ResponseObj{400, {{"Status", "Error"}, {"Message", "Binary Request Failed"}}};
+}
+
+/**
+ * Function used to get the number of idle connections for the given URL's host
+ *
+ * @param url String representing the URL to check
+ * @return Unsigned Long representing the number of idle connections
+ */
+unsigned long BinaryClient::getIdleConnectionCount(const std::string& url)
+{
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_lock);
+
+    // Return the number of idle connections for the destination
+    std::string destination;
+    std::string path;
+    splitUrl(url, destination, path);
+    auto idleConnections = _idleConnections.find(destination);
+    return (idleConnections == _idleConnections.end() ? 0 : idleConnections->second.size());
+}
+
+/**
+ * Internal function used to acquire a connection to the given destination
+ *
+ * @param destination String representing the host and port to connect to
+ * @param timeout Integer representing the timeout (in milliseconds) to use
+ * @param reused Boolean set to indicate an idle connection was re-used
+ * @return Integer representing the socket descriptor (negative on failure)
+ */
+int BinaryClient::acquire(const std::string& destination, int timeout, bool& reused)
+{
+
+    // Attempt to re-use the most recently used idle connection first
+    // NOTE: Do this in a separate context to leverage RAII for the mutex/lock
+    {
+
+        // Lock the thread for safe operation
+        std::unique_lock<std::mutex> lock(_lock);
+
+        // Drop any expired idle connections before picking one
+        auto expiration = (std::chrono::steady_clock::now()
+                - std::chrono::milliseconds(_idleTimeoutMs));
+        auto& idleConnections = _idleConnections[destination];
+        idleConnections.erase(
+            std::remove_if(idleConnections.begin(), idleConnections.end(),
+                [expiration](const IdleConnection& idleConnection)
+                {
+                    bool expired = (idleConnection.lastUsed < expiration);
+                    if (expired)
+                        ::close(idleConnection.socket);
+                    return expired;
+                }), idleConnections.end());
+        if (!idleConnections.empty())
+        {
+            int socket = idleConnections.back().socket;
+            idleConnections.pop_back();
+            reused = true;
+            return socket;
+        }
+    }
+
+    // Otherwise, open a new connection to the destination
+    reused = false;
+    return connectTo(destination, timeout);
+}
+
+/**
+ * Internal function used to release a connection acquired for a destination
+ *
+ * @param destination String representing the host and port connected to
+ * @param socket Integer representing the connection's socket descriptor
+ * @param reusable Boolean indicating whether the connection can be re-used
+ */
+void BinaryClient::release(const std::string& destination, int socket, bool reusable)
+{
+
+    // Keep the connection for re-use if possible
+    // NOTE: Do this in a separate context to leverage RAII for the mutex/lock
+    if (reusable)
+    {
+
+        // Lock the thread for safe operation
+        std::unique_lock<std::mutex> lock(_lock);
+
+        // Add the connection to the idle connections (if there is room)
+        auto& idleConnections = _idleConnections[destination];
+        if (idleConnections.size() < _maxIdleConnectionsPerHost)
+        {
+            idleConnections.push_back(IdleConnection{socket, std::chrono::steady_clock::now()});
+            return;
+        }
+    }
+
+    // Otherwise, close the connection outright
+    ::close(socket);
+}
+
+/**
+ * Internal static function used to open a new connection to the destination
+ *
+ * @param destination String representing the host and port to connect to
+ * @param timeout Integer representing the timeout (in milliseconds) to use
+ * @return Integer representing the socket descriptor (negative on failure)
+ */
+int BinaryClient::connectTo(const std::string& destination, int timeout)
+{
+
+    // Unix domain socket destinations are connected to directly
+    if (destination.compare(0, 5, "unix:") == 0)
+        return connectToUnix(destination.substr(5));
+
+    // Split the destination into its host and port
+    auto portStart = destination.rfind(':');
+    if ((portStart == std::string::npos) || (portStart == 0))
+        return -1;
+    auto host = destination.substr(0, portStart);
+    auto port = destination.substr(portStart + 1);
+
+    // Resolve the addresses for the destination
+    addrinfo hints{};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    addrinfo* addresses = nullptr;
+    if (::getaddrinfo(host.c_str(), port.c_str(), &hints, &addresses) != 0)
+        return -1;
+
+    // Attempt to connect to each of the addresses in turn
+    int connectedSocket = -1;
+    for (auto address = addresses; (address != nullptr) && (connectedSocket < 0); address = address->ai_next)
+    {
+
+        // Start connecting without blocking so the timeout can be enforced
+        int socket = ::socket(address->ai_family, address->ai_socktype, address->ai_protocol);
+        if (socket < 0)
+            continue;
+        int flags = ::fcntl(socket, F_GETFL, 0);
+        ::fcntl(socket, F_SETFL, (flags | O_NONBLOCK));
+        bool connected = (::connect(socket, address->ai_addr, address->ai_addrlen) == 0);
+
+        // Wait for the connection to complete (or time-out)
+        if (!connected && (errno == EINPROGRESS))
+        {
+            pollfd connectPoll{socket, POLLOUT, 0};
+            int socketError = 0;
+            socklen_t socketErrorSize = sizeof(socketError);
+            connected = ((::poll(&connectPoll, 1, timeout) > 0)
+                    && (::getsockopt(socket, SOL_SOCKET, SO_ERROR, &socketError, &socketErrorSize) == 0)
+                    && (socketError == 0));
+        }
+
+        // Either keep the (now blocking) connection or move onto the next address
+        if (connected)
+        {
+            int enabled = 1;
+            ::fcntl(socket, F_SETFL, flags);
+            ::setsockopt(socket, IPPROTO_TCP, TCP_NODELAY, &enabled, sizeof(enabled));
+            connectedSocket = socket;
+        }
+        else
+        {
+            ::close(socket);
+        }
+    }
+
+    // Return the connected socket (if any)
+    ::freeaddrinfo(addresses);
+    return connectedSocket;
+}
+
+/**
+ * Internal static function used to open a new connection to the
+ * Unix domain socket at the given path
+ *
+ * @param socketPath String representing the path of the socket file
+ * @return Integer representing the socket descriptor (negative on failure)
+ */
+int BinaryClient::connectToUnix(const std::string& socketPath)
+{
+
+    // Ensure the path fits within the socket address
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if (socketPath.empty() || (socketPath.size() >= sizeof(address.sun_path)))
+        return -1;
+    socketPath.copy(address.sun_path, socketPath.size());
+
+    // Connect to the socket (which completes immediately for local sockets)
+    int socket = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (socket < 0)
+        return -1;
+    if (::connect(socket, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0)
+    {
+        ::close(socket);
+        return -1;
+    }
+
+    // Return the connected socket
+    return socket;
+}
+
+/**
+ * Static function used to split a binary URL into its destination
+ * (host and port, or "unix:" and the socket path) and path portions
+ * NOTE: The socket path of a "unix://" URL is percent-encoded so that
+ *       it cannot be confused with the path (ie. "unix://%2Ftmp%2Fa.sock/route")
+ *
+ * @param url String representing the URL to split
+ * @param destination String to place the destination into
+ * @param path String to place the path into
+ * @return Boolean indicating whether the URL was valid
+ */
+bool BinaryClient::splitUrl(const std::string& url, std::string& destination, std::string& path)
+{
+
+    // Skip past the scheme and cut the URL at the start of the path
+    if (!isBinaryUrl(url))
+        return false;
+    bool isUnix = (url[0] == 'u');
+    auto schemeSize = (isUnix ? 7 : 5);
+    auto pathStart = url.find('/', schemeSize);
+    destination = url.substr(schemeSize,
+            (pathStart == std::string::npos ? std::string::npos : (pathStart - schemeSize)));
+    path = (pathStart == std::string::npos ? "/" : url.substr(pathStart));
+
+    // Decode the socket path for Unix domain socket destinations
+    if (isUnix)
+    {
+        std::string socketPath;
+        if (!percentDecode(destination, socketPath))
+            return false;
+        destination = "unix:" + socketPath;
+        return (socketPath.size() > 0);
+    }
+
+    // Return whether there was a destination
+    return !destination.empty();
+}
+
+/**
+ * Internal static function used to decode a percent-encoded URL component
+ *
+ * @param component String representing the encoded component
+ * @param decoded String to place the decoded component into
+ * @return Boolean indicating whether the component was validly encoded
+ */
+bool BinaryClient::percentDecode(const std::string& component, std::string& decoded)
+{
+
+    // Decode each of the escaped characters in turn
+    decoded.clear();
+    decoded.reserve(component.size());
+    for (unsigned long ii = 0; ii < component.size(); ii++)
+    {
+        if (component[ii] != '%')
+        {
+            decoded += component[ii];
+            continue;
+        }
+        if ((ii + 2) >= component.size() || !std::isxdigit((unsigned char) component[ii + 1])
+                || !std::isxdigit((unsigned char) component[ii + 2]))
+            return false;
+        decoded += (char) std::stoi(component.substr(ii + 1, 2), nullptr, 16);
+        ii += 2;
+    }
+
+    // Return that the component was decoded
+    return true;
+}
+
+/**
+ * Destructor used to cleanup the instance and close all idle connections
+ */
+BinaryClient::~BinaryClient()
+{
+
+    // Close all of the idle connections
+    for (const auto& idleConnections : _idleConnections)
+        for (const auto& idleConnection : idleConnections.second)
+            ::close(idleConnection.socket);
+}
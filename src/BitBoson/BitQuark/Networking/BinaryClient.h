@@ -0,0 +1,180 @@
+/* This file is part of bit-quark.
+ *
+ * Copyright (c) BitBoson
+ *
+ * bit-quark is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bit-quark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bit-quark.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#ifndef BITQUARK_BINARYCLIENT_H
+#define BITQUARK_BINARYCLIENT_H
+
+#include <mutex>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <BitBoson/BitQuark/Networking/Payload.h>
+#include <BitBoson/BitQuark/Networking/Servable.h>
+
+namespace BitBoson::BitQuark
+{
+
+    class BinaryClient
+    {
+
+        // Private structures
+        private:
+            struct IdleConnection
+            {
+                int socket;
+                std::chrono::steady_clock::time_point lastUsed;
+            };
+
+        // Private member variables
+        private:
+            std::mutex _lock;
+            long _idleTimeoutMs;
+            unsigned long _maxIdleConnectionsPerHost;
+            std::unordered_map<std::string, std::vector<IdleConnection>> _idleConnections;
+
+        // Public member functions
+        public:
+
+            /**
+             * Constructor used to setup the binary (length-prefixed frame) client
+             *
+             * @param maxIdleConnectionsPerHost Unsigned Long representing the maximum
+             *                                  number of idle connections kept per host
+             * @param idleTimeoutMs Long representing how long (in milliseconds)
+             *                      an idle connection is kept before eviction
+             */
+            explicit BinaryClient(unsigned long maxIdleConnectionsPerHost=8,
+                    long idleTimeoutMs=15000);
+
+            /**
+             * Static function used to get the process-wide default binary client
+             *
+             * @return Binary Client reference used by default for binary requests
+             */
+            static BinaryClient& getDefaultClient();
+
+            /**
+             * Static function used to determine whether the URL uses the binary transport
+             * NOTE: Both the "bq://" (TCP) and "unix://" (Unix domain socket) schemes
+             *       are sent over the binary transport
+             *
+             * @param url String representing the URL/URI to check
+             * @return Boolean indicating whether the URL uses the binary transport
+             */
+            static bool isBinaryUrl(const std::string& url);
+
+            /**
+             * Static function used to split a binary URL into its destination
+             * (host and port, or "unix:" and the socket path) and path portions
+             * NOTE: The socket path of a "unix://" URL is percent-encoded so that
+             *       it cannot be confused with the path (ie. "unix://%2Ftmp%2Fa.sock/route")
+             *
+             * @param url String representing the URL to split
+             * @param destination String to place the destination into
+             * @param path String to place the path into
+             * @return Boolean indicating whether the URL was valid
+             */
+            static bool splitUrl(const std::string& url, std::string& destination, std::string& path);
+
+            /**
+             * Function used to make a request on the provided (binary) endpoint
+             * re-using a persistent connection to the host where possible
+             *
+             * @param method Servable HTTP Method indicating the method to use
+             * @param url String representing the URL/URI for the request
+             * @param body Unordered String-String map representing the string values
+             * @param data Payload representing the typed (object) members
+             * @param timeout Integer representing the timeout (in milliseconds) to use
+             * @param transportFailed Boolean set to indicate no response was received
+             * @return Servable Response-Object representing the response information
+             */
+            Servable::ResponseObj request(Servable::HttpMethod method, const std::string& url,
+                    const std::unordered_map<std::string, std::string>& body,
+                    const Payload& data, int timeout, bool& transportFailed);
+
+            /**
+             * Function used to get the number of idle connections for the given URL's host
+             *
+             * @param url String representing the URL to check
+             * @return Unsigned Long representing the number of idle connections
+             */
+            unsigned long getIdleConnectionCount(const std::string& url);
+
+            /**
+             * Destructor used to cleanup the instance and close all idle connections
+             */
+            virtual ~BinaryClient();
+
+        // Private member functions
+        private:
+
+            /**
+             * Internal function used to acquire a connection to the given destination
+             *
+             * @param destination String representing the host and port to connect to
+             * @param timeout Integer representing the timeout (in milliseconds) to use
+             * @param reused Boolean set to indicate an idle connection was re-used
+             * @return Integer representing the socket descriptor (negative on failure)
+             */
+            int acquire(const std::string& destination, int timeout, bool& reused);
+
+            /**
+             * Internal function used to release a connection acquired for a destination
+             *
+             * @param destination String representing the host and port connected to
+             * @param socket Integer representing the connection's socket descriptor
+             * @param reusable Boolean indicating whether the connection can be re-used
+             */
+            void release(const std::string& destination, int socket, bool reusable);
+
+            /**
+             * Internal static function used to open a new connection to the destination
+             *
+             * @param destination String representing the host and port to connect to
+             * @param timeout Integer representing the timeout (in milliseconds) to use
+             * @return Integer representing the socket descriptor (negative on failure)
+             */
+            static int connectTo(const std::string& destination, int timeout);
+
+            /**
+             * Internal static function used to open a new connection to the
+             * Unix domain socket at the given path
+             *
+             * @param socketPath String representing the path of the socket file
+             * @return Integer representing the socket descriptor (negative on failure)
+             */
+            static int connectToUnix(const std::string& socketPath);
+
+            /**
+             * Internal static function used to decode a percent-encoded URL component
+             *
+             * @param component String representing the encoded component
+             * @param decoded String to place the decoded component into
+             * @return Boolean indicating whether the component was validly encoded
+             */
+            static bool percentDecode(const std::string& component, std::string& decoded);
+
+    };
+}
+
+#endif //BITQUARK_BINARYCLIENT_H
@@ -0,0 +1,572 @@
+/* This file is part of bit-quark.
+ *
+ * Copyright (c) BitBoson
+ *
+ * bit-quark is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bit-quark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bit-quark.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#include <cerrno>
+#include <cstring>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <BitBoson/BitQuark/Networking/Payload.h>
+#include <BitBoson/BitQuark/Networking/BinaryCodec.h>
+
+using namespace BitBoson;
+using namespace BitBoson::BitQuark;
+
+// Setup the constants used by the binary message format
+// NOTE: Every frame's contents start with the format version
+//       followed by the kind of message which is contained
+static const unsigned char BINARY_VERSION = 1;
+static const unsigned char BINARY_KIND_REQUEST = 1;
+static const unsigned char BINARY_KIND_RESPONSE = 2;
+static const int BINARY_MAX_DEPTH = 64;
+
+// Setup the type-tags used for the encoded payload values
+static const unsigned char PAYLOAD_TAG_NULL = 0;
+static const unsigned char PAYLOAD_TAG_FALSE = 1;
+static const unsigned char PAYLOAD_TAG_TRUE = 2;
+static const unsigned char PAYLOAD_TAG_INTEGER = 3;
+static const unsigned char PAYLOAD_TAG_DOUBLE = 4;
+static const unsigned char PAYLOAD_TAG_STRING = 5;
+static const unsigned char PAYLOAD_TAG_ARRAY = 6;
+static const unsigned char PAYLOAD_TAG_OBJECT = 7;
+
+/**
+ * Static function used to encode a request as a length-prefixed frame
+ *
+ * @param method Integer representing the (Servable) HTTP method
+ * @param path String representing the route path (and route-argument)
+ * @param values Unordered String-String map representing the string values
+ * @param data Payload representing the typed (object) members
+ * @return String representing the encoded frame (including its header)
+ */
+std::string BinaryCodec::encodeRequest(int method, const std::string& path,
+        const std::unordered_map<std::string, std::string>& values,
+        const Payload& data)
+{
+
+    // Reserve the frame header and write the request preamble
+    std::string buffer(FRAME_HEADER_SIZE, '\0');
+    buffer.push_back((char) BINARY_VERSION);
+    buffer.push_back((char) BINARY_KIND_REQUEST);
+    buffer.push_back((char) method);
+    writeString(buffer, path);
+
+    // Write the body and then the frame header
+    writeBody(buffer, values, data);
+    writeFrameHeader(buffer);
+
+    // Return the encoded frame
+    return buffer;
+}
+
+/**
+ * Static function used to decode a request from a frame's contents
+ *
+ * @param data Character Array representing the frame contents (no header)
+ * @param size Unsigned Long representing the size of the frame contents
+ * @param method Integer to decode the (Servable) HTTP method into
+ * @param path String to decode the route path into
+ * @param values Unordered String-String map to decode the string values into
+ * @param typedValues Payload to decode the typed (object) members into
+ * @return Boolean indicating whether the frame was a valid request
+ */
+bool BinaryCodec::decodeRequest(const char* data, unsigned long size, int& method,
+        std::string& path, std::unordered_map<std::string, std::string>& values,
+        Payload& typedValues)
+{
+
+    // Validate the request preamble
+    if ((size < 3) || ((unsigned char) data[0] != BINARY_VERSION)
+            || ((unsigned char) data[1] != BINARY_KIND_REQUEST))
+        return false;
+    method = (unsigned char) data[2];
+
+    // Decode the path followed by the body
+    unsigned long position = 3;
+    return (readString(data, size, position, path)
+            && readBody(data, size, position, values, typedValues));
+}
+
+/**
+ * Static function used to encode a response as a length-prefixed frame
+ *
+ * @param code Integer representing the status code
+ * @param values Unordered String-String map representing the string values
+ * @param data Payload representing the typed (object) members
+ * @return String representing the encoded frame (including its header)
+ */
+std::string BinaryCodec::encodeResponse(int code,
+        const std::unordered_map<std::string, std::string>& values,
+        const Payload& data)
+{
+
+    // Reserve the frame header and write the response preamble
+    std::string buffer(FRAME_HEADER_SIZE, '\0');
+    buffer.push_back((char) BINARY_VERSION);
+    buffer.push_back((char) BINARY_KIND_RESPONSE);
+    writeVarint(buffer, (unsigned long long) (code < 0 ? 0 : code));
+
+    // Write the body and then the frame header
+    writeBody(buffer, values, data);
+    writeFrameHeader(buffer);
+
+    // Return the encoded frame
+    return buffer;
+}
+
+/**
+ * Static function used to decode a response from a frame's contents
+ *
+ * @param data Character Array representing the frame contents (no header)
+ * @param size Unsigned Long representing the size of the frame contents
+ * @param code Integer to decode the status code into
+ * @param values Unordered String-String map to decode the string values into
+ * @param typedValues Payload to decode the typed (object) members into
+ * @return Boolean indicating whether the frame was a valid response
+ */
+bool BinaryCodec::decodeResponse(const char* data, unsigned long size, int& code,
+        std::unordered_map<std::string, std::string>& values,
+        Payload& typedValues)
+{
+
+    // Validate the response preamble
+    if ((size < 2) || ((unsigned char) data[0] != BINARY_VERSION)
+            || ((unsigned char) data[1] != BINARY_KIND_RESPONSE))
+        return false;
+
+    // Decode the status code followed by the body
+    unsigned long position = 2;
+    unsigned long long codeValue = 0;
+    if (!readVarint(data, size, position, codeValue) || (codeValue > 999))
+        return false;
+    code = (int) codeValue;
+    return readBody(data, size, position, values, typedValues);
+}
+
+/**
+ * Static function used to send an (already encoded) frame on the socket
+ *
+ * @param socket Integer representing the connected socket descriptor
+ * @param frame String representing the encoded frame to send
+ * @return Boolean indicating whether the entire frame was sent
+ */
+bool BinaryCodec::sendFrame(int socket, const std::string& frame)
+{
+
+    // Keep sending until the entire frame has been written
+    // NOTE: A closed peer must not raise a SIGPIPE for the process
+    unsigned long sent = 0;
+    while (sent < frame.size())
+    {
+        auto result = ::send(socket, (frame.data() + sent), (frame.size() - sent), MSG_NOSIGNAL);
+        if ((result < 0) && (errno == EINTR))
+            continue;
+        if (result <= 0)
+            return false;
+        sent += (unsigned long) result;
+    }
+
+    // Return that the frame was sent
+    return true;
+}
+
+/**
+ * Static function used to receive the next frame's contents from the socket
+ * NOTE: This blocks until the frame arrives, the socket's receive
+ *       timeout expires or the connection is closed
+ *
+ * @param socket Integer representing the connected socket descriptor
+ * @param contents String to receive the frame contents (no header) into
+ * @param maxFrameSize Long representing the maximum frame size accepted
+ * @param tooLarge Boolean set to indicate the frame was too large to accept
+ * @return Boolean indicating whether the frame was received
+ */
+bool BinaryCodec::receiveFrame(int socket, std::string& contents,
+        long maxFrameSize, bool& tooLarge)
+{
+
+    // Setup a function used to receive an exact number of bytes
+    auto receiveAll = [socket](char* buffer, unsigned long size) -> bool
+    {
+        unsigned long received = 0;
+        while (received < size)
+        {
+            auto result = ::recv(socket, (buffer + received), (size - received), 0);
+            if ((result < 0) && (errno == EINTR))
+                continue;
+            if (result <= 0)
+                return false;
+            received += (unsigned long) result;
+        }
+        return true;
+    };
+
+    // Receive the frame header (the big-endian size of the contents)
+    tooLarge = false;
+    unsigned char header[FRAME_HEADER_SIZE];
+    if (!receiveAll(reinterpret_cast<char*>(header), FRAME_HEADER_SIZE))
+        return false;
+    unsigned long frameSize = (((unsigned long) header[0] << 24) | ((unsigned long) header[1] << 16)
+            | ((unsigned long) header[2] << 8) | (unsigned long) header[3]);
+
+    // Refuse to receive frames which are too large
+    if ((long) frameSize > maxFrameSize)
+    {
+        tooLarge = true;
+        return false;
+    }
+
+    // Receive the frame's contents
+    contents.resize(frameSize);
+    return receiveAll(&contents[0], frameSize);
+}
+
+/**
+ * Internal static function used to encode the body (string values
+ * and typed members) onto the end of the given buffer
+ *
+ * @param buffer String representing the buffer to encode into
+ * @param values Unordered String-String map representing the string values
+ * @param data Payload representing the typed (object) members
+ */
+void BinaryCodec::writeBody(std::string& buffer,
+        const std::unordered_map<std::string, std::string>& values,
+        const Payload& data)
+{
+
+    // Write the string values as a count followed by the key-value pairs
+    writeVarint(buffer, values.size());
+    for (const auto& value : values)
+    {
+        writeString(buffer, value.first);
+        writeString(buffer, value.second);
+    }
+
+    // Write the typed members (as a single null tag if there are none)
+    writePayload(buffer, data);
+}
+
+/**
+ * Internal static function used to decode the body (string values
+ * and typed members) from the given position in the buffer
+ *
+ * @param data Character Array representing the buffer to decode from
+ * @param size Unsigned Long representing the size of the buffer
+ * @param position Unsigned Long representing the position to decode from
+ * @param values Unordered String-String map to decode the string values into
+ * @param typedValues Payload to decode the typed (object) members into
+ * @return Boolean indicating whether the body was valid and complete
+ */
+bool BinaryCodec::readBody(const char* data, unsigned long size, unsigned long& position,
+        std::unordered_map<std::string, std::string>& values,
+        Payload& typedValues)
+{
+
+    // Decode the string values
+    // NOTE: Every pair takes at least two bytes which bounds the count
+    unsigned long long count = 0;
+    if (!readVarint(data, size, position, count) || (count > ((size - position) / 2)))
+        return false;
+    values.reserve(values.size() + count);
+    for (unsigned long long index = 0; index < count; index++)
+    {
+        std::string key;
+        std::string value;
+        if (!readString(data, size, position, key) || !readString(data, size, position, value))
+            return false;
+        values[key] = std::move(value);
+    }
+
+    // Decode the typed members, ensuring nothing trails the body
+    return (readPayload(data, size, position, typedValues, 0) && (position == size));
+}
+
+/**
+ * Internal static function used to encode a (recursive) payload value
+ *
+ * @param buffer String representing the buffer to encode into
+ * @param value Payload representing the value to encode
+ */
+void BinaryCodec::writePayload(std::string& buffer, const Payload& value)
+{
+
+    // Write the value according to its type
+    switch (value.getType())
+    {
+        case Payload::Type::BOOL:
+            buffer.push_back((char) (value.getBool() ? PAYLOAD_TAG_TRUE : PAYLOAD_TAG_FALSE));
+            break;
+        case Payload::Type::INTEGER:
+        {
+
+            // Zig-zag the value so small negative values stay small
+            auto intValue = (long long) value.getInt();
+            buffer.push_back((char) PAYLOAD_TAG_INTEGER);
+            writeVarint(buffer, (((unsigned long long) intValue << 1)
+                    ^ (unsigned long long) (intValue >> 63)));
+            break;
+        }
+        case Payload::Type::DOUBLE:
+        {
+
+            // Write the raw (little-endian) bits of the value
+            double doubleValue = value.getDouble();
+            std::uint64_t bits = 0;
+            std::memcpy(&bits, &doubleValue, sizeof(bits));
+            buffer.push_back((char) PAYLOAD_TAG_DOUBLE);
+            for (int index = 0; index < 8; index++)
+                buffer.push_back((char) ((bits >> (index * 8)) & 0xFF));
+            break;
+        }
+        case Payload::Type::STRING:
+            buffer.push_back((char) PAYLOAD_TAG_STRING);
+            writeString(buffer, value.getString());
+            break;
+        case Payload::Type::ARRAY:
+            buffer.push_back((char) PAYLOAD_TAG_ARRAY);
+            writeVarint(buffer, value.size());
+            for (const auto& item : value.getItems())
+                writePayload(buffer, item);
+            break;
+        case Payload::Type::OBJECT:
+            buffer.push_back((char) PAYLOAD_TAG_OBJECT);
+            writeVarint(buffer, value.size());
+            for (const auto& member : value.getMembers())
+            {
+                writeString(buffer, member.first);
+                writePayload(buffer, member.second);
+            }
+            break;
+        default:
+            buffer.push_back((char) PAYLOAD_TAG_NULL);
+            break;
+    }
+}
+
+/**
+ * Internal static function used to decode a (recursive) payload value
+ *
+ * @param data Character Array representing the buffer to decode from
+ * @param size Unsigned Long representing the size of the buffer
+ * @param position Unsigned Long representing the position to decode from
+ * @param value Payload to decode the value into
+ * @param depth Integer representing the current nesting depth
+ * @return Boolean indicating whether the value was valid
+ */
+bool BinaryCodec::readPayload(const char* data, unsigned long size,
+        unsigned long& position, Payload& value, int depth)
+{
+
+    // Refuse to decode past the end of the buffer or too deeply nested values
+    if ((position >= size) || (depth > BINARY_MAX_DEPTH))
+        return false;
+
+    // Decode the value according to its type-tag
+    auto tag = (unsigned char) data[position++];
+    switch (tag)
+    {
+        case PAYLOAD_TAG_NULL:
+            value = Payload();
+            return true;
+        case PAYLOAD_TAG_FALSE:
+        case PAYLOAD_TAG_TRUE:
+            value = Payload(tag == PAYLOAD_TAG_TRUE);
+            return true;
+        case PAYLOAD_TAG_INTEGER:
+        {
+
+            // Undo the zig-zag encoding of the value
+            unsigned long long rawValue = 0;
+            if (!readVarint(data, size, position, rawValue))
+                return false;
+            value = Payload((long long) ((rawValue >> 1) ^ (~(rawValue & 1) + 1)));
+            return true;
+        }
+        case PAYLOAD_TAG_DOUBLE:
+        {
+
+            // Read the raw (little-endian) bits of the value
+            if ((size - position) < 8)
+                return false;
+            std::uint64_t bits = 0;
+            for (int index = 0; index < 8; index++)
+                bits |= ((std::uint64_t) (unsigned char) data[position + index] << (index * 8));
+            position += 8;
+            double doubleValue = 0.0;
+            std::memcpy(&doubleValue, &bits, sizeof(bits));
+            value = Payload(doubleValue);
+            return true;
+        }
+        case PAYLOAD_TAG_STRING:
+        {
+            std::string stringValue;
+            if (!readString(data, size, position, stringValue))
+                return false;
+            value = Payload(stringValue);
+            return true;
+        }
+        case PAYLOAD_TAG_ARRAY:
+        {
+
+            // Decode each of the array's items
+            // NOTE: Every item takes at least one byte which bounds the count
+            unsigned long long count = 0;
+            if (!readVarint(data, size, position, count) || (count > (size - position)))
+                return false;
+            value = Payload::array();
+            for (unsigned long long index = 0; index < count; index++)
+            {
+                Payload item;
+                if (!readPayload(data, size, position, item, (depth + 1)))
+                    return false;
+                value.push(std::move(item));
+            }
+            return true;
+        }
+        case PAYLOAD_TAG_OBJECT:
+        {
+
+            // Decode each of the object's members
+            // NOTE: Every member takes at least two bytes which bounds the count
+            unsigned long long count = 0;
+            if (!readVarint(data, size, position, count) || (count > ((size - position) / 2)))
+                return false;
+            value = Payload::object();
+            for (unsigned long long index = 0; index < count; index++)
+            {
+                std::string key;
+                Payload member;
+                if (!readString(data, size, position, key)
+                        || !readPayload(data, size, position, member, (depth + 1)))
+                    return false;
+                value.addMember(key, std::move(member));
+            }
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
+/**
+ * Internal static function used to encode an unsigned variable-length integer
+ *
+ * @param buffer String representing the buffer to encode into
+ * @param value Unsigned Long Long representing the value to encode
+ */
+void BinaryCodec::writeVarint(std::string& buffer, unsigned long long value)
+{
+
+    // Write seven bits at a time, flagging whether more bits follow
+    while (value >= 0x80)
+    {
+        buffer.push_back((char) ((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    buffer.push_back((char) value);
+}
+
+/**
+ * Internal static function used to decode an unsigned variable-length integer
+ *
+ * @param data Character Array representing the buffer to decode from
+ * @param size Unsigned Long representing the size of the buffer
+ * @param position Unsigned Long representing the position to decode from
+ * @param value Unsigned Long Long to decode the value into
+ * @return Boolean indicating whether the value was valid
+ */
+bool BinaryCodec::readVarint(const char* data, unsigned long size,
+        unsigned long& position, unsigned long long& value)
+{
+
+    // Read seven bits at a time until there are no more to follow
+    value = 0;
+    for (int shift = 0; shift < 64; shift += 7)
+    {
+        if (position >= size)
+            return false;
+        auto nextByte = (unsigned char) data[position++];
+        value |= ((unsigned long long) (nextByte & 0x7F) << shift);
+        if ((nextByte & 0x80) == 0)
+            return true;
+    }
+
+    // Return that the value was too long
+    return false;
+}
+
+/**
+ * Internal static function used to encode a length-prefixed string
+ *
+ * @param buffer String representing the buffer to encode into
+ * @param value String representing the value to encode
+ */
+void BinaryCodec::writeString(std::string& buffer, const std::string& value)
+{
+
+    // Write the length followed by the raw bytes
+    writeVarint(buffer, value.size());
+    buffer.append(value);
+}
+
+/**
+ * Internal static function used to decode a length-prefixed string
+ *
+ * @param data Character Array representing the buffer to decode from
+ * @param size Unsigned Long representing the size of the buffer
+ * @param position Unsigned Long representing the position to decode from
+ * @param value String to decode the value into
+ * @return Boolean indicating whether the value was valid
+ */
+bool BinaryCodec::readString(const char* data, unsigned long size,
+        unsigned long& position, std::string& value)
+{
+
+    // Read the length and ensure the raw bytes are all present
+    unsigned long long length = 0;
+    if (!readVarint(data, size, position, length) || (length > (size - position)))
+        return false;
+
+    // Read the raw bytes
+    value.assign((data + position), length);
+    position += length;
+    return true;
+}
+
+/**
+ * Internal static function used to write the frame header (the size
+ * of the frame's contents) at the start of the given buffer
+ *
+ * @param buffer String representing the frame (with a reserved header)
+ */
+void BinaryCodec::writeFrameHeader(std::string& buffer)
+{
+
+    // Write the (big-endian) size of the contents following the header
+    auto frameSize = (unsigned long) (buffer.size() - FRAME_HEADER_SIZE);
+    buffer[0] = (char) ((frameSize >> 24) & 0xFF);
+    buffer[1] = (char) ((frameSize >> 16) & 0xFF);
+    buffer[2] = (char) ((frameSize >> 8) & 0xFF);
+    buffer[3] = (char) (frameSize & 0xFF);
+}
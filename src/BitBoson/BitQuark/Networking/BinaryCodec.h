@@ -0,0 +1,221 @@
+/* This file is part of bit-quark.
+ *
+ * Copyright (c) BitBoson
+ *
+ * bit-quark is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bit-quark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bit-quark.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#ifndef BITQUARK_BINARYCODEC_H
+#define BITQUARK_BINARYCODEC_H
+
+#include <string>
+#include <unordered_map>
+#include <BitBoson/BitQuark/Networking/Payload.h>
+
+namespace BitBoson::BitQuark
+{
+
+    class BinaryCodec
+    {
+
+        // Public constants
+        public:
+            static const unsigned long FRAME_HEADER_SIZE = 4;
+
+        // Public member functions
+        public:
+
+            /**
+             * Static function used to encode a request as a length-prefixed frame
+             *
+             * @param method Integer representing the (Servable) HTTP method
+             * @param path String representing the route path (and route-argument)
+             * @param values Unordered String-String map representing the string values
+             * @param data Payload representing the typed (object) members
+             * @return String representing the encoded frame (including its header)
+             */
+            static std::string encodeRequest(int method, const std::string& path,
+                    const std::unordered_map<std::string, std::string>& values,
+                    const Payload& data);
+
+            /**
+             * Static function used to decode a request from a frame's contents
+             *
+             * @param data Character Array representing the frame contents (no header)
+             * @param size Unsigned Long representing the size of the frame contents
+             * @param method Integer to decode the (Servable) HTTP method into
+             * @param path String to decode the route path into
+             * @param values Unordered String-String map to decode the string values into
+             * @param typedValues Payload to decode the typed (object) members into
+             * @return Boolean indicating whether the frame was a valid request
+             */
+            static bool decodeRequest(const char* data, unsigned long size, int& method,
+                    std::string& path, std::unordered_map<std::string, std::string>& values,
+                    Payload& typedValues);
+
+            /**
+             * Static function used to encode a response as a length-prefixed frame
+             *
+             * @param code Integer representing the status code
+             * @param values Unordered String-String map representing the string values
+             * @param data Payload representing the typed (object) members
+             * @return String representing the encoded frame (including its header)
+             */
+            static std::string encodeResponse(int code,
+                    const std::unordered_map<std::string, std::string>& values,
+                    const Payload& data);
+
+            /**
+             * Static function used to decode a response from a frame's contents
+             *
+             * @param data Character Array representing the frame contents (no header)
+             * @param size Unsigned Long representing the size of the frame contents
+             * @param code Integer to decode the status code into
+             * @param values Unordered String-String map to decode the string values into
+             * @param typedValues Payload to decode the typed (object) members into
+             * @return Boolean indicating whether the frame was a valid response
+             */
+            static bool decodeResponse(const char* data, unsigned long size, int& code,
+                    std::unordered_map<std::string, std::string>& values,
+                    Payload& typedValues);
+
+            /**
+             * Static function used to send an (already encoded) frame on the socket
+             *
+             * @param socket Integer representing the connected socket descriptor
+             * @param frame String representing the encoded frame to send
+             * @return Boolean indicating whether the entire frame was sent
+             */
+            static bool sendFrame(int socket, const std::string& frame);
+
+            /**
+             * Static function used to receive the next frame's contents from the socket
+             * NOTE: This blocks until the frame arrives, the socket's receive
+             *       timeout expires or the connection is closed
+             *
+             * @param socket Integer representing the connected socket descriptor
+             * @param contents String to receive the frame contents (no header) into
+             * @param maxFrameSize Long representing the maximum frame size accepted
+             * @param tooLarge Boolean set to indicate the frame was too large to accept
+             * @return Boolean indicating whether the frame was received
+             */
+            static bool receiveFrame(int socket, std::string& contents,
+                    long maxFrameSize, bool& tooLarge);
+
+        // Private member functions
+        private:
+
+            /**
+             * Internal static function used to encode the body (string values
+             * and typed members) onto the end of the given buffer
+             *
+             * @param buffer String representing the buffer to encode into
+             * @param values Unordered String-String map representing the string values
+             * @param data Payload representing the typed (object) members
+             */
+            static void writeBody(std::string& buffer,
+                    const std::unordered_map<std::string, std::string>& values,
+                    const Payload& data);
+
+            /**
+             * Internal static function used to decode the body (string values
+             * and typed members) from the given position in the buffer
+             *
+             * @param data Character Array representing the buffer to decode from
+             * @param size Unsigned Long representing the size of the buffer
+             * @param position Unsigned Long representing the position to decode from
+             * @param values Unordered String-String map to decode the string values into
+             * @param typedValues Payload to decode the typed (object) members into
+             * @return Boolean indicating whether the body was valid and complete
+             */
+            static bool readBody(const char* data, unsigned long size, unsigned long& position,
+                    std::unordered_map<std::string, std::string>& values,
+                    Payload& typedValues);
+
+            /**
+             * Internal static function used to encode a (recursive) payload value
+             *
+             * @param buffer String representing the buffer to encode into
+             * @param value Payload representing the value to encode
+             */
+            static void writePayload(std::string& buffer, const Payload& value);
+
+            /**
+             * Internal static function used to decode a (recursive) payload value
+             *
+             * @param data Character Array representing the buffer to decode from
+             * @param size Unsigned Long representing the size of the buffer
+             * @param position Unsigned Long representing the position to decode from
+             * @param value Payload to decode the value into
+             * @param depth Integer representing the current nesting depth
+             * @return Boolean indicating whether the value was valid
+             */
+            static bool readPayload(const char* data, unsigned long size,
+                    unsigned long& position, Payload& value, int depth);
+
+            /**
+             * Internal static function used to encode an unsigned variable-length integer
+             *
+             * @param buffer String representing the buffer to encode into
+             * @param value Unsigned Long Long representing the value to encode
+             */
+            static void writeVarint(std::string& buffer, unsigned long long value);
+
+            /**
+             * Internal static function used to decode an unsigned variable-length integer
+             *
+             * @param data Character Array representing the buffer to decode from
+             * @param size Unsigned Long representing the size of the buffer
+             * @param position Unsigned Long representing the position to decode from
+             * @param value Unsigned Long Long to decode the value into
+             * @return Boolean indicating whether the value was valid
+             */
+            static bool readVarint(const char* data, unsigned long size,
+                    unsigned long& position, unsigned long long& value);
+
+            /**
+             * Internal static function used to encode a length-prefixed string
+             *
+             * @param buffer String representing the buffer to encode into
+             * @param value String representing the value to encode
+             */
+            static void writeString(std::string& buffer, const std::string& value);
+
+            /**
+             * Internal static function used to decode a length-prefixed string
+             *
+             * @param data Character Array representing the buffer to decode from
+             * @param size Unsigned Long representing the size of the buffer
+             * @param position Unsigned Long representing the position to decode from
+             * @param value String to decode the value into
+             * @return Boolean indicating whether the value was valid
+             */
+            static bool readString(const char* data, unsigned long size,
+                    unsigned long& position, std::string& value);
+
+            /**
+             * Internal static function used to write the frame header (the size
+             * of the frame's contents) at the start of the given buffer
+             *
+             * @param buffer String representing the frame (with a reserved header)
+             */
+            static void writeFrameHeader(std::string& buffer);
+    };
+}
+
+#endif //BITQUARK_BINARYCODEC_H
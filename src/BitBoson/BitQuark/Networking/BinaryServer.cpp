@@ -0,0 +1,344 @@
+/* This file is part of bit-quark.
+ *
+ * Copyright (c) BitBoson
+ *
+ * bit-quark is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bit-quark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bit-quark.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <functional>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/time.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <BitBoson/BitQuark/Networking/Payload.h>
+#include <BitBoson/BitQuark/Networking/BinaryCodec.h>
+#include <BitBoson/BitQuark/Networking/BinaryServer.h>
+
+using namespace BitBoson;
+using namespace BitBoson::BitQuark;
+
+/**
+ * Constructor used to setup the binary (length-prefixed frame) server
+ *
+ * @param frameHandler Function used to handle the contents of each
+ *                     request frame, returning the response frame
+ * @param idleTimeout Long representing the time (in milliseconds) an
+ *                    idle connection is kept open waiting for a frame
+ */
+BinaryServer::BinaryServer(std::function<std::string(const char*, unsigned long)> frameHandler,
+        long idleTimeout)
+{
+
+    // Setup the member variables
+    _listenSocket = -1;
+    _idleTimeout = idleTimeout;
+    _isRunning = false;
+    _maxFrameSize = (100 * 1024);
+    _frameHandler = std::move(frameHandler);
+}
+
+/**
+ * Function used to start listening for connections on the given port
+ * NOTE: This is a non-blocking operation
+ *
+ * @param port Integer representing the port to listen on
+ * @return Boolean indicating whether the server is listening
+ */
+bool BinaryServer::start(int port)
+{
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_lock);
+
+    // Only try to start the server if it hasn't been started already
+    if (_isRunning)
+        return true;
+
+    // Setup the listening socket (allowing the port to be re-used right away)
+    int listenSocket = ::socket(AF_INET, SOCK_STREAM, 0);
+    if (listenSocket < 0)
+        return false;
+    int enabled = 1;
+    ::setsockopt(listenSocket, SOL_SOCKET, SO_REUSEADDR, &enabled, sizeof(enabled));
+
+    // Bind the socket to the port on all interfaces
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_ANY);
+    address.sin_port = htons((unsigned short) port);
+    if (::bind(listenSocket, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0)
+    {
+        ::close(listenSocket);
+        return false;
+    }
+
+    // Start accepting connections on the socket
+    return startAcceptingUnlocked(listenSocket);
+}
+
+/**
+ * Function used to start listening for connections on the given
+ * Unix domain socket (replacing any stale socket file at the path)
+ * NOTE: This is a non-blocking operation
+ *
+ * @param socketPath String representing the path of the socket file
+ * @return Boolean indicating whether the server is listening
+ */
+bool BinaryServer::startUnix(const std::string& socketPath)
+{
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_lock);
+
+    // Only try to start the server if it hasn't been started already
+    if (_isRunning)
+        return true;
+
+    // Ensure the path fits within the socket address
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if (socketPath.empty() || (socketPath.size() >= sizeof(address.sun_path)))
+        return false;
+    socketPath.copy(address.sun_path, socketPath.size());
+
+    // Setup the listening socket, replacing any stale socket file
+    int listenSocket = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listenSocket < 0)
+        return false;
+    ::unlink(socketPath.c_str());
+    if (::bind(listenSocket, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0)
+    {
+        ::close(listenSocket);
+        return false;
+    }
+
+    // Start accepting connections on the socket (removing the file once stopped)
+    _socketPath = socketPath;
+    return startAcceptingUnlocked(listenSocket);
+}
+
+/**
+ * Function used to stop the server, closing all of its connections
+ * and waiting for all in-flight frames to be handled
+ */
+void BinaryServer::stop()
+{
+
+    // Stop accepting new connections and wait for the accept thread
+    // NOTE: This is done without the lock as the accept thread uses it
+    _isRunning = false;
+    if (_acceptThread != nullptr)
+        _acceptThread->join();
+    _acceptThread = nullptr;
+
+    // Close all of the connections, waiting for their threads to complete
+    // NOTE: Shutting-down the sockets wakes-up any blocked receives
+    std::vector<Connection> connections;
+    {
+        std::unique_lock<std::mutex> lock(_lock);
+        if (_listenSocket >= 0)
+            ::close(_listenSocket);
+        _listenSocket = -1;
+        if (!_socketPath.empty())
+            ::unlink(_socketPath.c_str());
+        _socketPath.clear();
+        connections.swap(_connections);
+        for (const auto& connection : connections)
+            ::shutdown(connection.socket, SHUT_RDWR);
+    }
+    for (const auto& connection : connections)
+    {
+        connection.thread->join();
+        ::close(connection.socket);
+    }
+}
+
+/**
+ * Function used to set the maximum size of a request frame's contents
+ *
+ * @param maxFrameSize Long representing the maximum frame size in bytes
+ */
+void BinaryServer::setMaxFrameSize(long maxFrameSize)
+{
+
+    // Setup the maximum frame size (ensuring it is not negative)
+    _maxFrameSize = (maxFrameSize < 0 ? 0 : maxFrameSize);
+}
+
+/**
+ * Function used to get the number of currently open connections
+ *
+ * @return Unsigned Long representing the number of open connections
+ */
+unsigned long BinaryServer::getConnectionCount()
+{
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_lock);
+
+    // Cleanup finished connections and return the number remaining
+    reapConnectionsUnlocked();
+    return _connections.size();
+}
+
+/**
+ * Internal function used to start accepting connections on the
+ * (already bound) listening socket
+ * NOTE: The server's lock must be held when calling this function
+ *
+ * @param listenSocket Integer representing the bound socket descriptor
+ * @return Boolean indicating whether the server is listening
+ */
+bool BinaryServer::startAcceptingUnlocked(int listenSocket)
+{
+
+    // Start listening on the socket
+    if (::listen(listenSocket, SOMAXCONN) != 0)
+    {
+        ::close(listenSocket);
+        return false;
+    }
+
+    // Actually start accepting connections using the background thread
+    _listenSocket = listenSocket;
+    _isRunning = true;
+    _acceptThread = std::make_shared<std::thread>(
+        [this]()
+        {
+            acceptConnections();
+        });
+
+    // Return that the server is listening
+    return true;
+}
+
+/**
+ * Internal function used to accept connections while the server is running
+ */
+void BinaryServer::acceptConnections()
+{
+
+    // Keep accepting connections until the server is stopped
+    // NOTE: The poll timeout bounds how long stopping the server takes
+    pollfd listenPoll{_listenSocket, POLLIN, 0};
+    while (_isRunning)
+    {
+
+        // Wait (for a short time) for the next connection
+        if ((::poll(&listenPoll, 1, 100) <= 0) || ((listenPoll.revents & POLLIN) == 0))
+            continue;
+        int socket = ::accept(_listenSocket, nullptr, nullptr);
+        if (socket < 0)
+            continue;
+
+        // Disable the send delay since frames are always sent whole and
+        // close the connection if it is idle for too long
+        // NOTE: The send delay option does not apply to Unix domain sockets
+        int enabled = 1;
+        ::setsockopt(socket, IPPROTO_TCP, TCP_NODELAY, &enabled, sizeof(enabled));
+        timeval idleTimeout{(_idleTimeout / 1000), ((_idleTimeout % 1000) * 1000)};
+        ::setsockopt(socket, SOL_SOCKET, SO_RCVTIMEO, &idleTimeout, sizeof(idleTimeout));
+
+        // Handle the connection on its own thread (cleaning-up any finished ones)
+        std::unique_lock<std::mutex> lock(_lock);
+        reapConnectionsUnlocked();
+        auto finished = std::make_shared<std::atomic<bool>>(false);
+        auto thread = std::make_shared<std::thread>(
+            [this, socket, finished]()
+            {
+                handleConnection(socket);
+                *finished = true;
+            });
+        _connections.push_back(Connection{socket, thread, finished});
+    }
+}
+
+/**
+ * Internal function used to handle the frames sent on a connection
+ * until it is closed (by either end) or becomes idle
+ *
+ * @param socket Integer representing the connection's socket descriptor
+ */
+void BinaryServer::handleConnection(int socket)
+{
+
+    // Keep handling frames until the connection is closed
+    std::string contents;
+    bool tooLarge = false;
+    while (_isRunning && BinaryCodec::receiveFrame(socket, contents, _maxFrameSize, tooLarge))
+    {
+
+        // Handle the frame and send back its response
+        if (!BinaryCodec::sendFrame(socket, _frameHandler(contents.data(), contents.size())))
+            break;
+    }
+
+    // Let the caller know that the frame was too large
+    // NOTE: The rest of the frame is never read so the
+    //       connection cannot be re-used
+    if (tooLarge)
+        BinaryCodec::sendFrame(socket, BinaryCodec::encodeResponse(413,
+                {{"Status", "Error"}, {"Message", "Request Body Too Long"}}, Payload()));
+
+    // Stop any further use of the connection
+    // NOTE: The socket itself is closed once the connection is cleaned-up
+    ::shutdown(socket, SHUT_RDWR);
+}
+
+/**
+ * Internal function used to cleanup connections which have finished
+ * NOTE: The server's lock must be held when calling this function
+ */
+void BinaryServer::reapConnectionsUnlocked()
+{
+
+    // Join and close all of the finished connections
+    for (auto iter = _connections.begin(); iter != _connections.end();)
+    {
+        if (*iter->finished)
+        {
+            iter->thread->join();
+            ::close(iter->socket);
+            iter = _connections.erase(iter);
+        }
+        else
+        {
+            iter++;
+        }
+    }
+}
+
+/**
+ * Destructor used to cleanup the instance
+ */
+BinaryServer::~BinaryServer()
+{
+
+    // Stop the server (if it is still running)
+    stop();
+}
@@ -0,0 +1,153 @@
+/* This file is part of bit-quark.
+ *
+ * Copyright (c) BitBoson
+ *
+ * bit-quark is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bit-quark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bit-quark.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#ifndef BITQUARK_BINARYSERVER_H
+#define BITQUARK_BINARYSERVER_H
+
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <functional>
+
+namespace BitBoson::BitQuark
+{
+
+    class BinaryServer
+    {
+
+        // Private structures
+        private:
+            struct Connection
+            {
+                int socket;
+                std::shared_ptr<std::thread> thread;
+                std::shared_ptr<std::atomic<bool>> finished;
+            };
+
+        // Private member variables
+        private:
+            int _listenSocket;
+            long _idleTimeout;
+            std::string _socketPath;
+            std::mutex _lock;
+            std::atomic<bool> _isRunning;
+            std::atomic<long> _maxFrameSize;
+            std::vector<Connection> _connections;
+            std::shared_ptr<std::thread> _acceptThread;
+            std::function<std::string(const char*, unsigned long)> _frameHandler;
+
+        // Public member functions
+        public:
+
+            /**
+             * Constructor used to setup the binary (length-prefixed frame) server
+             *
+             * @param frameHandler Function used to handle the contents of each
+             *                     request frame, returning the response frame
+             * @param idleTimeout Long representing the time (in milliseconds) an
+             *                    idle connection is kept open waiting for a frame
+             */
+            explicit BinaryServer(std::function<std::string(const char*, unsigned long)> frameHandler,
+                    long idleTimeout=30000);
+
+            /**
+             * Function used to start listening for connections on the given port
+             * NOTE: This is a non-blocking operation
+             *
+             * @param port Integer representing the port to listen on
+             * @return Boolean indicating whether the server is listening
+             */
+            bool start(int port);
+
+            /**
+             * Function used to start listening for connections on the given
+             * Unix domain socket (replacing any stale socket file at the path)
+             * NOTE: This is a non-blocking operation
+             *
+             * @param socketPath String representing the path of the socket file
+             * @return Boolean indicating whether the server is listening
+             */
+            bool startUnix(const std::string& socketPath);
+
+            /**
+             * Function used to stop the server, closing all of its connections
+             * and waiting for all in-flight frames to be handled
+             */
+            void stop();
+
+            /**
+             * Function used to set the maximum size of a request frame's contents
+             *
+             * @param maxFrameSize Long representing the maximum frame size in bytes
+             */
+            void setMaxFrameSize(long maxFrameSize);
+
+            /**
+             * Function used to get the number of currently open connections
+             *
+             * @return Unsigned Long representing the number of open connections
+             */
+            unsigned long getConnectionCount();
+
+            /**
+             * Destructor used to cleanup the instance
+             */
+            virtual ~BinaryServer();
+
+        // Private member functions
+        private:
+
+            /**
+             * Internal function used to start accepting connections on the
+             * (already bound) listening socket
+             * NOTE: The server's lock must be held when calling this function
+             *
+             * @param listenSocket Integer representing the bound socket descriptor
+             * @return Boolean indicating whether the server is listening
+             */
+            bool startAcceptingUnlocked(int listenSocket);
+
+            /**
+             * Internal function used to accept connections while the server is running
+             */
+            void acceptConnections();
+
+            /**
+             * Internal function used to handle the frames sent on a connection
+             * until it is closed (by either end) or becomes idle
+             *
+             * @param socket Integer representing the connection's socket descriptor
+             */
+            void handleConnection(int socket);
+
+            /**
+             * Internal function used to cleanup connections which have finished
+             * NOTE: The server's lock must be held when calling this function
+             */
+            void reapConnectionsUnlocked();
+    };
+}
+
+#endif //BITQUARK_BINARYSERVER_H
@@ -0,0 +1,234 @@
+/* This file is part of bit-quark.
+ *
+ * Copyright (c) BitBoson
+ *
+ * bit-quark is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bit-quark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bit-quark.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+
+#include <string>
+#include <cctype>
+#include <cstdlib>
+#include <algorithm>
+#include <zlib.h>
+#include <BitBoson/BitQuark/Networking/Compression.h>
+
+using namespace BitBoson::BitQuark;
+
+/**
+ * Static function used to choose the encoding to respond with based
+ * on the request's Accept-Encoding header (preferring gzip)
+ * NOTE: Encodings given a quality of zero are never chosen, and
+ *       the "*" wildcard only accepts encodings not named explicitly
+ *
+ * @param acceptEncoding String representing the Accept-Encoding header
+ * @return Encoding representing the chosen encoding (identity if none)
+ */
+Compression::Encoding Compression::negotiate(const std::string& acceptEncoding)
+{
+
+    // Go through each of the (comma-separated) accepted encodings
+    bool acceptsGzip = false;
+    bool acceptsDeflate = false;
+    bool acceptsWildcard = false;
+    bool isGzipNamed = false;
+    bool isDeflateNamed = false;
+    unsigned long tokenStart = 0;
+    while (tokenStart < acceptEncoding.size())
+    {
+
+        // Cut out the next encoding and its (optional) quality value
+        auto tokenEnd = acceptEncoding.find(',', tokenStart);
+        if (tokenEnd == std::string::npos)
+            tokenEnd = acceptEncoding.size();
+        auto token = acceptEncoding.substr(tokenStart, (tokenEnd - tokenStart));
+        tokenStart = (tokenEnd + 1);
+        double quality = 1.0;
+        auto paramStart = token.find(';');
+        if (paramStart != std::string::npos)
+        {
+            auto qualityStart = token.find("q=", paramStart);
+            if (qualityStart != std::string::npos)
+                quality = std::strtod(token.c_str() + qualityStart + 2, nullptr);
+            token = token.substr(0, paramStart);
+        }
+
+        // Normalize the encoding's name (trimmed and lower-case)
+        std::string name;
+        for (auto character : token)
+            if (!std::isspace((unsigned char) character))
+                name += (char) std::tolower((unsigned char) character);
+
+        // Keep track of the encodings we support which are named (even if
+        // refused, so the wildcard cannot accept them) and which are accepted
+        if ((name == "gzip") || (name == "x-gzip"))
+        {
+            isGzipNamed = true;
+            acceptsGzip = (acceptsGzip || (quality > 0));
+        }
+        else if (name == "deflate")
+        {
+            isDeflateNamed = true;
+            acceptsDeflate = (acceptsDeflate || (quality > 0));
+        }
+        else if (name == "*")
+            acceptsWildcard = (acceptsWildcard || (quality > 0));
+    }
+
+    // Accept the encodings which were not named through the wildcard
+    if (acceptsWildcard)
+    {
+        acceptsGzip = (acceptsGzip || !isGzipNamed);
+        acceptsDeflate = (acceptsDeflate || !isDeflateNamed);
+    }
+
+    // Return the preferred (accepted) encoding
+    return (acceptsGzip ? GZIP : (acceptsDeflate ? DEFLATE : IDENTITY));
+}
+
+/**
+ * Static function used to get the encoding for the given
+ * Content-Encoding header value
+ *
+ * @param name String representing the Content-Encoding header value
+ * @return Encoding representing the encoding (identity if unknown)
+ */
+Compression::Encoding Compression::getEncoding(const std::string& name)
+{
+
+    // Normalize the encoding's name (trimmed and lower-case)
+    std::string normalizedName;
+    for (auto character : name)
+        if (!std::isspace((unsigned char) character))
+            normalizedName += (char) std::tolower((unsigned char) character);
+
+    // Return the matching encoding
+    if ((normalizedName == "gzip") || (normalizedName == "x-gzip"))
+        return GZIP;
+    if (normalizedName == "deflate")
+        return DEFLATE;
+    return IDENTITY;
+}
+
+/**
+ * Static function used to get the Content-Encoding header value
+ * for the given encoding
+ *
+ * @param encoding Encoding representing the encoding to name
+ * @return String representing the name (empty for identity)
+ */
+std::string Compression::getName(Encoding encoding)
+{
+
+    // Return the name of the encoding
+    switch (encoding)
+    {
+        case GZIP:
+            return "gzip";
+        case DEFLATE:
+            return "deflate";
+        default:
+            return "";
+    }
+}
+
+/**
+ * Static function used to compress the given data using the encoding
+ *
+ * @param data String representing the data to compress
+ * @param encoding Encoding representing the encoding to use
+ * @param compressed String to place the compressed data into
+ * @return Boolean indicating whether the data was compressed
+ */
+bool Compression::compress(const std::string& data, Encoding encoding, std::string& compressed)
+{
+
+    // Only the gzip and deflate (zlib) encodings can be compressed
+    if (encoding == IDENTITY)
+        return false;
+
+    // Setup the compression stream (adding 16 to the window bits for the gzip wrapper)
+    z_stream stream{};
+    int windowBits = (encoding == GZIP ? (MAX_WBITS + 16) : MAX_WBITS);
+    if (deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, windowBits, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+        return false;
+
+    // Compress the data in a single pass into a buffer sized for the worst case
+    compressed.resize(deflateBound(&stream, data.size()));
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+    stream.avail_in = (uInt) data.size();
+    stream.next_out = reinterpret_cast<Bytef*>(&compressed[0]);
+    stream.avail_out = (uInt) compressed.size();
+    int result = deflate(&stream, Z_FINISH);
+    compressed.resize(stream.total_out);
+    deflateEnd(&stream);
+
+    // Return whether the data was compressed
+    return (result == Z_STREAM_END);
+}
+
+/**
+ * Static function used to decompress the given data using the encoding
+ * NOTE: Decompression stops (and fails) once the output exceeds the
+ *       maximum size to guard against decompression bombs
+ *
+ * @param data Character Array representing the data to decompress
+ * @param size Unsigned Long representing the size of the data
+ * @param encoding Encoding representing the encoding used
+ * @param decompressed String to place the decompressed data into
+ * @param maxSize Unsigned Long representing the maximum decompressed size
+ * @return Boolean indicating whether the data was decompressed
+ */
+bool Compression::decompress(const char* data, unsigned long size, Encoding encoding,
+        std::string& decompressed, unsigned long maxSize)
+{
+
+    // Only the gzip and deflate (zlib) encodings can be decompressed
+    if (encoding == IDENTITY)
+        return false;
+
+    // Setup the decompression stream (adding 32 to the window bits to
+    // detect either the gzip or zlib wrapper automatically)
+    z_stream stream{};
+    if (inflateInit2(&stream, (MAX_WBITS + 32)) != Z_OK)
+        return false;
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data));
+    stream.avail_in = (uInt) size;
+
+    // Decompress the data, growing the output as needed (up to the maximum size)
+    int result = Z_OK;
+    decompressed.clear();
+    unsigned long chunkSize = ((size * 4) < 1024 ? 1024 : (size * 4));
+    while (result == Z_OK)
+    {
+        auto writeStart = decompressed.size();
+        if (writeStart >= maxSize)
+            break;
+        decompressed.resize(std::min((writeStart + chunkSize), (maxSize + 1)));
+        stream.next_out = reinterpret_cast<Bytef*>(&decompressed[writeStart]);
+        stream.avail_out = (uInt) (decompressed.size() - writeStart);
+        result = inflate(&stream, Z_NO_FLUSH);
+        decompressed.resize(stream.total_out);
+        if ((result == Z_BUF_ERROR) && (stream.avail_in > 0))
+            result = Z_OK;
+    }
+    inflateEnd(&stream);
+
+    // Return whether the (entire) data was decompressed within the limit
+    return ((result == Z_STREAM_END) && (decompressed.size() <= maxSize));
+}
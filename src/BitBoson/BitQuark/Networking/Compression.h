@@ -0,0 +1,102 @@
+/* This file is part of bit-quark.
+ *
+ * Copyright (c) BitBoson
+ *
+ * bit-quark is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bit-quark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bit-quark.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+
+#ifndef BITQUARK_COMPRESSION_H
+#define BITQUARK_COMPRESSION_H
+
+#include <string>
+
+namespace BitBoson::BitQuark
+{
+
+    class Compression
+    {
+
+        // Public enumerations
+        public:
+            enum Encoding
+            {
+                IDENTITY,
+                GZIP,
+                DEFLATE
+            };
+
+        // Public member functions
+        public:
+
+            /**
+             * Static function used to choose the encoding to respond with based
+             * on the request's Accept-Encoding header (preferring gzip)
+             * NOTE: Encodings given a quality of zero are never chosen
+             *
+             * @param acceptEncoding String representing the Accept-Encoding header
+             * @return Encoding representing the chosen encoding (identity if none)
+             */
+            static Encoding negotiate(const std::string& acceptEncoding);
+
+            /**
+             * Static function used to get the encoding for the given
+             * Content-Encoding header value
+             *
+             * @param name String representing the Content-Encoding header value
+             * @return Encoding representing the encoding (identity if unknown)
+             */
+            static Encoding getEncoding(const std::string& name);
+
+            /**
+             * Static function used to get the Content-Encoding header value
+             * for the given encoding
+             *
+             * @param encoding Encoding representing the encoding to name
+             * @return String representing the name (empty for identity)
+             */
+            static std::string getName(Encoding encoding);
+
+            /**
+             * Static function used to compress the given data using the encoding
+             *
+             * @param data String representing the data to compress
+             * @param encoding Encoding representing the encoding to use
+             * @param compressed String to place the compressed data into
+             * @return Boolean indicating whether the data was compressed
+             */
+            static bool compress(const std::string& data, Encoding encoding, std::string& compressed);
+
+            /**
+             * Static function used to decompress the given data using the encoding
+             * NOTE: Decompression stops (and fails) once the output exceeds the
+             *       maximum size to guard against decompression bombs
+             *
+             * @param data Character Array representing the data to decompress
+             * @param size Unsigned Long representing the size of the data
+             * @param encoding Encoding representing the encoding used
+             * @param decompressed String to place the decompressed data into
+             * @param maxSize Unsigned Long representing the maximum decompressed size
+             * @return Boolean indicating whether the data was decompressed
+             */
+            static bool decompress(const char* data, unsigned long size, Encoding encoding,
+                    std::string& decompressed, unsigned long maxSize=(64 * 1024 * 1024));
+    };
+}
+
+#endif //BITQUARK_COMPRESSION_H
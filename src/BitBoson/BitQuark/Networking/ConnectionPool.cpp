@@ -0,0 +1,268 @@
+/* This file is part of bit-quark.
+ *
+ * Copyright (c) BitBoson
+ *
+ * bit-quark is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bit-quark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bit-quark.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#include <mutex>
+#include <chrono>
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <cpr/cpr.h>
+#include <BitBoson/BitQuark/Networking/ConnectionPool.h>
+
+using namespace BitBoson;
+using namespace BitBoson::BitQuark;
+
+/**
+ * Constructor used to setup the connection pool instance
+ *
+ * @param maxConnectionsPerHost Unsigned Long representing the maximum
+ *                              number of pooled connections per host
+ * @param idleTimeoutMs Long representing how long (in milliseconds)
+ *                      an idle connection is kept before eviction
+ * @param acquireTimeoutMs Long representing the longest time (in
+ *                         milliseconds) to wait for a pooled session
+ *                         before falling-back to an un-pooled one
+ */
+ConnectionPool::ConnectionPool(unsigned long maxConnectionsPerHost, long idleTimeoutMs,
+        long acquireTimeoutMs)
+{
+
+    // Setup the member variables (ensuring at least one connection per host)
+    _idleTimeoutMs = idleTimeoutMs;
+    _acquireTimeoutMs = (acquireTimeoutMs < 0 ? 0 : acquireTimeoutMs);
+    _maxConnectionsPerHost = (maxConnectionsPerHost <= 0 ? 1 : maxConnectionsPerHost);
+}
+
+/**
+ * Static function used to get the process-wide default connection pool
+ *
+ * @return Connection Pool reference used by default for requests
+ */
+ConnectionPool& ConnectionPool::getDefaultPool()
+{
+
+    // Setup the default pool instance
+    static ConnectionPool defaultPool;
+
+    // Return the default pool instance
+    return defaultPool;
+}
+
+/**
+ * Function used to acquire a (keep-alive) session for the given URL
+ * NOTE: If the per-host limit has been reached this will wait for
+ *       a session to be released and fall-back to an un-pooled
+ *       session if none is released within the timeout (which
+ *       is capped at the pool's acquire timeout so that waiting
+ *       does not consume the request's own timeout)
+ *
+ * @param url String representing the URL the session is for
+ * @param timeout Integer representing the time (in milliseconds)
+ *                to wait for a pooled session to be available
+ * @return CPR Session (pointer) to use for the request
+ */
+std::shared_ptr<cpr::Session> ConnectionPool::acquire(const std::string& url, int timeout)
+{
+
+    // Create a return session
+    std::shared_ptr<cpr::Session> retSession;
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_lock);
+
+    // Drop any sessions which have been idle for too long
+    evictIdleSessionsUnlocked();
+
+    // Wait until there is either an idle session to re-use or there
+    // is room to open another connection to the destination
+    // NOTE: The wait is bounded by the (short) acquire timeout since the
+    //       un-pooled fall-back works just as well, only without keep-alive
+    auto destination = getDestination(url);
+    auto waitTimeout = std::min((long) (timeout < 0 ? 0 : timeout), _acquireTimeoutMs);
+    bool hasCapacity = _releasedCondition.wait_for(lock, std::chrono::milliseconds(waitTimeout),
+        [this, &destination]()
+        {
+            return (!_idleSessions[destination].empty()
+                    || ((_activeSessions[destination] + _idleSessions[destination].size())
+                            < _maxConnectionsPerHost));
+        });
+
+    // Re-use the most recently used idle session if there is one
+    // since it is the most likely to still have a live connection
+    auto& idleSessions = _idleSessions[destination];
+    if (hasCapacity && !idleSessions.empty())
+    {
+        retSession = idleSessions.back().session;
+        idleSessions.pop_back();
+    }
+
+    // Otherwise, create a new session for the destination
+    else
+    {
+        retSession = std::make_shared<cpr::Session>();
+    }
+
+    // Keep track of the session as being in-use (only if it is pooled)
+    if (hasCapacity)
+    {
+        _activeSessions[destination]++;
+        _leasedSessions.insert(retSession.get());
+    }
+
+    // Return the return session
+    return retSession;
+}
+
+/**
+ * Function used to get the longest time a caller waits for a pooled session
+ *
+ * @return Long representing the acquire timeout (in milliseconds)
+ */
+long ConnectionPool::getAcquireTimeout() const
+{
+
+    // Return the acquire timeout
+    return _acquireTimeoutMs;
+}
+
+/**
+ * Function used to release a session acquired from the pool
+ *
+ * @param url String representing the URL the session was acquired for
+ * @param session CPR Session (pointer) being released
+ * @param reusable Boolean indicating whether the session's connection
+ *                 is still healthy and can be kept alive for re-use
+ */
+void ConnectionPool::release(const std::string& url, std::shared_ptr<cpr::Session> session,
+        bool reusable)
+{
+
+    // Only continue if the session is valid
+    if (session != nullptr)
+    {
+
+        // Lock the thread for safe operation
+        std::unique_lock<std::mutex> lock(_lock);
+
+        // Only pooled sessions count towards the active sessions, so only
+        // those are considered for re-use (un-pooled sessions are dropped)
+        if (_leasedSessions.erase(session.get()) > 0)
+        {
+
+            // The session is no longer in-use
+            auto destination = getDestination(url);
+            _activeSessions[destination]--;
+
+            // Keep the session (and its connection) alive if it is healthy
+            if (reusable)
+                _idleSessions[destination].push_back(
+                        IdleSession{session, std::chrono::steady_clock::now()});
+        }
+    }
+
+    // Wake-up anyone waiting for a session to the destination
+    _releasedCondition.notify_all();
+}
+
+/**
+ * Function used to close all idle sessions which have expired
+ */
+void ConnectionPool::evictIdleSessions()
+{
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_lock);
+
+    // Actually evict the expired sessions
+    evictIdleSessionsUnlocked();
+}
+
+/**
+ * Function used to get the number of idle sessions for the given URL's host
+ *
+ * @param url String representing the URL (or destination) to check
+ * @return Unsigned Long representing the number of idle sessions
+ */
+unsigned long ConnectionPool::getIdleSessionCount(const std::string& url)
+{
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_lock);
+
+    // Return the number of idle sessions for the destination
+    return _idleSessions[getDestination(url)].size();
+}
+
+/**
+ * Function used to get the number of in-use sessions for the given URL's host
+ *
+ * @param url String representing the URL (or destination) to check
+ * @return Unsigned Long representing the number of in-use sessions
+ */
+unsigned long ConnectionPool::getActiveSessionCount(const std::string& url)
+{
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_lock);
+
+    // Return the number of in-use sessions for the destination
+    return _activeSessions[getDestination(url)];
+}
+
+/**
+ * Static function used to get the destination (scheme, host and port)
+ * portion of the given URL which sessions are pooled by
+ *
+ * @param url String representing the URL to get the destination of
+ * @return String representing the destination of the URL
+ */
+std::string ConnectionPool::getDestination(const std::string& url)
+{
+
+    // Skip past the scheme (if there is one) and cut the URL
+    // at the start of the path (if there is one)
+    auto schemeEnd = url.find("://");
+    auto hostStart = (schemeEnd == std::string::npos ? 0 : schemeEnd + 3);
+    return url.substr(0, url.find('/', hostStart));
+}
+
+/**
+ * Internal function used to close all idle sessions which have expired
+ * NOTE: The pool's lock must be held when calling this function
+ */
+void ConnectionPool::evictIdleSessionsUnlocked()
+{
+
+    // Determine the oldest last-used time a session may have
+    auto expiration = (std::chrono::steady_clock::now()
+            - std::chrono::milliseconds(_idleTimeoutMs));
+
+    // Loop through every destination and drop expired sessions
+    // NOTE: Destroying the session closes its underlying connection
+    for (auto& idleSessions : _idleSessions)
+        idleSessions.second.erase(
+            std::remove_if(idleSessions.second.begin(), idleSessions.second.end(),
+                [expiration](const IdleSession& idleSession)
+                {
+                    return (idleSession.lastUsed < expiration);
+                }), idleSessions.second.end());
+}
@@ -0,0 +1,164 @@
+/* This file is part of bit-quark.
+ *
+ * Copyright (c) BitBoson
+ *
+ * bit-quark is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bit-quark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bit-quark.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#ifndef BITQUARK_CONNECTIONPOOL_H
+#define BITQUARK_CONNECTIONPOOL_H
+
+#include <mutex>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cpr/cpr.h>
+#include <unordered_map>
+#include <unordered_set>
+#include <condition_variable>
+
+namespace BitBoson::BitQuark
+{
+
+    class ConnectionPool
+    {
+
+        // Private structures
+        private:
+            struct IdleSession
+            {
+                std::shared_ptr<cpr::Session> session;
+                std::chrono::steady_clock::time_point lastUsed;
+            };
+
+        // Private member variables
+        private:
+            std::mutex _lock;
+            long _idleTimeoutMs;
+            long _acquireTimeoutMs;
+            unsigned long _maxConnectionsPerHost;
+            std::condition_variable _releasedCondition;
+            std::unordered_set<cpr::Session*> _leasedSessions;
+            std::unordered_map<std::string, unsigned long> _activeSessions;
+            std::unordered_map<std::string, std::vector<IdleSession>> _idleSessions;
+
+        // Public member functions
+        public:
+
+            /**
+             * Constructor used to setup the connection pool instance
+             *
+             * @param maxConnectionsPerHost Unsigned Long representing the maximum
+             *                              number of pooled connections per host
+             * @param idleTimeoutMs Long representing how long (in milliseconds)
+             *                      an idle connection is kept before eviction
+             * @param acquireTimeoutMs Long representing the longest time (in
+             *                         milliseconds) to wait for a pooled session
+             *                         before falling-back to an un-pooled one
+             */
+            explicit ConnectionPool(unsigned long maxConnectionsPerHost=8,
+                    long idleTimeoutMs=15000, long acquireTimeoutMs=250);
+
+            /**
+             * Static function used to get the process-wide default connection pool
+             *
+             * @return Connection Pool reference used by default for requests
+             */
+            static ConnectionPool& getDefaultPool();
+
+            /**
+             * Function used to acquire a (keep-alive) session for the given URL
+             * NOTE: If the per-host limit has been reached this will wait for
+             *       a session to be released and fall-back to an un-pooled
+             *       session if none is released within the timeout (which
+             *       is capped at the pool's acquire timeout so that waiting
+             *       does not consume the request's own timeout)
+             *
+             * @param url String representing the URL the session is for
+             * @param timeout Integer representing the time (in milliseconds)
+             *                to wait for a pooled session to be available
+             * @return CPR Session (pointer) to use for the request
+             */
+            std::shared_ptr<cpr::Session> acquire(const std::string& url, int timeout=10000);
+
+            /**
+             * Function used to get the longest time a caller waits for a pooled session
+             *
+             * @return Long representing the acquire timeout (in milliseconds)
+             */
+            long getAcquireTimeout() const;
+
+            /**
+             * Function used to release a session acquired from the pool
+             *
+             * @param url String representing the URL the session was acquired for
+             * @param session CPR Session (pointer) being released
+             * @param reusable Boolean indicating whether the session's connection
+             *                 is still healthy and can be kept alive for re-use
+             */
+            void release(const std::string& url, std::shared_ptr<cpr::Session> session,
+                    bool reusable=true);
+
+            /**
+             * Function used to close all idle sessions which have expired
+             */
+            void evictIdleSessions();
+
+            /**
+             * Function used to get the number of idle sessions for the given URL's host
+             *
+             * @param url String representing the URL (or destination) to check
+             * @return Unsigned Long representing the number of idle sessions
+             */
+            unsigned long getIdleSessionCount(const std::string& url);
+
+            /**
+             * Function used to get the number of in-use sessions for the given URL's host
+             *
+             * @param url String representing the URL (or destination) to check
+             * @return Unsigned Long representing the number of in-use sessions
+             */
+            unsigned long getActiveSessionCount(const std::string& url);
+
+            /**
+             * Static function used to get the destination (scheme, host and port)
+             * portion of the given URL which sessions are pooled by
+             *
+             * @param url String representing the URL to get the destination of
+             * @return String representing the destination of the URL
+             */
+            static std::string getDestination(const std::string& url);
+
+            /**
+             * Destructor used to cleanup the instance
+             */
+            virtual ~ConnectionPool() = default;
+
+        // Private member functions
+        private:
+
+            /**
+             * Internal function used to close all idle sessions which have expired
+             * NOTE: The pool's lock must be held when calling this function
+             */
+            void evictIdleSessionsUnlocked();
+    };
+}
+
+#endif //BITQUARK_CONNECTIONPOOL_H
@@ -0,0 +1,408 @@
+/* This file is part of bit-quark.
+ *
+ * Copyright (c) BitBoson
+ *
+ * bit-quark is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bit-quark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bit-quark.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <rapidjson/reader.h>
+#include <rapidjson/writer.h>
+#include <rapidjson/memorystream.h>
+#include <BitBoson/BitQuark/Networking/JsonCodec.h>
+
+using namespace BitBoson;
+using namespace BitBoson::BitQuark;
+
+namespace
+{
+
+    /**
+     * Output stream used to have the JSON writer write directly
+     * into a (pre-sized) standard string without an extra copy
+     */
+    struct StringOutputStream
+    {
+        typedef char Ch;
+        std::string& output;
+        explicit StringOutputStream(std::string& outputString) : output(outputString) {}
+        void Put(Ch c) { output.push_back(c); }
+        void Flush() {}
+    };
+
+    /**
+     * SAX handler used to decode the top-level string members
+     * of a JSON object directly into a string-string map
+     */
+    struct FlatObjectHandler : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, FlatObjectHandler>
+    {
+        int depth = 0;
+        bool isObject = false;
+        std::string currentKey;
+        std::unordered_map<std::string, std::string>& values;
+        explicit FlatObjectHandler(std::unordered_map<std::string, std::string>& valuesMap) : values(valuesMap) {}
+
+        // Any non-string values are skipped (but must still be valid)
+        bool Default() { return (depth > 0); }
+
+        // Top-level string members are kept in the map
+        bool String(const Ch* str, rapidjson::SizeType length, bool copy)
+        {
+            if (depth == 1)
+                values[currentKey].assign(str, length);
+            return (depth > 0);
+        }
+
+        // Keep track of the key for the next top-level value
+        bool Key(const Ch* str, rapidjson::SizeType length, bool copy)
+        {
+            if (depth == 1)
+                currentKey.assign(str, length);
+            return true;
+        }
+
+        // Keep track of the nesting so nested members are skipped
+        bool StartObject()
+        {
+            if (depth == 0)
+                isObject = true;
+            depth++;
+            return true;
+        }
+        bool EndObject(rapidjson::SizeType memberCount) { depth--; return true; }
+        bool StartArray() { depth++; return (depth > 1); }
+        bool EndArray(rapidjson::SizeType elementCount) { depth--; return true; }
+    };
+
+    /**
+     * SAX handler used to decode JSON directly into a payload tree,
+     * optionally splitting the top-level string members into a map
+     */
+    struct PayloadHandler : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, PayloadHandler>
+    {
+        Payload& result;
+        std::string currentKey;
+        bool hasResult = false;
+        std::vector<Payload*> containers;
+        std::unordered_map<std::string, std::string>* values;
+        PayloadHandler(Payload& resultPayload, std::unordered_map<std::string, std::string>* valuesMap)
+                : result(resultPayload), values(valuesMap) {}
+
+        // Add the value to the current container (or as the result itself)
+        Payload* addValue(Payload value)
+        {
+            if (containers.empty())
+            {
+                if (hasResult || ((values != nullptr) && (value.getType() != Payload::Type::OBJECT)))
+                    return nullptr;
+                hasResult = true;
+                result = std::move(value);
+                return &result;
+            }
+            if (containers.back()->getType() == Payload::Type::ARRAY)
+                return &containers.back()->push(std::move(value));
+            if ((values != nullptr) && (containers.size() == 1) && (value.getType() == Payload::Type::STRING))
+            {
+                (*values)[currentKey] = value.getString();
+                return &result;
+            }
+            return &containers.back()->addMember(currentKey, std::move(value));
+        }
+
+        // Handle all of the scalar values
+        bool Null() { return (addValue(Payload()) != nullptr); }
+        bool Bool(bool b) { return (addValue(Payload(b)) != nullptr); }
+        bool Int(int i) { return (addValue(Payload(i)) != nullptr); }
+        bool Uint(unsigned u) { return (addValue(Payload((long long) u)) != nullptr); }
+        bool Int64(int64_t i) { return (addValue(Payload((long long) i)) != nullptr); }
+        bool Uint64(uint64_t u) { return (addValue(Payload((long long) u)) != nullptr); }
+        bool Double(double d) { return (addValue(Payload(d)) != nullptr); }
+        bool String(const Ch* str, rapidjson::SizeType length, bool copy)
+        {
+            return (addValue(Payload(std::string(str, length))) != nullptr);
+        }
+
+        // Keep track of the key for the next member
+        bool Key(const Ch* str, rapidjson::SizeType length, bool copy)
+        {
+            currentKey.assign(str, length);
+            return true;
+        }
+
+        // Handle the containers by keeping track of where to add values
+        bool StartObject()
+        {
+            auto container = addValue(Payload::object());
+            if (container != nullptr)
+                containers.push_back(container);
+            return (container != nullptr);
+        }
+        bool StartArray()
+        {
+            auto container = addValue(Payload::array());
+            if (container != nullptr)
+                containers.push_back(container);
+            return (container != nullptr);
+        }
+        bool EndObject(rapidjson::SizeType memberCount) { containers.pop_back(); return true; }
+        bool EndArray(rapidjson::SizeType elementCount) { containers.pop_back(); return true; }
+    };
+
+    /**
+     * Function used to write the given payload using the JSON writer
+     *
+     * @param writer JSON Writer to write the payload with
+     * @param payload Payload representing the value to write
+     */
+    void writePayload(rapidjson::Writer<StringOutputStream>& writer, const Payload& payload)
+    {
+        switch (payload.getType())
+        {
+            case Payload::Type::BOOL:
+                writer.Bool(payload.getBool());
+                break;
+            case Payload::Type::INTEGER:
+                writer.Int64(payload.getInt());
+                break;
+            case Payload::Type::DOUBLE:
+                writer.Double(payload.getDouble());
+                break;
+            case Payload::Type::STRING:
+            {
+                auto value = payload.getString();
+                writer.String(value.c_str(), (rapidjson::SizeType) value.size());
+                break;
+            }
+            case Payload::Type::ARRAY:
+                writer.StartArray();
+                for (const auto& item : payload.getItems())
+                    writePayload(writer, item);
+                writer.EndArray();
+                break;
+            case Payload::Type::OBJECT:
+                writer.StartObject();
+                for (const auto& member : payload.getMembers())
+                {
+                    writer.Key(member.first.c_str(), (rapidjson::SizeType) member.first.size());
+                    writePayload(writer, member.second);
+                }
+                writer.EndObject();
+                break;
+            default:
+                writer.Null();
+                break;
+        }
+    }
+}
+
+/**
+ * Static function used to encode the given string-string map
+ * as a (properly escaped) flat JSON object string
+ * NOTE: The output buffer is sized up-front from the map's contents
+ *
+ * @param values Unordered String-String map representing the values
+ * @return String representing the JSON object (empty if there are no values)
+ */
+std::string JsonCodec::encode(const std::unordered_map<std::string, std::string>& values)
+{
+
+    // Create a return string
+    std::string retString;
+
+    // Only continue if there are values to encode
+    // NOTE: An empty map is sent as an empty body (not "{}")
+    if (!values.empty())
+    {
+
+        // Size the output for the (un-escaped) contents plus the quotes,
+        // colons and commas so that it will usually never re-allocate
+        unsigned long estimatedSize = 2;
+        for (const auto& value : values)
+            estimatedSize += (value.first.size() + value.second.size() + 6);
+        retString.reserve(estimatedSize);
+
+        // Write each of the members into the JSON object
+        StringOutputStream outputStream(retString);
+        rapidjson::Writer<StringOutputStream> writer(outputStream);
+        writer.StartObject();
+        for (const auto& value : values)
+        {
+            writer.Key(value.first.c_str(), (rapidjson::SizeType) value.first.size());
+            writer.String(value.second.c_str(), (rapidjson::SizeType) value.second.size());
+        }
+        writer.EndObject();
+    }
+
+    // Return the return string
+    return retString;
+}
+
+/**
+ * Static function used to decode the given JSON object string into
+ * a string-string map in a single (SAX) pass over the data
+ * NOTE: Only top-level string members are kept; any others are skipped
+ *
+ * @param data Character Array representing the JSON data to decode
+ * @param size Unsigned Long representing the size of the JSON data
+ * @param values Unordered String-String map to decode the values into
+ * @return Boolean indicating whether the data was a valid JSON object
+ */
+bool JsonCodec::decode(const char* data, unsigned long size,
+        std::unordered_map<std::string, std::string>& values)
+{
+
+    // Parse the data straight into the values map
+    rapidjson::Reader reader;
+    rapidjson::MemoryStream inputStream(data, size);
+    FlatObjectHandler handler(values);
+    rapidjson::ParseResult parseResult = reader.Parse(inputStream, handler);
+
+    // Return whether the data was a valid JSON object
+    return (parseResult && handler.isObject);
+}
+
+/**
+ * Static function used to decode the given JSON object string into
+ * a string-string map in a single (SAX) pass over the data
+ * NOTE: Only top-level string members are kept; any others are skipped
+ *
+ * @param data String representing the JSON data to decode
+ * @param values Unordered String-String map to decode the values into
+ * @return Boolean indicating whether the data was a valid JSON object
+ */
+bool JsonCodec::decode(const std::string& data,
+        std::unordered_map<std::string, std::string>& values)
+{
+
+    // Decode the string's underlying data
+    return decode(data.c_str(), data.size(), values);
+}
+
+/**
+ * Static function used to encode the given string-string map along
+ * with the (object) payload's typed members as a single JSON object
+ *
+ * @param values Unordered String-String map representing the string values
+ * @param data Payload representing the typed (object) members to add
+ * @return String representing the JSON object (empty if there are no values)
+ */
+std::string JsonCodec::encode(const std::unordered_map<std::string, std::string>& values,
+        const Payload& data)
+{
+
+    // Without any typed members this is just the string values
+    if ((data.getType() != Payload::Type::OBJECT) || (data.size() == 0))
+        return encode(values);
+
+    // Size the output for the (un-escaped) string contents plus
+    // a rough allowance for each of the typed members
+    std::string retString;
+    unsigned long estimatedSize = 2;
+    for (const auto& value : values)
+        estimatedSize += (value.first.size() + value.second.size() + 6);
+    for (const auto& member : data.getMembers())
+        estimatedSize += (member.first.size() + 32);
+    retString.reserve(estimatedSize);
+
+    // Write each of the string and typed members into the JSON object
+    StringOutputStream outputStream(retString);
+    rapidjson::Writer<StringOutputStream> writer(outputStream);
+    writer.StartObject();
+    for (const auto& value : values)
+    {
+        writer.Key(value.first.c_str(), (rapidjson::SizeType) value.first.size());
+        writer.String(value.second.c_str(), (rapidjson::SizeType) value.second.size());
+    }
+    for (const auto& member : data.getMembers())
+    {
+        writer.Key(member.first.c_str(), (rapidjson::SizeType) member.first.size());
+        writePayload(writer, member.second);
+    }
+    writer.EndObject();
+
+    // Return the return string
+    return retString;
+}
+
+/**
+ * Static function used to encode the given payload as a JSON string
+ *
+ * @param payload Payload representing the value to encode
+ * @return String representing the JSON value
+ */
+std::string JsonCodec::encodePayload(const Payload& payload)
+{
+
+    // Write the payload into the return string
+    std::string retString;
+    StringOutputStream outputStream(retString);
+    rapidjson::Writer<StringOutputStream> writer(outputStream);
+    writePayload(writer, payload);
+
+    // Return the return string
+    return retString;
+}
+
+/**
+ * Static function used to decode the given JSON object string in a single
+ * (SAX) pass, splitting top-level string members into the string-string
+ * map and all other (typed) members into the payload object
+ *
+ * @param data Character Array representing the JSON data to decode
+ * @param size Unsigned Long representing the size of the JSON data
+ * @param values Unordered String-String map to decode the string values into
+ * @param typedValues Payload to decode the other (typed) members into
+ * @return Boolean indicating whether the data was a valid JSON object
+ */
+bool JsonCodec::decode(const char* data, unsigned long size,
+        std::unordered_map<std::string, std::string>& values, Payload& typedValues)
+{
+
+    // Parse the data straight into the values map and payload
+    rapidjson::Reader reader;
+    rapidjson::MemoryStream inputStream(data, size);
+    PayloadHandler handler(typedValues, &values);
+    rapidjson::ParseResult parseResult = reader.Parse(inputStream, handler);
+
+    // Return whether the data was a valid JSON object
+    return (parseResult && handler.hasResult);
+}
+
+/**
+ * Static function used to decode the given JSON string into a payload
+ * in a single (SAX) pass over the data
+ *
+ * @param data Character Array representing the JSON data to decode
+ * @param size Unsigned Long representing the size of the JSON data
+ * @param payload Payload to decode the value into
+ * @return Boolean indicating whether the data was valid JSON
+ */
+bool JsonCodec::decode(const char* data, unsigned long size, Payload& payload)
+{
+
+    // Parse the data straight into the payload
+    rapidjson::Reader reader;
+    rapidjson::MemoryStream inputStream(data, size);
+    PayloadHandler handler(payload, nullptr);
+    rapidjson::ParseResult parseResult = reader.Parse(inputStream, handler);
+
+    // Return whether the data was valid JSON
+    return (parseResult && handler.hasResult);
+}
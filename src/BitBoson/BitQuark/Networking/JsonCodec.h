@@ -0,0 +1,120 @@
+/* This file is part of bit-quark.
+ *
+ * Copyright (c) BitBoson
+ *
+ * bit-quark is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bit-quark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bit-quark.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#ifndef BITQUARK_JSONCODEC_H
+#define BITQUARK_JSONCODEC_H
+
+#include <string>
+#include <unordered_map>
+#include <BitBoson/BitQuark/Networking/Payload.h>
+
+namespace BitBoson::BitQuark
+{
+
+    class JsonCodec
+    {
+
+        // Public member functions
+        public:
+
+            /**
+             * Static function used to encode the given string-string map
+             * as a (properly escaped) flat JSON object string
+             * NOTE: The output buffer is sized up-front from the map's contents
+             *
+             * @param values Unordered String-String map representing the values
+             * @return String representing the JSON object (empty if there are no values)
+             */
+            static std::string encode(const std::unordered_map<std::string, std::string>& values);
+
+            /**
+             * Static function used to decode the given JSON object string into
+             * a string-string map in a single (SAX) pass over the data
+             * NOTE: Only top-level string members are kept; any others are skipped
+             *
+             * @param data Character Array representing the JSON data to decode
+             * @param size Unsigned Long representing the size of the JSON data
+             * @param values Unordered String-String map to decode the values into
+             * @return Boolean indicating whether the data was a valid JSON object
+             */
+            static bool decode(const char* data, unsigned long size,
+                    std::unordered_map<std::string, std::string>& values);
+
+            /**
+             * Static function used to decode the given JSON object string into
+             * a string-string map in a single (SAX) pass over the data
+             * NOTE: Only top-level string members are kept; any others are skipped
+             *
+             * @param data String representing the JSON data to decode
+             * @param values Unordered String-String map to decode the values into
+             * @return Boolean indicating whether the data was a valid JSON object
+             */
+            static bool decode(const std::string& data,
+                    std::unordered_map<std::string, std::string>& values);
+
+            /**
+             * Static function used to encode the given string-string map along
+             * with the (object) payload's typed members as a single JSON object
+             *
+             * @param values Unordered String-String map representing the string values
+             * @param data Payload representing the typed (object) members to add
+             * @return String representing the JSON object (empty if there are no values)
+             */
+            static std::string encode(const std::unordered_map<std::string, std::string>& values,
+                    const Payload& data);
+
+            /**
+             * Static function used to encode the given payload as a JSON string
+             *
+             * @param payload Payload representing the value to encode
+             * @return String representing the JSON value
+             */
+            static std::string encodePayload(const Payload& payload);
+
+            /**
+             * Static function used to decode the given JSON object string in a single
+             * (SAX) pass, splitting top-level string members into the string-string
+             * map and all other (typed) members into the payload object
+             *
+             * @param data Character Array representing the JSON data to decode
+             * @param size Unsigned Long representing the size of the JSON data
+             * @param values Unordered String-String map to decode the string values into
+             * @param typedValues Payload to decode the other (typed) members into
+             * @return Boolean indicating whether the data was a valid JSON object
+             */
+            static bool decode(const char* data, unsigned long size,
+                    std::unordered_map<std::string, std::string>& values, Payload& typedValues);
+
+            /**
+             * Static function used to decode the given JSON string into a payload
+             * in a single (SAX) pass over the data
+             *
+             * @param data Character Array representing the JSON data to decode
+             * @param size Unsigned Long representing the size of the JSON data
+             * @param payload Payload to decode the value into
+             * @return Boolean indicating whether the data was valid JSON
+             */
+            static bool decode(const char* data, unsigned long size, Payload& payload);
+    };
+}
+
+#endif //BITQUARK_JSONCODEC_H
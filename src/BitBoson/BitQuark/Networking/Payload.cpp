@@ -0,0 +1,437 @@
+/* This file is part of bit-quark.
+ *
+ * Copyright (c) BitBoson
+ *
+ * bit-quark is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bit-quark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bit-quark.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <BitBoson/BitQuark/Networking/Payload.h>
+
+using namespace BitBoson;
+using namespace BitBoson::BitQuark;
+
+/**
+ * Constructor used to setup a null payload value
+ */
+Payload::Payload()
+{
+
+    // Setup the member variables
+    _type = Type::NULL_VALUE;
+    _boolValue = false;
+    _intValue = 0;
+    _doubleValue = 0.0;
+}
+
+/**
+ * Constructor used to setup a boolean payload value
+ *
+ * @param value Boolean representing the value
+ */
+Payload::Payload(bool value) : Payload()
+{
+
+    // Setup the member variables
+    _type = Type::BOOL;
+    _boolValue = value;
+}
+
+/**
+ * Constructor used to setup an integer payload value
+ *
+ * @param value Integer representing the value
+ */
+Payload::Payload(int value) : Payload((long long) value) {}
+
+/**
+ * Constructor used to setup an integer payload value
+ *
+ * @param value Long representing the value
+ */
+Payload::Payload(long value) : Payload((long long) value) {}
+
+/**
+ * Constructor used to setup an integer payload value
+ *
+ * @param value Long Long representing the value
+ */
+Payload::Payload(long long value) : Payload()
+{
+
+    // Setup the member variables
+    _type = Type::INTEGER;
+    _intValue = value;
+    _doubleValue = (double) value;
+}
+
+/**
+ * Constructor used to setup an integer payload value
+ *
+ * @param value Unsigned Long representing the value
+ */
+Payload::Payload(unsigned long value) : Payload((long long) value) {}
+
+/**
+ * Constructor used to setup a floating-point payload value
+ *
+ * @param value Double representing the value
+ */
+Payload::Payload(double value) : Payload()
+{
+
+    // Setup the member variables
+    _type = Type::DOUBLE;
+    _intValue = (long long) value;
+    _doubleValue = value;
+}
+
+/**
+ * Constructor used to setup a string payload value
+ *
+ * @param value String representing the value
+ */
+Payload::Payload(const std::string& value) : Payload()
+{
+
+    // Setup the member variables
+    _type = Type::STRING;
+    _stringValue = value;
+}
+
+/**
+ * Constructor used to setup a string payload value
+ *
+ * @param value Character Array representing the value
+ */
+Payload::Payload(const char* value) : Payload(std::string(value == nullptr ? "" : value)) {}
+
+/**
+ * Static function used to create an empty array payload value
+ *
+ * @return Payload representing an empty array
+ */
+Payload Payload::array()
+{
+
+    // Return an empty array payload value
+    Payload retPayload;
+    retPayload._type = Type::ARRAY;
+    return retPayload;
+}
+
+/**
+ * Static function used to create an empty object payload value
+ *
+ * @return Payload representing an empty object
+ */
+Payload Payload::object()
+{
+
+    // Return an empty object payload value
+    Payload retPayload;
+    retPayload._type = Type::OBJECT;
+    return retPayload;
+}
+
+/**
+ * Function used to get the type of the payload value
+ *
+ * @return Type representing the payload value's type
+ */
+Payload::Type Payload::getType() const
+{
+
+    // Return the type
+    return _type;
+}
+
+/**
+ * Function used to check whether the payload value is null
+ *
+ * @return Boolean indicating whether the value is null
+ */
+bool Payload::isNull() const
+{
+
+    // Return whether the value is null
+    return (_type == Type::NULL_VALUE);
+}
+
+/**
+ * Function used to get the payload value as a boolean
+ *
+ * @param defaultVal Boolean representing the value if it is not a boolean
+ * @return Boolean representing the value
+ */
+bool Payload::getBool(bool defaultVal) const
+{
+
+    // Return the value (if it is a boolean)
+    return (_type == Type::BOOL ? _boolValue : defaultVal);
+}
+
+/**
+ * Function used to get the payload value as an integer
+ * NOTE: Floating-point values are truncated
+ *
+ * @param defaultVal Long Long representing the value if it is not a number
+ * @return Long Long representing the value
+ */
+long long Payload::getInt(long long defaultVal) const
+{
+
+    // Return the value (if it is a number)
+    return (((_type == Type::INTEGER) || (_type == Type::DOUBLE)) ? _intValue : defaultVal);
+}
+
+/**
+ * Function used to get the payload value as a floating-point number
+ *
+ * @param defaultVal Double representing the value if it is not a number
+ * @return Double representing the value
+ */
+double Payload::getDouble(double defaultVal) const
+{
+
+    // Return the value (if it is a number)
+    return (((_type == Type::INTEGER) || (_type == Type::DOUBLE)) ? _doubleValue : defaultVal);
+}
+
+/**
+ * Function used to get the payload value as a string
+ *
+ * @param defaultVal String representing the value if it is not a string
+ * @return String representing the value
+ */
+std::string Payload::getString(const std::string& defaultVal) const
+{
+
+    // Return the value (if it is a string)
+    return (_type == Type::STRING ? _stringValue : defaultVal);
+}
+
+/**
+ * Function used to get the number of items (array) or members (object)
+ *
+ * @return Unsigned Long representing the number of items/members
+ */
+unsigned long Payload::size() const
+{
+
+    // Return the number of items/members (depending on the type)
+    if (_type == Type::ARRAY)
+        return _items.size();
+    return _members.size();
+}
+
+/**
+ * Function used to add an item to the (array) payload value
+ * NOTE: A null value becomes an array when an item is added
+ *
+ * @param item Payload representing the item to add
+ * @return Payload reference to the added item
+ */
+Payload& Payload::push(Payload item)
+{
+
+    // Turn a null value into an array
+    if (_type == Type::NULL_VALUE)
+        _type = Type::ARRAY;
+
+    // Add the item and return it
+    _items.push_back(std::move(item));
+    return _items.back();
+}
+
+/**
+ * Function used to get an item from the (array) payload value
+ *
+ * @param index Unsigned Long representing the index of the item
+ * @return Payload reference to the item (or a null value if missing)
+ */
+const Payload& Payload::at(unsigned long index) const
+{
+
+    // Return the item (if it exists)
+    if ((_type == Type::ARRAY) && (index < _items.size()))
+        return _items[index];
+    return getNullPayload();
+}
+
+/**
+ * Function used to check if the (object) payload value has a member
+ *
+ * @param key String representing the member's key
+ * @return Boolean indicating whether the member exists
+ */
+bool Payload::has(const std::string& key) const
+{
+
+    // Return whether the member exists
+    for (const auto& member : _members)
+        if (member.first == key)
+            return true;
+    return false;
+}
+
+/**
+ * Function used to get a member from the (object) payload value
+ *
+ * @param key String representing the member's key
+ * @return Payload reference to the member (or a null value if missing)
+ */
+const Payload& Payload::get(const std::string& key) const
+{
+
+    // Return the member (if it exists)
+    for (const auto& member : _members)
+        if (member.first == key)
+            return member.second;
+    return getNullPayload();
+}
+
+/**
+ * Function used to get (or add) a member of the (object) payload value
+ * NOTE: A null value becomes an object when a member is added
+ *
+ * @param key String representing the member's key
+ * @return Payload reference to the member
+ */
+Payload& Payload::operator[](const std::string& key)
+{
+
+    // Turn a null value into an object
+    if (_type == Type::NULL_VALUE)
+        _type = Type::OBJECT;
+
+    // Return the member if it already exists
+    for (auto& member : _members)
+        if (member.first == key)
+            return member.second;
+
+    // Otherwise, add (and return) a new null member
+    _members.emplace_back(key, Payload());
+    return _members.back().second;
+}
+
+/**
+ * Function used to append a member to the (object) payload value
+ * NOTE: Unlike the subscript operator this does not check for an
+ *       existing member with the same key (so it is constant-time)
+ *
+ * @param key String representing the member's key
+ * @param value Payload representing the member's value
+ * @return Payload reference to the added member
+ */
+Payload& Payload::addMember(const std::string& key, Payload value)
+{
+
+    // Turn a null value into an object
+    if (_type == Type::NULL_VALUE)
+        _type = Type::OBJECT;
+
+    // Add the member and return it
+    _members.emplace_back(key, std::move(value));
+    return _members.back().second;
+}
+
+/**
+ * Function used to get the items of the (array) payload value
+ *
+ * @return Vector of Payloads representing the items
+ */
+const std::vector<Payload>& Payload::getItems() const
+{
+
+    // Return the items
+    return _items;
+}
+
+/**
+ * Function used to get the members of the (object) payload value
+ *
+ * @return Vector of String-Payload pairs representing the members
+ */
+const std::vector<std::pair<std::string, Payload>>& Payload::getMembers() const
+{
+
+    // Return the members
+    return _members;
+}
+
+/**
+ * Operator used to compare two payload values for equality
+ *
+ * @param other Payload representing the value to compare against
+ * @return Boolean indicating whether the values are equal
+ */
+bool Payload::operator==(const Payload& other) const
+{
+
+    // Compare the values based on their type
+    if (_type != other._type)
+        return false;
+    switch (_type)
+    {
+        case Type::BOOL:
+            return (_boolValue == other._boolValue);
+        case Type::INTEGER:
+            return (_intValue == other._intValue);
+        case Type::DOUBLE:
+            return (_doubleValue == other._doubleValue);
+        case Type::STRING:
+            return (_stringValue == other._stringValue);
+        case Type::ARRAY:
+            return (_items == other._items);
+        case Type::OBJECT:
+            return (_members == other._members);
+        default:
+            return true;
+    }
+}
+
+/**
+ * Operator used to compare two payload values for inequality
+ *
+ * @param other Payload representing the value to compare against
+ * @return Boolean indicating whether the values are not equal
+ */
+bool Payload::operator!=(const Payload& other) const
+{
+
+    // Return the opposite of the equality check
+    return !(*this == other);
+}
+
+/**
+ * Internal static function used to get a shared null payload value
+ *
+ * @return Payload reference to a null value
+ */
+const Payload& Payload::getNullPayload()
+{
+
+    // Setup the shared null value
+    static const Payload nullPayload;
+
+    // Return the shared null value
+    return nullPayload;
+}
@@ -0,0 +1,286 @@
+/* This file is part of bit-quark.
+ *
+ * Copyright (c) BitBoson
+ *
+ * bit-quark is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bit-quark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bit-quark.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#ifndef BITQUARK_PAYLOAD_H
+#define BITQUARK_PAYLOAD_H
+
+#include <string>
+#include <vector>
+#include <utility>
+
+namespace BitBoson::BitQuark
+{
+
+    class Payload
+    {
+
+        // Public enumerations
+        public:
+            enum Type
+            {
+                NULL_VALUE,
+                BOOL,
+                INTEGER,
+                DOUBLE,
+                STRING,
+                ARRAY,
+                OBJECT
+            };
+
+        // Private member variables
+        private:
+            Type _type;
+            bool _boolValue;
+            long long _intValue;
+            double _doubleValue;
+            std::string _stringValue;
+            std::vector<Payload> _items;
+            std::vector<std::pair<std::string, Payload>> _members;
+
+        // Public member functions
+        public:
+
+            /**
+             * Constructor used to setup a null payload value
+             */
+            Payload();
+
+            /**
+             * Constructor used to setup a boolean payload value
+             *
+             * @param value Boolean representing the value
+             */
+            Payload(bool value);
+
+            /**
+             * Constructor used to setup an integer payload value
+             *
+             * @param value Integer representing the value
+             */
+            Payload(int value);
+
+            /**
+             * Constructor used to setup an integer payload value
+             *
+             * @param value Long representing the value
+             */
+            Payload(long value);
+
+            /**
+             * Constructor used to setup an integer payload value
+             *
+             * @param value Long Long representing the value
+             */
+            Payload(long long value);
+
+            /**
+             * Constructor used to setup an integer payload value
+             *
+             * @param value Unsigned Long representing the value
+             */
+            Payload(unsigned long value);
+
+            /**
+             * Constructor used to setup a floating-point payload value
+             *
+             * @param value Double representing the value
+             */
+            Payload(double value);
+
+            /**
+             * Constructor used to setup a string payload value
+             *
+             * @param value String representing the value
+             */
+            Payload(const std::string& value);
+
+            /**
+             * Constructor used to setup a string payload value
+             *
+             * @param value Character Array representing the value
+             */
+            Payload(const char* value);
+
+            /**
+             * Static function used to create an empty array payload value
+             *
+             * @return Payload representing an empty array
+             */
+            static Payload array();
+
+            /**
+             * Static function used to create an empty object payload value
+             *
+             * @return Payload representing an empty object
+             */
+            static Payload object();
+
+            /**
+             * Function used to get the type of the payload value
+             *
+             * @return Type representing the payload value's type
+             */
+            Type getType() const;
+
+            /**
+             * Function used to check whether the payload value is null
+             *
+             * @return Boolean indicating whether the value is null
+             */
+            bool isNull() const;
+
+            /**
+             * Function used to get the payload value as a boolean
+             *
+             * @param defaultVal Boolean representing the value if it is not a boolean
+             * @return Boolean representing the value
+             */
+            bool getBool(bool defaultVal=false) const;
+
+            /**
+             * Function used to get the payload value as an integer
+             * NOTE: Floating-point values are truncated
+             *
+             * @param defaultVal Long Long representing the value if it is not a number
+             * @return Long Long representing the value
+             */
+            long long getInt(long long defaultVal=0) const;
+
+            /**
+             * Function used to get the payload value as a floating-point number
+             *
+             * @param defaultVal Double representing the value if it is not a number
+             * @return Double representing the value
+             */
+            double getDouble(double defaultVal=0.0) const;
+
+            /**
+             * Function used to get the payload value as a string
+             *
+             * @param defaultVal String representing the value if it is not a string
+             * @return String representing the value
+             */
+            std::string getString(const std::string& defaultVal="") const;
+
+            /**
+             * Function used to get the number of items (array) or members (object)
+             *
+             * @return Unsigned Long representing the number of items/members
+             */
+            unsigned long size() const;
+
+            /**
+             * Function used to add an item to the (array) payload value
+             * NOTE: A null value becomes an array when an item is added
+             *
+             * @param item Payload representing the item to add
+             * @return Payload reference to the added item
+             */
+            Payload& push(Payload item);
+
+            /**
+             * Function used to get an item from the (array) payload value
+             *
+             * @param index Unsigned Long representing the index of the item
+             * @return Payload reference to the item (or a null value if missing)
+             */
+            const Payload& at(unsigned long index) const;
+
+            /**
+             * Function used to check if the (object) payload value has a member
+             *
+             * @param key String representing the member's key
+             * @return Boolean indicating whether the member exists
+             */
+            bool has(const std::string& key) const;
+
+            /**
+             * Function used to get a member from the (object) payload value
+             *
+             * @param key String representing the member's key
+             * @return Payload reference to the member (or a null value if missing)
+             */
+            const Payload& get(const std::string& key) const;
+
+            /**
+             * Function used to get (or add) a member of the (object) payload value
+             * NOTE: A null value becomes an object when a member is added
+             *
+             * @param key String representing the member's key
+             * @return Payload reference to the member
+             */
+            Payload& operator[](const std::string& key);
+
+            /**
+             * Function used to append a member to the (object) payload value
+             * NOTE: Unlike the subscript operator this does not check for an
+             *       existing member with the same key (so it is constant-time)
+             *
+             * @param key String representing the member's key
+             * @param value Payload representing the member's value
+             * @return Payload reference to the added member
+             */
+            Payload& addMember(const std::string& key, Payload value);
+
+            /**
+             * Function used to get the items of the (array) payload value
+             *
+             * @return Vector of Payloads representing the items
+             */
+            const std::vector<Payload>& getItems() const;
+
+            /**
+             * Function used to get the members of the (object) payload value
+             *
+             * @return Vector of String-Payload pairs representing the members
+             */
+            const std::vector<std::pair<std::string, Payload>>& getMembers() const;
+
+            /**
+             * Operator used to compare two payload values for equality
+             *
+             * @param other Payload representing the value to compare against
+             * @return Boolean indicating whether the values are equal
+             */
+            bool operator==(const Payload& other) const;
+
+            /**
+             * Operator used to compare two payload values for inequality
+             *
+             * @param other Payload representing the value to compare against
+             * @return Boolean indicating whether the values are not equal
+             */
+            bool operator!=(const Payload& other) const;
+
+        // Private member functions
+        private:
+
+            /**
+             * Internal static function used to get a shared null payload value
+             *
+             * @return Payload reference to a null value
+             */
+            static const Payload& getNullPayload();
+    };
+}
+
+#endif //BITQUARK_PAYLOAD_H
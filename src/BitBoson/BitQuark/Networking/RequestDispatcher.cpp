@@ -0,0 +1,259 @@
+/* This file is part of bit-quark.
+ *
+ * Copyright (c) BitBoson
+ *
+ * bit-quark is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bit-quark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bit-quark.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#include <mutex>
+#include <thread>
+#include <memory>
+#include <string>
+#include <BitBoson/BitQuark/Networking/Requests.h>
+#include <BitBoson/BitQuark/Networking/ConnectionPool.h>
+#include <BitBoson/BitQuark/Networking/RequestDispatcher.h>
+
+using namespace BitBoson;
+using namespace BitBoson::BitQuark;
+
+/**
+ * Constructor used to setup the request dispatcher instance
+ *
+ * @param maxInFlight Unsigned Long representing the maximum number
+ *                    of requests which can be in-flight at once
+ */
+RequestDispatcher::RequestDispatcher(unsigned long maxInFlight)
+{
+
+    // Setup the member variables (ensuring at least one request in-flight)
+    _isStopping = false;
+    _inFlight = 0;
+    _idleWorkers = 0;
+    _maxInFlight = (maxInFlight <= 0 ? 1 : maxInFlight);
+
+    // Ensure the default connection pool outlives the dispatcher
+    // since in-flight requests use it during shutdown
+    ConnectionPool::getDefaultPool();
+}
+
+/**
+ * Static function used to get the process-wide default request dispatcher
+ *
+ * @return Request Dispatcher reference used by default for async requests
+ */
+RequestDispatcher& RequestDispatcher::getDefaultDispatcher()
+{
+
+    // Setup the default dispatcher instance
+    static RequestDispatcher defaultDispatcher;
+
+    // Return the default dispatcher instance
+    return defaultDispatcher;
+}
+
+/**
+ * Function used to set the maximum number of in-flight requests
+ * NOTE: Lowering the limit only takes effect as requests complete
+ *
+ * @param maxInFlight Unsigned Long representing the maximum number
+ *                    of requests which can be in-flight at once
+ */
+void RequestDispatcher::setMaxInFlight(unsigned long maxInFlight)
+{
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_lock);
+
+    // Update the limit (ensuring at least one request in-flight)
+    _maxInFlight = (maxInFlight <= 0 ? 1 : maxInFlight);
+
+    // Wake-up the workers in-case the limit was raised
+    _pendingCondition.notify_all();
+}
+
+/**
+ * Function used to get the maximum number of in-flight requests
+ *
+ * @return Unsigned Long representing the in-flight request limit
+ */
+unsigned long RequestDispatcher::getMaxInFlight()
+{
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_lock);
+
+    // Return the in-flight limit
+    return _maxInFlight;
+}
+
+/**
+ * Function used to get the number of requests currently in-flight
+ *
+ * @return Unsigned Long representing the number of in-flight requests
+ */
+unsigned long RequestDispatcher::getInFlightCount()
+{
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_lock);
+
+    // Return the number of in-flight requests
+    return _inFlight;
+}
+
+/**
+ * Function used to get the number of requests waiting to be sent
+ *
+ * @return Unsigned Long representing the number of queued requests
+ */
+unsigned long RequestDispatcher::getQueuedCount()
+{
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_lock);
+
+    // Return the number of queued requests
+    return _pendingRequests.size();
+}
+
+/**
+ * Function used to dispatch a request to be made asynchronously
+ * NOTE: The callback is run on one of the dispatcher's threads
+ *
+ * @param method Servable HTTP Method indicating the method to use
+ * @param url String representing the URL/URI for the request
+ * @param body Unordered String-String map representing the body "json"
+ * @param timeout Integer representing the timeout (in milliseconds) to use
+ * @param retryLimit Integer representing the number of retrties to attempt
+ * @param callback Function called with the response once it is received
+ */
+void RequestDispatcher::dispatch(Servable::HttpMethod method, const std::string& url,
+        std::unordered_map<std::string, std::string> body, int timeout,
+        int retryLimit, std::function<void(Servable::ResponseObj)> callback)
+{
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_lock);
+
+    // Queue-up the request to be picked-up by a worker
+    _pendingRequests.push_back(PendingRequest{method, url,
+            std::move(body), timeout, retryLimit, std::move(callback)});
+
+    // Only start another worker if all of the current ones are busy
+    // and the in-flight limit has not yet been reached
+    if ((_idleWorkers < _pendingRequests.size()) && (_workers.size() < _maxInFlight))
+        _workers.emplace_back(&RequestDispatcher::runWorker, this);
+
+    // Wake-up an idle worker to handle the request
+    _pendingCondition.notify_one();
+}
+
+/**
+ * Destructor used to cleanup the instance
+ * NOTE: Requests still queued are completed with an error response
+ */
+RequestDispatcher::~RequestDispatcher()
+{
+
+    // Signal all of the workers to stop and grab any requests
+    // which have not yet been picked-up by a worker
+    // Do this in a separate context to leverage RAII for the mutex/lock
+    std::deque<PendingRequest> unsentRequests;
+    {
+
+        // Lock the thread for safe operation
+        std::unique_lock<std::mutex> lock(_lock);
+
+        // Stop the workers and take over the remaining requests
+        _isStopping = true;
+        unsentRequests.swap(_pendingRequests);
+        _pendingCondition.notify_all();
+    }
+
+    // Wait for the workers to finish their in-flight requests
+    for (auto& worker : _workers)
+        if (worker.joinable())
+            worker.join();
+
+    // Complete the unsent requests so that no one waits on them forever
+    for (auto& unsentRequest : unsentRequests)
+        if (unsentRequest.callback)
+            unsentRequest.callback(Servable::ResponseObj{503,
+                    {{"Status", "Error"}, {"Message", "Request Dispatcher Stopped"}}});
+}
+
+/**
+ * Internal function used to run a dispatcher worker thread
+ */
+void RequestDispatcher::runWorker()
+{
+
+    // Continuously handle requests until the dispatcher is stopped
+    while (true)
+    {
+
+        // Wait for the next request to handle
+        // Do this in a separate context to leverage RAII for the mutex/lock
+        PendingRequest pendingRequest;
+        {
+
+            // Lock the thread for safe operation
+            std::unique_lock<std::mutex> lock(_lock);
+
+            // Wait until there is a request (and room for it to be in-flight)
+            // or the dispatcher is stopped
+            _idleWorkers++;
+            _pendingCondition.wait(lock, [this]()
+            {
+                return (_isStopping || (!_pendingRequests.empty()
+                        && (_inFlight < _maxInFlight)));
+            });
+            _idleWorkers--;
+
+            // Exit the worker if the dispatcher is stopping
+            if (_isStopping)
+                break;
+
+            // Take the next request off of the queue
+            pendingRequest = std::move(_pendingRequests.front());
+            _pendingRequests.pop_front();
+            _inFlight++;
+        }
+
+        // Actually make the (blocking) request on this worker thread
+        auto response = Requests::makeRequest(pendingRequest.method,
+                pendingRequest.url, pendingRequest.body,
+                pendingRequest.timeout, pendingRequest.retryLimit);
+
+        // Hand the response back to the caller
+        if (pendingRequest.callback)
+            pendingRequest.callback(response);
+
+        // The request is no longer in-flight so let another one be sent
+        // Do this in a separate context to leverage RAII for the mutex/lock
+        {
+
+            // Lock the thread for safe operation
+            std::unique_lock<std::mutex> lock(_lock);
+
+            // Update the in-flight count and wake-up a waiting worker
+            _inFlight--;
+            _pendingCondition.notify_one();
+        }
+    }
+}
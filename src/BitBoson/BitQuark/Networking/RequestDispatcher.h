@@ -0,0 +1,145 @@
+/* This file is part of bit-quark.
+ *
+ * Copyright (c) BitBoson
+ *
+ * bit-quark is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bit-quark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bit-quark.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#ifndef BITQUARK_REQUESTDISPATCHER_H
+#define BITQUARK_REQUESTDISPATCHER_H
+
+#include <mutex>
+#include <deque>
+#include <thread>
+#include <memory>
+#include <string>
+#include <vector>
+#include <functional>
+#include <unordered_map>
+#include <condition_variable>
+#include <BitBoson/BitQuark/Networking/Servable.h>
+
+namespace BitBoson::BitQuark
+{
+
+    class RequestDispatcher
+    {
+
+        // Private structures
+        private:
+            struct PendingRequest
+            {
+                Servable::HttpMethod method;
+                std::string url;
+                std::unordered_map<std::string, std::string> body;
+                int timeout;
+                int retryLimit;
+                std::function<void(Servable::ResponseObj)> callback;
+            };
+
+        // Private member variables
+        private:
+            std::mutex _lock;
+            bool _isStopping;
+            unsigned long _inFlight;
+            unsigned long _idleWorkers;
+            unsigned long _maxInFlight;
+            std::vector<std::thread> _workers;
+            std::deque<PendingRequest> _pendingRequests;
+            std::condition_variable _pendingCondition;
+
+        // Public member functions
+        public:
+
+            /**
+             * Constructor used to setup the request dispatcher instance
+             *
+             * @param maxInFlight Unsigned Long representing the maximum number
+             *                    of requests which can be in-flight at once
+             */
+            explicit RequestDispatcher(unsigned long maxInFlight=32);
+
+            /**
+             * Static function used to get the process-wide default request dispatcher
+             *
+             * @return Request Dispatcher reference used by default for async requests
+             */
+            static RequestDispatcher& getDefaultDispatcher();
+
+            /**
+             * Function used to set the maximum number of in-flight requests
+             * NOTE: Lowering the limit only takes effect as requests complete
+             *
+             * @param maxInFlight Unsigned Long representing the maximum number
+             *                    of requests which can be in-flight at once
+             */
+            void setMaxInFlight(unsigned long maxInFlight);
+
+            /**
+             * Function used to get the maximum number of in-flight requests
+             *
+             * @return Unsigned Long representing the in-flight request limit
+             */
+            unsigned long getMaxInFlight();
+
+            /**
+             * Function used to get the number of requests currently in-flight
+             *
+             * @return Unsigned Long representing the number of in-flight requests
+             */
+            unsigned long getInFlightCount();
+
+            /**
+             * Function used to get the number of requests waiting to be sent
+             *
+             * @return Unsigned Long representing the number of queued requests
+             */
+            unsigned long getQueuedCount();
+
+            /**
+             * Function used to dispatch a request to be made asynchronously
+             * NOTE: The callback is run on one of the dispatcher's threads
+             *
+             * @param method Servable HTTP Method indicating the method to use
+             * @param url String representing the URL/URI for the request
+             * @param body Unordered String-String map representing the body "json"
+             * @param timeout Integer representing the timeout (in milliseconds) to use
+             * @param retryLimit Integer representing the number of retrties to attempt
+             * @param callback Function called with the response once it is received
+             */
+            void dispatch(Servable::HttpMethod method, const std::string& url,
+                    std::unordered_map<std::string, std::string> body, int timeout,
+                    int retryLimit, std::function<void(Servable::ResponseObj)> callback);
+
+            /**
+             * Destructor used to cleanup the instance
+             * NOTE: Requests still queued are completed with an error response
+             */
+            virtual ~RequestDispatcher();
+
+        // Private member functions
+        private:
+
+            /**
+             * Internal function used to run a dispatcher worker thread
+             */
+            void runWorker();
+    };
+}
+
+#endif //BITQUARK_REQUESTDISPATCHER_H
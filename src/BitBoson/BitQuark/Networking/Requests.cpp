@@ -21,22 +21,150 @@
 
 #include <iostream>
 #include <mutex>
+#include <atomic>
+#include <thread>
+#include <algorithm>
+#include <chrono>
+#include <vector>
+#include <condition_variable>
 #include <string>
+#include <future>
+#include <memory>
 #include <cpr/cpr.h>
 #include <functional>
 #include <unordered_map>
-#include <rapidjson/document.h>
-#include <rapidjson/writer.h>
-#include <rapidjson/stringbuffer.h>
 #include <BitBoson/BitQuark/Networking/Requests.h>
+#include <BitBoson/BitQuark/Networking/JsonCodec.h>
+#include <BitBoson/BitQuark/Networking/Compression.h>
+#include <BitBoson/BitQuark/Networking/BinaryClient.h>
+#include <BitBoson/BitQuark/Networking/ConnectionPool.h>
+#include <BitBoson/BitQuark/Networking/RequestDispatcher.h>
 #include <BitBoson/BitQuark/Networking/Servable.h>
 
 using namespace BitBoson;
 using namespace BitBoson::BitQuark;
 
+// Setup the counters for the retries issued by all requests
+static std::atomic<unsigned long> requestRetriesIssued(0);
+static std::atomic<unsigned long> requestDeadlinesExceeded(0);
+
+/**
+ * Internal function used to make a request attempt-by-attempt, retrying
+ * (with back-off) according to the retry policy
+ *
+ * @param retryPolicy Retry Policy representing how to retry failed attempts
+ * @param timeout Integer representing the timeout (in milliseconds) per attempt
+ * @param attemptFunction Function used to make a single attempt with the given
+ *                        timeout, setting the raw status code and whether the
+ *                        attempt failed to get a response at all
+ * @return Servable Response-Object representing the response information
+ */
+static Servable::ResponseObj makeRetriedRequest(const RetryPolicy& retryPolicy, int timeout,
+        std::function<Servable::ResponseObj(int, int&, bool&)> attemptFunction)
+{
+
+    // Create a response/return object
+    Servable::ResponseObj returnObj;
+    returnObj.code = 400;
+
+    // Retry until a return code less than 300 is returned, the failure
+    // is not retryable or the attempts/deadline budget has been used-up
+    auto deadlineTime = (std::chrono::steady_clock::now()
+            + std::chrono::milliseconds(retryPolicy.getDeadline()));
+    int currentAttempt = 0;
+    while (true)
+    {
+
+        // Increment the attempt count first thing
+        currentAttempt++;
+
+        // Never let an attempt run past the overall deadline
+        auto remainingTime = std::chrono::duration_cast<std::chrono::milliseconds>(
+                deadlineTime - std::chrono::steady_clock::now()).count();
+        auto attemptTimeout = (int) std::max(1L, std::min((long) timeout, (long) remainingTime));
+
+        // Actually perform the request
+        int statusCode = 0;
+        bool transportFailed = false;
+        returnObj = attemptFunction(attemptTimeout, statusCode, transportFailed);
+
+        // Stop once the request has succeeded or can never succeed as-is
+        if ((returnObj.code < 300) || (currentAttempt >= retryPolicy.getMaxAttempts())
+                || !retryPolicy.isRetryable(statusCode, transportFailed))
+            break;
+
+        // Back-off before retrying, giving-up if the retry would start past the deadline
+        auto backoff = std::chrono::milliseconds(retryPolicy.getBackoff(currentAttempt));
+        if ((std::chrono::steady_clock::now() + backoff) >= deadlineTime)
+        {
+            requestDeadlinesExceeded++;
+            break;
+        }
+        std::this_thread::sleep_for(backoff);
+        requestRetriesIssued++;
+    }
+
+    // Return the response/return object
+    return returnObj;
+}
+
+/**
+ * Internal function used to determine whether the URL is sent directly
+ * over the binary or in-process transports (rather than over HTTP)
+ *
+ * @param url String representing the URL/URI to check
+ * @return Boolean indicating whether the URL uses a direct transport
+ */
+static bool isDirectUrl(const std::string& url)
+{
+
+    // Return whether the URL uses the binary or in-process schemes
+    return (BinaryClient::isBinaryUrl(url) || Servable::isInProcessUrl(url));
+}
+
+/**
+ * Internal function used to make a request on the provided endpoint using the
+ * binary (or in-process) transport, retrying (with back-off) according to the
+ * retry policy
+ *
+ * @param method Servable HTTP Method indicating the method to use
+ * @param url String representing the (direct) URL/URI for the request
+ * @param body Unordered String-String map representing the string values
+ * @param data Payload representing the typed (object) members
+ * @param retryPolicy Retry Policy representing how to retry failed attempts
+ * @param timeout Integer representing the timeout (in milliseconds) per attempt
+ * @return Servable Response-Object representing the response information
+ */
+static Servable::ResponseObj makeBinaryRequest(Servable::HttpMethod method,
+        const std::string& url, const std::unordered_map<std::string, std::string>& body,
+        const Payload& data, const RetryPolicy& retryPolicy, int timeout)
+{
+
+    // Make the request on a persistent binary connection (or by calling the
+    // in-process servable's handler directly) for every attempt
+    bool isInProcess = Servable::isInProcessUrl(url);
+    return makeRetriedRequest(retryPolicy, timeout,
+        [method, &url, &body, &data, isInProcess](int attemptTimeout, int& statusCode,
+                bool& transportFailed) -> Servable::ResponseObj
+        {
+            // NOTE: The in-process handler may modify the bodies it is given
+            //       so each attempt is given its own copy of the originals
+            auto response = (isInProcess
+                    ? Servable::invokeInProcess(method, url,
+                        std::unordered_map<std::string, std::string>(body), Payload(data),
+                        transportFailed)
+                    : BinaryClient::getDefaultClient().request(
+                        method, url, body, data, attemptTimeout, transportFailed));
+            statusCode = (transportFailed ? 0 : response.code);
+            return response;
+        });
+}
+
 /**
  * Function used to make a request on the provided endpoint with the
  * provided details (method, headers, body, etc)
+ * NOTE: URLs using the "bq://" and "unix://" schemes are sent over the binary
+ *       transport and "inproc://" URLs call the in-process servable directly
  *
  * @param method Servable HTTP Method indicating the method to use
  * @param url String representing the URL/URI for the request
@@ -50,65 +178,345 @@ Servable::ResponseObj Requests::makeRequest(Servable::HttpMethod method,
         int timeout, int retryLimit)
 {
 
-    // Create a response/return object
-    Servable::ResponseObj returnObj;
-    returnObj.code = 400;
+    // Enforce a retry limit of at least one
+    if (retryLimit <= 0)
+        retryLimit = 1;
+
+    // Give every attempt its full timeout as the overall deadline budget
+    return makeRequest(method, url, std::move(body),
+            RetryPolicy(retryLimit, ((long) timeout * retryLimit)), timeout);
+}
+
+/**
+ * Function used to make a request on the provided endpoint with the
+ * provided details, retrying (with back-off) according to the retry policy
+ *
+ * @param method Servable HTTP Method indicating the method to use
+ * @param url String representing the URL/URI for the request
+ * @param body Unordered String-String map representing the body "json"
+ * @param retryPolicy Retry Policy representing how to retry failed attempts
+ * @param timeout Integer representing the timeout (in milliseconds) per attempt
+ * @return Servable Response-Object representing the response information
+ */
+Servable::ResponseObj Requests::makeRequest(Servable::HttpMethod method,
+        const std::string& url, std::unordered_map<std::string, std::string> body,
+        const RetryPolicy& retryPolicy, int timeout)
+{
+
+    // Send the body as-is over the binary (or in-process) transport if requested
+    if (isDirectUrl(url))
+        return makeBinaryRequest(method, url, body, Payload(), retryPolicy, timeout);
+
+    // Serialize the request body once for all attempts and make the request
+    return makeEncodedRequest(method, url, JsonCodec::encode(body), retryPolicy, timeout);
+}
+
+/**
+ * Function used to make a request on the provided endpoint with a typed
+ * (numbers, arrays, nested objects, etc) request body
+ *
+ * @param method Servable HTTP Method indicating the method to use
+ * @param url String representing the URL/URI for the request
+ * @param body Payload representing the (typed) body "json"
+ * @param timeout Integer representing the timeout (in milliseconds) to use
+ * @param retryLimit Integer representing the number of retrties to attempt
+ * @return Servable Response-Object representing the response information
+ */
+Servable::ResponseObj Requests::makeTypedRequest(Servable::HttpMethod method,
+        const std::string& url, const Payload& body, int timeout, int retryLimit)
+{
 
     // Enforce a retry limit of at least one
     if (retryLimit <= 0)
         retryLimit = 1;
 
-    // Retry until a return code less than 300 is returned
-    // or the retry-limit has been reached
-    int currentRetryCount = 0;
-    while ((returnObj.code >= 300) && (currentRetryCount < retryLimit))
+    // Send the body over the binary (or in-process) transport if requested,
+    // splitting out the string members as they would be when decoding JSON
+    if (isDirectUrl(url))
     {
+        Payload typedValues;
+        std::unordered_map<std::string, std::string> values;
+        for (const auto& member : body.getMembers())
+        {
+            if (member.second.getType() == Payload::Type::STRING)
+                values[member.first] = member.second.getString();
+            else
+                typedValues.addMember(member.first, member.second);
+        }
+        return makeBinaryRequest(method, url, values, typedValues,
+                RetryPolicy(retryLimit, ((long) timeout * retryLimit)), timeout);
+    }
 
-        // Increment the retry count first thing
-        currentRetryCount++;
+    // Serialize the request body once for all attempts and make the request
+    // NOTE: An empty (or null) payload is sent as an empty body
+    std::string bodyString;
+    if (body.size() > 0)
+        bodyString = JsonCodec::encodePayload(body);
+    return makeEncodedRequest(method, url, bodyString,
+            RetryPolicy(retryLimit, ((long) timeout * retryLimit)), timeout);
+}
 
-        // Add-in the request body
-        std::string bodyString;
-        for (const auto& reponseItem : body)
-            bodyString += "\"" + reponseItem.first + "\":\"" + reponseItem.second + "\",";
-        if (!bodyString.empty())
+/**
+ * Function used to make a request on the provided endpoint with an already
+ * encoded body, retrying (with back-off) according to the retry policy
+ *
+ * @param method Servable HTTP Method indicating the method to use
+ * @param url String representing the URL/URI for the request
+ * @param bodyString String representing the encoded body "json"
+ * @param retryPolicy Retry Policy representing how to retry failed attempts
+ * @param timeout Integer representing the timeout (in milliseconds) per attempt
+ * @return Servable Response-Object representing the response information
+ */
+Servable::ResponseObj Requests::makeEncodedRequest(Servable::HttpMethod method,
+        const std::string& url, const std::string& bodyString,
+        const RetryPolicy& retryPolicy, int timeout)
+{
+
+    // Decode the body for the binary (or in-process) transport if requested
+    if (isDirectUrl(url))
+    {
+        Payload typedValues;
+        std::unordered_map<std::string, std::string> values;
+        if (!bodyString.empty() && !JsonCodec::decode(bodyString.c_str(),
+                bodyString.size(), values, typedValues))
+            return Servable::ResponseObj{400, {{"Status", "Error"}, {"Message", "Invalid JSON Body"}}};
+        return makeBinaryRequest(method, url, values, typedValues, retryPolicy, timeout);
+    }
+
+    // Make the request on a pooled keep-alive session for every attempt
+    return makeRetriedRequest(retryPolicy, timeout,
+        [method, &url, &bodyString](int attemptTimeout, int& statusCode,
+                bool& transportFailed) -> Servable::ResponseObj
         {
-            bodyString = bodyString.substr(0, bodyString.size() - 1);
-            bodyString = "{" + bodyString + "}";
-        }
 
-        // Actually perform the request
-        cpr::Response responseRaw;
-        if (method == Servable::HttpMethod::GET)
-            responseRaw = cpr::Get(cpr::Url{url}, cpr::Timeout{timeout});
-        else if (method == Servable::HttpMethod::POST)
-            responseRaw = cpr::Post(cpr::Url{url}, cpr::Body{bodyString}, cpr::Timeout{timeout});
-
-        // Parse the results into our version of the response object
-        rapidjson::Document jsonDoc;
-        rapidjson::ParseResult parseResult = jsonDoc.Parse(responseRaw.text.c_str());
-        if (parseResult)
+            // Acquire a keep-alive session to the destination from the pool
+            // NOTE: Any time spent waiting on the pool is taken out of the
+            //       attempt's timeout so the attempt never exceeds it
+            auto& connectionPool = ConnectionPool::getDefaultPool();
+            auto acquireStart = std::chrono::steady_clock::now();
+            auto session = connectionPool.acquire(url, attemptTimeout);
+            auto acquireWaitMs = (int) std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::steady_clock::now() - acquireStart).count();
+            session->SetUrl(cpr::Url{url});
+            session->SetTimeout(cpr::Timeout{std::max(1, attemptTimeout - acquireWaitMs)});
+            session->SetHeader(cpr::Header{{"Accept-Encoding", "gzip, deflate"}});
+
+            // Actually perform the request
+            cpr::Response responseRaw;
+            if (method == Servable::HttpMethod::GET)
+                responseRaw = session->Get();
+            else if (method == Servable::HttpMethod::POST)
+            {
+                session->SetBody(cpr::Body{bodyString});
+                responseRaw = session->Post();
+            }
+
+            // Hand the session back to the pool, only keeping its connection
+            // alive if the request completed without a transport error
+            transportFailed = (responseRaw.error.code != cpr::ErrorCode::OK);
+            statusCode = (int) responseRaw.status_code;
+            connectionPool.release(url, session, !transportFailed);
+
+            // Decompress the response body if the server compressed it
+            // NOTE: The body is used as-is if it cannot be decompressed
+            auto contentEncoding = Compression::getEncoding(responseRaw.header["Content-Encoding"]);
+            std::string decompressedText;
+            if ((contentEncoding != Compression::Encoding::IDENTITY)
+                    && Compression::decompress(responseRaw.text.c_str(), responseRaw.text.size(),
+                        contentEncoding, decompressedText))
+                responseRaw.text = std::move(decompressedText);
+
+            // Parse the results into our version of the response object
+            Servable::ResponseObj returnObj;
+            returnObj.code = 400;
+            bool parseResult = JsonCodec::decode(responseRaw.text.c_str(),
+                    responseRaw.text.size(), returnObj.body, returnObj.data);
+            if (parseResult)
+            {
+
+                // Write the status/return code into the return object
+                returnObj.code = responseRaw.status_code;
+            }
+
+            // Handle the case where the parsing was unsuccessful
+            if (!parseResult)
+            {
+
+                // Write a standard return body with information about the contents
+                returnObj.body.clear();
+                returnObj.data = Payload();
+                returnObj.body["Status"] = "Error";
+                returnObj.body["Message"] = responseRaw.text;
+            }
+
+            // Return the response/return object
+            return returnObj;
+        });
+}
+
+/**
+ * Function used to get the number of retries issued by all requests
+ *
+ * @return Unsigned Long representing the number of retries issued
+ */
+unsigned long Requests::getRetryCount()
+{
+
+    // Return the number of retries issued
+    return requestRetriesIssued;
+}
+
+/**
+ * Function used to get the number of requests which gave-up retrying
+ * because their deadline budget had been used-up
+ *
+ * @return Unsigned Long representing the number of exceeded deadlines
+ */
+unsigned long Requests::getDeadlineExceededCount()
+{
+
+    // Return the number of exceeded deadlines
+    return requestDeadlinesExceeded;
+}
+
+/**
+ * Function used to make an asynchronous request on the provided endpoint
+ * NOTE: The request is sent by the default request dispatcher which
+ *       bounds the number of requests in-flight at any one time
+ *
+ * @param method Servable HTTP Method indicating the method to use
+ * @param url String representing the URL/URI for the request
+ * @param body Unordered String-String map representing the body "json"
+ * @param timeout Integer representing the timeout (in milliseconds) to use
+ * @param retryLimit Integer representing the number of retrties to attempt
+ * @return Future of the Servable Response-Object for the request
+ */
+std::future<Servable::ResponseObj> Requests::makeRequestAsync(Servable::HttpMethod method,
+        const std::string& url, std::unordered_map<std::string, std::string> body,
+        int timeout, int retryLimit)
+{
+
+    // Setup the promise to be fulfilled once the response is received
+    auto responsePromise = std::make_shared<std::promise<Servable::ResponseObj>>();
+    auto responseFuture = responsePromise->get_future();
+
+    // Dispatch the request, fulfilling the promise with its response
+    makeRequestAsync(method, url, std::move(body),
+        [responsePromise](Servable::ResponseObj response)
         {
+            responsePromise->set_value(std::move(response));
+        }, timeout, retryLimit);
 
-            // Write the JSON object into the return body
-            for (rapidjson::Value::ConstMemberIterator itr = jsonDoc.MemberBegin(); itr != jsonDoc.MemberEnd(); ++itr)
-                if (jsonDoc[itr->name.GetString()].IsString())
-                    returnObj.body[itr->name.GetString()] = jsonDoc[itr->name.GetString()].GetString();
+    // Return the future for the response
+    return responseFuture;
+}
 
-            // Write the status/return code into the return object
-            returnObj.code = responseRaw.status_code;
-        }
+/**
+ * Function used to make an asynchronous request on the provided endpoint
+ * calling the provided callback once the response has been received
+ * NOTE: The callback is run on one of the request dispatcher's threads
+ *
+ * @param method Servable HTTP Method indicating the method to use
+ * @param url String representing the URL/URI for the request
+ * @param body Unordered String-String map representing the body "json"
+ * @param callback Function called with the response once it is received
+ * @param timeout Integer representing the timeout (in milliseconds) to use
+ * @param retryLimit Integer representing the number of retrties to attempt
+ */
+void Requests::makeRequestAsync(Servable::HttpMethod method,
+        const std::string& url, std::unordered_map<std::string, std::string> body,
+        std::function<void(Servable::ResponseObj)> callback,
+        int timeout, int retryLimit)
+{
+
+    // Hand the request off to the default dispatcher
+    RequestDispatcher::getDefaultDispatcher().dispatch(method, url,
+            std::move(body), timeout, retryLimit, std::move(callback));
+}
+
+/**
+ * Function used to make the same request on all of the provided endpoints
+ * in parallel, completing early once a quorum of successful responses
+ * have been received or the deadline has passed
+ * NOTE: Endpoints which have not responded by then are listed as pending
+ *
+ * @param urls Vector of Strings representing the URLs/URIs for the request
+ * @param method Servable HTTP Method indicating the method to use
+ * @param body Unordered String-String map representing the body "json"
+ * @param quorum Unsigned Long representing the number of successful
+ *               responses to wait for (or zero to wait for all of them)
+ * @param deadline Integer representing the time (in milliseconds) to wait
+ * @return Broadcast Result representing the per-endpoint responses
+ */
+Requests::BroadcastResult Requests::broadcast(const std::vector<std::string>& urls,
+        Servable::HttpMethod method, std::unordered_map<std::string, std::string> body,
+        unsigned long quorum, int deadline)
+{
+
+    // Setup the state shared with the response callbacks
+    // NOTE: This is shared since responses arriving after this
+    //       function has returned still need somewhere to go
+    struct BroadcastState
+    {
+        std::mutex lock;
+        unsigned long successes = 0;
+        std::condition_variable respondedCondition;
+        std::unordered_map<std::string, Servable::ResponseObj> responses;
+    };
+    auto broadcastState = std::make_shared<BroadcastState>();
 
-        // Handle the case where the parsing was unsuccessful
-        if (!parseResult)
+    // Determine the number of successful responses to wait for
+    if ((quorum <= 0) || (quorum > urls.size()))
+        quorum = urls.size();
+
+    // Send the request to all of the endpoints at once
+    auto deadlineTime = (std::chrono::steady_clock::now() + std::chrono::milliseconds(deadline));
+    for (const auto& url : urls)
+        makeRequestAsync(method, url, body,
+            [broadcastState, url](Servable::ResponseObj response)
+            {
+
+                // Lock the thread for safe operation
+                std::unique_lock<std::mutex> lock(broadcastState->lock);
+
+                // Record the endpoint's response and wake-up the broadcaster
+                if (response.code < 300)
+                    broadcastState->successes++;
+                broadcastState->responses[url] = std::move(response);
+                broadcastState->respondedCondition.notify_all();
+            }, deadline, 1);
+
+    // Wait until quorum has been reached, every endpoint has responded
+    // (so quorum can no longer be reached) or the deadline has passed
+    std::unique_lock<std::mutex> lock(broadcastState->lock);
+    broadcastState->respondedCondition.wait_until(lock, deadlineTime,
+        [&broadcastState, &urls, quorum]()
         {
+            return ((broadcastState->successes >= quorum)
+                    || (broadcastState->responses.size() >= urls.size()));
+        });
 
-            // Write a standard return body with information about the contents
-            returnObj.body["Status"] = "Error";
-            returnObj.body["Message"] = responseRaw.text;
-        }
-    }
+    // Setup the broadcast result from the responses received so far
+    BroadcastResult broadcastResult;
+    broadcastResult.quorumReached = (broadcastState->successes >= quorum);
+    broadcastResult.responses = broadcastState->responses;
+    for (const auto& url : urls)
+        if (broadcastResult.responses.find(url) == broadcastResult.responses.end())
+            broadcastResult.pendingUrls.push_back(url);
 
-    // Return the response/return object
-    return returnObj;
+    // Return the broadcast result
+    return broadcastResult;
+}
+
+/**
+ * Function used to set the maximum number of asynchronous requests
+ * which can be in-flight at any one time
+ *
+ * @param maxInFlight Unsigned Long representing the in-flight request limit
+ */
+void Requests::setMaxInFlightRequests(unsigned long maxInFlight)
+{
+
+    // Update the default dispatcher's limit
+    RequestDispatcher::getDefaultDispatcher().setMaxInFlight(maxInFlight);
 }
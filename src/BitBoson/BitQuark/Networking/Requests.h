@@ -23,8 +23,13 @@
 #define BITQUARK_REQUESTS_H
 
 #include <string>
+#include <vector>
+#include <future>
+#include <functional>
 #include <unordered_map>
+#include <BitBoson/BitQuark/Networking/Payload.h>
 #include <BitBoson/BitQuark/Networking/Servable.h>
+#include <BitBoson/BitQuark/Networking/RetryPolicy.h>
 
 // Setup the place-holders namespace reference/usage
 using namespace std::placeholders;
@@ -36,9 +41,19 @@ namespace BitBoson::BitQuark
     namespace Requests
     {
 
+        // Public structures
+        struct BroadcastResult
+        {
+            bool quorumReached;
+            std::vector<std::string> pendingUrls;
+            std::unordered_map<std::string, Servable::ResponseObj> responses;
+        };
+
         /**
          * Function used to make a request on the provided endpoint with the
          * provided details (method, headers, body, etc)
+         * NOTE: URLs using the "bq://" and "unix://" schemes are sent over the binary
+         *       transport and "inproc://" URLs call the in-process servable directly
          *
          * @param method Servable HTTP Method indicating the method to use
          * @param url String representing the URL/URI for the request
@@ -50,6 +65,125 @@ namespace BitBoson::BitQuark
         Servable::ResponseObj makeRequest(Servable::HttpMethod method,
                 const std::string& url, std::unordered_map<std::string, std::string> body,
                 int timeout = 10000, int retryLimit = -1);
+
+        /**
+         * Function used to make a request on the provided endpoint with the
+         * provided details, retrying (with back-off) according to the retry policy
+         *
+         * @param method Servable HTTP Method indicating the method to use
+         * @param url String representing the URL/URI for the request
+         * @param body Unordered String-String map representing the body "json"
+         * @param retryPolicy Retry Policy representing how to retry failed attempts
+         * @param timeout Integer representing the timeout (in milliseconds) per attempt
+         * @return Servable Response-Object representing the response information
+         */
+        Servable::ResponseObj makeRequest(Servable::HttpMethod method,
+                const std::string& url, std::unordered_map<std::string, std::string> body,
+                const RetryPolicy& retryPolicy, int timeout = 10000);
+
+        /**
+         * Function used to make a request on the provided endpoint with a typed
+         * (numbers, arrays, nested objects, etc) request body
+         *
+         * @param method Servable HTTP Method indicating the method to use
+         * @param url String representing the URL/URI for the request
+         * @param body Payload representing the (typed) body "json"
+         * @param timeout Integer representing the timeout (in milliseconds) to use
+         * @param retryLimit Integer representing the number of retrties to attempt
+         * @return Servable Response-Object representing the response information
+         */
+        Servable::ResponseObj makeTypedRequest(Servable::HttpMethod method,
+                const std::string& url, const Payload& body,
+                int timeout = 10000, int retryLimit = -1);
+
+        /**
+         * Function used to make a request on the provided endpoint with an already
+         * encoded body, retrying (with back-off) according to the retry policy
+         *
+         * @param method Servable HTTP Method indicating the method to use
+         * @param url String representing the URL/URI for the request
+         * @param bodyString String representing the encoded body "json"
+         * @param retryPolicy Retry Policy representing how to retry failed attempts
+         * @param timeout Integer representing the timeout (in milliseconds) per attempt
+         * @return Servable Response-Object representing the response information
+         */
+        Servable::ResponseObj makeEncodedRequest(Servable::HttpMethod method,
+                const std::string& url, const std::string& bodyString,
+                const RetryPolicy& retryPolicy, int timeout = 10000);
+
+        /**
+         * Function used to get the number of retries issued by all requests
+         *
+         * @return Unsigned Long representing the number of retries issued
+         */
+        unsigned long getRetryCount();
+
+        /**
+         * Function used to get the number of requests which gave-up retrying
+         * because their deadline budget had been used-up
+         *
+         * @return Unsigned Long representing the number of exceeded deadlines
+         */
+        unsigned long getDeadlineExceededCount();
+
+        /**
+         * Function used to make an asynchronous request on the provided endpoint
+         * NOTE: The request is sent by the default request dispatcher which
+         *       bounds the number of requests in-flight at any one time
+         *
+         * @param method Servable HTTP Method indicating the method to use
+         * @param url String representing the URL/URI for the request
+         * @param body Unordered String-String map representing the body "json"
+         * @param timeout Integer representing the timeout (in milliseconds) to use
+         * @param retryLimit Integer representing the number of retrties to attempt
+         * @return Future of the Servable Response-Object for the request
+         */
+        std::future<Servable::ResponseObj> makeRequestAsync(Servable::HttpMethod method,
+                const std::string& url, std::unordered_map<std::string, std::string> body,
+                int timeout = 10000, int retryLimit = -1);
+
+        /**
+         * Function used to make an asynchronous request on the provided endpoint
+         * calling the provided callback once the response has been received
+         * NOTE: The callback is run on one of the request dispatcher's threads
+         *
+         * @param method Servable HTTP Method indicating the method to use
+         * @param url String representing the URL/URI for the request
+         * @param body Unordered String-String map representing the body "json"
+         * @param callback Function called with the response once it is received
+         * @param timeout Integer representing the timeout (in milliseconds) to use
+         * @param retryLimit Integer representing the number of retrties to attempt
+         */
+        void makeRequestAsync(Servable::HttpMethod method,
+                const std::string& url, std::unordered_map<std::string, std::string> body,
+                std::function<void(Servable::ResponseObj)> callback,
+                int timeout = 10000, int retryLimit = -1);
+
+        /**
+         * Function used to make the same request on all of the provided endpoints
+         * in parallel, completing early once a quorum of successful responses
+         * have been received or the deadline has passed
+         * NOTE: Endpoints which have not responded by then are listed as pending
+         *
+         * @param urls Vector of Strings representing the URLs/URIs for the request
+         * @param method Servable HTTP Method indicating the method to use
+         * @param body Unordered String-String map representing the body "json"
+         * @param quorum Unsigned Long representing the number of successful
+         *               responses to wait for (or zero to wait for all of them)
+         * @param deadline Integer representing the time (in milliseconds) to wait
+         * @return Broadcast Result representing the per-endpoint responses
+         */
+        BroadcastResult broadcast(const std::vector<std::string>& urls,
+                Servable::HttpMethod method, std::unordered_map<std::string, std::string> body,
+                unsigned long quorum = 0, int deadline = 10000);
+
+        /**
+         * Function used to set the maximum number of asynchronous requests
+         * which can be in-flight at any one time
+         *
+         * @param maxInFlight Unsigned Long representing the in-flight request limit
+         */
+        void setMaxInFlightRequests(unsigned long maxInFlight);
     }
 }
 
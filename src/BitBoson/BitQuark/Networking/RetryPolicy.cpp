@@ -0,0 +1,115 @@
+/* This file is part of bit-quark.
+ *
+ * Copyright (c) BitBoson
+ *
+ * bit-quark is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bit-quark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bit-quark.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#include <cmath>
+#include <random>
+#include <algorithm>
+#include <BitBoson/BitQuark/Networking/RetryPolicy.h>
+
+using namespace BitBoson;
+using namespace BitBoson::BitQuark;
+
+/**
+ * Constructor used to setup the retry policy instance
+ *
+ * @param maxAttempts Integer representing the maximum number of attempts
+ * @param deadline Long representing the total time (in milliseconds)
+ *                 budget for all attempts (including back-off)
+ * @param initialBackoff Long representing the back-off (in milliseconds)
+ *                       ceiling before the first retry
+ * @param maxBackoff Long representing the maximum back-off (in milliseconds)
+ * @param backoffMultiplier Double representing the back-off growth per retry
+ */
+RetryPolicy::RetryPolicy(int maxAttempts, long deadline,
+        long initialBackoff, long maxBackoff, double backoffMultiplier)
+{
+
+    // Setup the member variables (ensuring at least one attempt)
+    _maxAttempts = (maxAttempts <= 0 ? 1 : maxAttempts);
+    _deadline = (deadline <= 0 ? 1 : deadline);
+    _initialBackoff = (initialBackoff < 0 ? 0 : initialBackoff);
+    _maxBackoff = std::max(_initialBackoff, maxBackoff);
+    _backoffMultiplier = (backoffMultiplier < 1.0 ? 1.0 : backoffMultiplier);
+}
+
+/**
+ * Function used to get the maximum number of attempts
+ *
+ * @return Integer representing the maximum number of attempts
+ */
+int RetryPolicy::getMaxAttempts() const
+{
+
+    // Return the maximum number of attempts
+    return _maxAttempts;
+}
+
+/**
+ * Function used to get the total time budget for all attempts
+ *
+ * @return Long representing the deadline (in milliseconds)
+ */
+long RetryPolicy::getDeadline() const
+{
+
+    // Return the deadline
+    return _deadline;
+}
+
+/**
+ * Function used to get the (jittered) time to wait before a retry
+ * NOTE: This uses "full jitter" (a random value up to the exponential
+ *       back-off ceiling) so that retrying clients spread out
+ *
+ * @param retry Integer representing the retry number (starting at 1)
+ * @return Long representing the time (in milliseconds) to wait
+ */
+long RetryPolicy::getBackoff(int retry) const
+{
+
+    // Determine the exponential back-off ceiling for this retry
+    auto ceiling = std::min((double) _maxBackoff,
+            (_initialBackoff * std::pow(_backoffMultiplier, std::max(0, retry - 1))));
+
+    // Pick a random back-off up to the ceiling
+    thread_local std::mt19937 randomGenerator(std::random_device{}());
+    std::uniform_int_distribution<long> distribution(0, (long) ceiling);
+    return distribution(randomGenerator);
+}
+
+/**
+ * Function used to determine whether a failed attempt should be retried
+ * NOTE: Transport failures, timeouts, throttling and server errors are
+ *       retryable while other client errors will never succeed as-is
+ *
+ * @param statusCode Integer representing the HTTP status code received
+ * @param transportFailed Boolean indicating whether the request failed
+ *                        before a response was received
+ * @return Boolean indicating whether the attempt should be retried
+ */
+bool RetryPolicy::isRetryable(int statusCode, bool transportFailed) const
+{
+
+    // Return whether the failure is (potentially) transient
+    return (transportFailed || (statusCode == 408)
+            || (statusCode == 429) || (statusCode >= 500));
+}
@@ -0,0 +1,100 @@
+/* This file is part of bit-quark.
+ *
+ * Copyright (c) BitBoson
+ *
+ * bit-quark is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bit-quark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bit-quark.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#ifndef BITQUARK_RETRYPOLICY_H
+#define BITQUARK_RETRYPOLICY_H
+
+namespace BitBoson::BitQuark
+{
+
+    class RetryPolicy
+    {
+
+        // Private member variables
+        private:
+            int _maxAttempts;
+            long _deadline;
+            long _initialBackoff;
+            long _maxBackoff;
+            double _backoffMultiplier;
+
+        // Public member functions
+        public:
+
+            /**
+             * Constructor used to setup the retry policy instance
+             *
+             * @param maxAttempts Integer representing the maximum number of attempts
+             * @param deadline Long representing the total time (in milliseconds)
+             *                 budget for all attempts (including back-off)
+             * @param initialBackoff Long representing the back-off (in milliseconds)
+             *                       ceiling before the first retry
+             * @param maxBackoff Long representing the maximum back-off (in milliseconds)
+             * @param backoffMultiplier Double representing the back-off growth per retry
+             */
+            explicit RetryPolicy(int maxAttempts=1, long deadline=10000,
+                    long initialBackoff=50, long maxBackoff=2000, double backoffMultiplier=2.0);
+
+            /**
+             * Function used to get the maximum number of attempts
+             *
+             * @return Integer representing the maximum number of attempts
+             */
+            int getMaxAttempts() const;
+
+            /**
+             * Function used to get the total time budget for all attempts
+             *
+             * @return Long representing the deadline (in milliseconds)
+             */
+            long getDeadline() const;
+
+            /**
+             * Function used to get the (jittered) time to wait before a retry
+             * NOTE: This uses "full jitter" (a random value up to the exponential
+             *       back-off ceiling) so that retrying clients spread out
+             *
+             * @param retry Integer representing the retry number (starting at 1)
+             * @return Long representing the time (in milliseconds) to wait
+             */
+            long getBackoff(int retry) const;
+
+            /**
+             * Function used to determine whether a failed attempt should be retried
+             * NOTE: Transport failures, timeouts, throttling and server errors are
+             *       retryable while other client errors will never succeed as-is
+             *
+             * @param statusCode Integer representing the HTTP status code received
+             * @param transportFailed Boolean indicating whether the request failed
+             *                        before a response was received
+             * @return Boolean indicating whether the attempt should be retried
+             */
+            bool isRetryable(int statusCode, bool transportFailed) const;
+
+            /**
+             * Destructor used to cleanup the instance
+             */
+            virtual ~RetryPolicy() = default;
+    };
+}
+
+#endif //BITQUARK_RETRYPOLICY_H
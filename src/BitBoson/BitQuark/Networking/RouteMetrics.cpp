@@ -0,0 +1,340 @@
+/* This file is part of bit-quark.
+ *
+ * Copyright (c) BitBoson
+ *
+ * bit-quark is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bit-quark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bit-quark.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+#include <sstream>
+#include <algorithm>
+#include <BitBoson/BitQuark/Networking/RouteMetrics.h>
+
+using namespace BitBoson;
+using namespace BitBoson::BitQuark;
+
+/**
+ * Function used to add a route to collect metrics for
+ * NOTE: The returned stats are updated without any locking
+ *
+ * @param method String representing the route's HTTP method
+ * @param route String representing the route (including any route-argument)
+ * @return Route Stats (pointer) to record the route's requests with
+ */
+std::shared_ptr<RouteMetrics::RouteStats> RouteMetrics::addRoute(
+        const std::string& method, const std::string& route)
+{
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_lock);
+
+    // Re-use the existing metrics for the route if it was already added
+    for (const auto& routeStats : _routes)
+        if ((routeStats->method == method) && (routeStats->route == route))
+            return routeStats;
+
+    // Otherwise, add the new route's metrics
+    auto routeStats = std::make_shared<RouteStats>();
+    routeStats->method = method;
+    routeStats->route = route;
+    _routes.push_back(routeStats);
+    return routeStats;
+}
+
+/**
+ * Static function used to record that a request on the route has started
+ *
+ * @param routeStats Route Stats representing the route's metrics
+ */
+void RouteMetrics::recordStart(RouteStats& routeStats)
+{
+
+    // Track the request as in-flight
+    routeStats.inFlight.fetch_add(1, std::memory_order_relaxed);
+}
+
+/**
+ * Static function used to record that a request on the route has completed
+ *
+ * @param routeStats Route Stats representing the route's metrics
+ * @param code Integer representing the response's status code
+ * @param requestBytes Unsigned Long representing the request body's size
+ * @param responseBytes Unsigned Long representing the response body's size
+ * @param startTime Time Point representing when the request started
+ */
+void RouteMetrics::recordEnd(RouteStats& routeStats, int code, unsigned long requestBytes,
+        unsigned long responseBytes, std::chrono::steady_clock::time_point startTime)
+{
+
+    // Determine how long the request took
+    auto latencyMicros = (long) std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - startTime).count();
+
+    // Update all of the counters for the request
+    // NOTE: The counters are independent so relaxed ordering is enough
+    routeStats.inFlight.fetch_sub(1, std::memory_order_relaxed);
+    routeStats.requests.fetch_add(1, std::memory_order_relaxed);
+    routeStats.requestBytes.fetch_add(requestBytes, std::memory_order_relaxed);
+    routeStats.responseBytes.fetch_add(responseBytes, std::memory_order_relaxed);
+    routeStats.latencySumMicros.fetch_add((unsigned long) latencyMicros, std::memory_order_relaxed);
+    routeStats.latencyBuckets[getLatencyBucket(latencyMicros)].fetch_add(1, std::memory_order_relaxed);
+    if ((code >= 0) && (code < MAX_RESPONSE_CODE))
+        routeStats.responseCodes[code].fetch_add(1, std::memory_order_relaxed);
+}
+
+/**
+ * Function used to get the number of requests completed on the route
+ *
+ * @param method String representing the route's HTTP method
+ * @param route String representing the route (including any route-argument)
+ * @return Unsigned Long representing the number of completed requests
+ */
+unsigned long RouteMetrics::getRequestCount(const std::string& method, const std::string& route)
+{
+
+    // Return the number of completed requests (if the route exists)
+    auto routeStats = findRoute(method, route);
+    return (routeStats == nullptr ? 0 : routeStats->requests.load());
+}
+
+/**
+ * Function used to get the number of responses with the given status code
+ *
+ * @param method String representing the route's HTTP method
+ * @param route String representing the route (including any route-argument)
+ * @param code Integer representing the status code to count
+ * @return Unsigned Long representing the number of responses
+ */
+unsigned long RouteMetrics::getResponseCount(const std::string& method,
+        const std::string& route, int code)
+{
+
+    // Return the number of responses (if the route and code exist)
+    auto routeStats = findRoute(method, route);
+    if ((routeStats == nullptr) || (code < 0) || (code >= MAX_RESPONSE_CODE))
+        return 0;
+    return routeStats->responseCodes[code].load();
+}
+
+/**
+ * Function used to get the number of requests currently in-flight on the route
+ *
+ * @param method String representing the route's HTTP method
+ * @param route String representing the route (including any route-argument)
+ * @return Long representing the number of in-flight requests
+ */
+long RouteMetrics::getInFlightCount(const std::string& method, const std::string& route)
+{
+
+    // Return the number of in-flight requests (if the route exists)
+    auto routeStats = findRoute(method, route);
+    return (routeStats == nullptr ? 0 : routeStats->inFlight.load());
+}
+
+/**
+ * Function used to get the (approximate) latency of the given percentile
+ * of requests on the route from its latency histogram
+ *
+ * @param method String representing the route's HTTP method
+ * @param route String representing the route (including any route-argument)
+ * @param percentile Double representing the percentile (0 to 100) to get
+ * @return Double representing the latency (in milliseconds)
+ */
+double RouteMetrics::getLatencyPercentile(const std::string& method,
+        const std::string& route, double percentile)
+{
+
+    // Only continue if the route exists and has requests
+    auto routeStats = findRoute(method, route);
+    if (routeStats == nullptr)
+        return 0.0;
+    std::array<unsigned long, LATENCY_BUCKETS> buckets{};
+    unsigned long total = 0;
+    for (int bucket = 0; bucket < LATENCY_BUCKETS; bucket++)
+    {
+        buckets[bucket] = routeStats->latencyBuckets[bucket].load();
+        total += buckets[bucket];
+    }
+    if (total == 0)
+        return 0.0;
+
+    // Find the bucket holding the percentile and return its upper bound
+    auto target = (unsigned long) std::max(1.0, ((std::min(percentile, 100.0) / 100.0) * total));
+    unsigned long seen = 0;
+    int bucket = 0;
+    for (; bucket < (LATENCY_BUCKETS - 1); bucket++)
+    {
+        seen += buckets[bucket];
+        if (seen >= target)
+            break;
+    }
+    return (getLatencyBucketBound(bucket) / 1000.0);
+}
+
+/**
+ * Function used to get all of the metrics in the Prometheus text format
+ *
+ * @return String representing the metrics in the Prometheus text format
+ */
+std::string RouteMetrics::toPrometheus()
+{
+
+    // Get a snapshot of the routes to report on
+    std::vector<std::shared_ptr<RouteStats>> routes;
+    {
+        std::unique_lock<std::mutex> lock(_lock);
+        routes = _routes;
+    }
+
+    // Setup a function used to get the (escaped) labels for a route
+    auto getLabels = [](const RouteStats& routeStats) -> std::string
+    {
+        std::string labels = ("method=\"" + routeStats.method + "\",route=\"");
+        for (auto character : routeStats.route)
+        {
+            if ((character == '\\') || (character == '"'))
+                labels.push_back('\\');
+            labels.push_back(character);
+        }
+        return (labels + "\"");
+    };
+
+    // Write the request counters by response code
+    std::ostringstream output;
+    output << "# HELP bitquark_requests_total Requests handled by route and response code\n";
+    output << "# TYPE bitquark_requests_total counter\n";
+    for (const auto& routeStats : routes)
+        for (int code = 0; code < MAX_RESPONSE_CODE; code++)
+        {
+            auto count = routeStats->responseCodes[code].load();
+            if (count > 0)
+                output << "bitquark_requests_total{" << getLabels(*routeStats)
+                       << ",code=\"" << code << "\"} " << count << "\n";
+        }
+
+    // Write the in-flight gauges
+    output << "# HELP bitquark_requests_in_flight Requests currently being handled by route\n";
+    output << "# TYPE bitquark_requests_in_flight gauge\n";
+    for (const auto& routeStats : routes)
+        output << "bitquark_requests_in_flight{" << getLabels(*routeStats) << "} "
+               << routeStats->inFlight.load() << "\n";
+
+    // Write the body byte counters
+    output << "# HELP bitquark_request_bytes_total Request body bytes received by route\n";
+    output << "# TYPE bitquark_request_bytes_total counter\n";
+    for (const auto& routeStats : routes)
+        output << "bitquark_request_bytes_total{" << getLabels(*routeStats) << "} "
+               << routeStats->requestBytes.load() << "\n";
+    output << "# HELP bitquark_response_bytes_total Response body bytes sent by route\n";
+    output << "# TYPE bitquark_response_bytes_total counter\n";
+    for (const auto& routeStats : routes)
+        output << "bitquark_response_bytes_total{" << getLabels(*routeStats) << "} "
+               << routeStats->responseBytes.load() << "\n";
+
+    // Write the latency histograms (only reporting the power of two bounds)
+    output << "# HELP bitquark_request_duration_seconds Request handling latency by route\n";
+    output << "# TYPE bitquark_request_duration_seconds histogram\n";
+    for (const auto& routeStats : routes)
+    {
+        auto labels = getLabels(*routeStats);
+        unsigned long cumulative = 0;
+        for (int bucket = 0; bucket < LATENCY_BUCKETS; bucket++)
+        {
+            cumulative += routeStats->latencyBuckets[bucket].load();
+            if (((bucket % LATENCY_SUB_BUCKETS) == (LATENCY_SUB_BUCKETS - 1))
+                    && (bucket < (LATENCY_BUCKETS - 1)))
+                output << "bitquark_request_duration_seconds_bucket{" << labels << ",le=\""
+                       << (getLatencyBucketBound(bucket) / 1000000.0) << "\"} " << cumulative << "\n";
+        }
+        output << "bitquark_request_duration_seconds_bucket{" << labels << ",le=\"+Inf\"} "
+               << cumulative << "\n";
+        output << "bitquark_request_duration_seconds_sum{" << labels << "} "
+               << (routeStats->latencySumMicros.load() / 1000000.0) << "\n";
+        output << "bitquark_request_duration_seconds_count{" << labels << "} "
+               << cumulative << "\n";
+    }
+
+    // Return the metrics text
+    return output.str();
+}
+
+/**
+ * Static function used to get the latency histogram bucket for the latency
+ * NOTE: The buckets are log-linear (a fixed number of linear sub-buckets
+ *       for every power of two) similar to an HDR histogram
+ *
+ * @param latencyMicros Long representing the latency (in microseconds)
+ * @return Integer representing the index of the bucket
+ */
+int RouteMetrics::getLatencyBucket(long latencyMicros)
+{
+
+    // Small latencies each get their own bucket
+    if (latencyMicros < LATENCY_SUB_BUCKETS)
+        return (int) std::max(0L, latencyMicros);
+
+    // Otherwise, find the power of two and then the linear sub-bucket within it
+    int exponent = (63 - __builtin_clzl((unsigned long) latencyMicros));
+    int subBucket = (int) ((latencyMicros >> (exponent - 2)) & (LATENCY_SUB_BUCKETS - 1));
+    return std::min(((exponent - 1) * LATENCY_SUB_BUCKETS) + subBucket, (LATENCY_BUCKETS - 1));
+}
+
+/**
+ * Static function used to get the (exclusive) upper bound of the bucket
+ *
+ * @param bucket Integer representing the index of the bucket
+ * @return Long representing the upper bound (in microseconds)
+ */
+long RouteMetrics::getLatencyBucketBound(int bucket)
+{
+
+    // Small latencies each get their own bucket
+    if (bucket < LATENCY_SUB_BUCKETS)
+        return (bucket + 1);
+
+    // Otherwise, get the bound from the power of two and sub-bucket
+    int exponent = ((bucket / LATENCY_SUB_BUCKETS) + 1);
+    int subBucket = (bucket % LATENCY_SUB_BUCKETS);
+    return ((long) (LATENCY_SUB_BUCKETS + subBucket + 1) << (exponent - 2));
+}
+
+/**
+ * Internal function used to find the metrics for the given route
+ *
+ * @param method String representing the route's HTTP method
+ * @param route String representing the route (including any route-argument)
+ * @return Route Stats (pointer) for the route (or null if not found)
+ */
+std::shared_ptr<RouteMetrics::RouteStats> RouteMetrics::findRoute(
+        const std::string& method, const std::string& route)
+{
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_lock);
+
+    // Return the route's metrics (if it exists)
+    for (const auto& routeStats : _routes)
+        if ((routeStats->method == method) && (routeStats->route == route))
+            return routeStats;
+    return nullptr;
+}
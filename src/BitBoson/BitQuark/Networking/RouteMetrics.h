@@ -0,0 +1,187 @@
+/* This file is part of bit-quark.
+ *
+ * Copyright (c) BitBoson
+ *
+ * bit-quark is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bit-quark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bit-quark.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#ifndef BITQUARK_ROUTEMETRICS_H
+#define BITQUARK_ROUTEMETRICS_H
+
+#include <mutex>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace BitBoson::BitQuark
+{
+
+    class RouteMetrics
+    {
+
+        // Public constants
+        public:
+            static const int LATENCY_SUB_BUCKETS = 4;
+            static const int LATENCY_BUCKETS = 100;
+            static const int MAX_RESPONSE_CODE = 600;
+
+        // Public structures
+        public:
+            struct RouteStats
+            {
+                std::string method;
+                std::string route;
+                std::atomic<long> inFlight{0};
+                std::atomic<unsigned long> requests{0};
+                std::atomic<unsigned long> requestBytes{0};
+                std::atomic<unsigned long> responseBytes{0};
+                std::atomic<unsigned long> latencySumMicros{0};
+                std::array<std::atomic<unsigned long>, LATENCY_BUCKETS> latencyBuckets{};
+                std::array<std::atomic<unsigned long>, MAX_RESPONSE_CODE> responseCodes{};
+            };
+
+        // Private member variables
+        private:
+            std::mutex _lock;
+            std::vector<std::shared_ptr<RouteStats>> _routes;
+
+        // Public member functions
+        public:
+
+            /**
+             * Constructor used to setup the route metrics instance
+             */
+            RouteMetrics() = default;
+
+            /**
+             * Function used to add a route to collect metrics for
+             * NOTE: The returned stats are updated without any locking
+             *
+             * @param method String representing the route's HTTP method
+             * @param route String representing the route (including any route-argument)
+             * @return Route Stats (pointer) to record the route's requests with
+             */
+            std::shared_ptr<RouteStats> addRoute(const std::string& method, const std::string& route);
+
+            /**
+             * Static function used to record that a request on the route has started
+             *
+             * @param routeStats Route Stats representing the route's metrics
+             */
+            static void recordStart(RouteStats& routeStats);
+
+            /**
+             * Static function used to record that a request on the route has completed
+             *
+             * @param routeStats Route Stats representing the route's metrics
+             * @param code Integer representing the response's status code
+             * @param requestBytes Unsigned Long representing the request body's size
+             * @param responseBytes Unsigned Long representing the response body's size
+             * @param startTime Time Point representing when the request started
+             */
+            static void recordEnd(RouteStats& routeStats, int code, unsigned long requestBytes,
+                    unsigned long responseBytes, std::chrono::steady_clock::time_point startTime);
+
+            /**
+             * Function used to get the number of requests completed on the route
+             *
+             * @param method String representing the route's HTTP method
+             * @param route String representing the route (including any route-argument)
+             * @return Unsigned Long representing the number of completed requests
+             */
+            unsigned long getRequestCount(const std::string& method, const std::string& route);
+
+            /**
+             * Function used to get the number of responses with the given status code
+             *
+             * @param method String representing the route's HTTP method
+             * @param route String representing the route (including any route-argument)
+             * @param code Integer representing the status code to count
+             * @return Unsigned Long representing the number of responses
+             */
+            unsigned long getResponseCount(const std::string& method, const std::string& route, int code);
+
+            /**
+             * Function used to get the number of requests currently in-flight on the route
+             *
+             * @param method String representing the route's HTTP method
+             * @param route String representing the route (including any route-argument)
+             * @return Long representing the number of in-flight requests
+             */
+            long getInFlightCount(const std::string& method, const std::string& route);
+
+            /**
+             * Function used to get the (approximate) latency of the given percentile
+             * of requests on the route from its latency histogram
+             *
+             * @param method String representing the route's HTTP method
+             * @param route String representing the route (including any route-argument)
+             * @param percentile Double representing the percentile (0 to 100) to get
+             * @return Double representing the latency (in milliseconds)
+             */
+            double getLatencyPercentile(const std::string& method, const std::string& route,
+                    double percentile);
+
+            /**
+             * Function used to get all of the metrics in the Prometheus text format
+             *
+             * @return String representing the metrics in the Prometheus text format
+             */
+            std::string toPrometheus();
+
+            /**
+             * Static function used to get the latency histogram bucket for the latency
+             * NOTE: The buckets are log-linear (a fixed number of linear sub-buckets
+             *       for every power of two) similar to an HDR histogram
+             *
+             * @param latencyMicros Long representing the latency (in microseconds)
+             * @return Integer representing the index of the bucket
+             */
+            static int getLatencyBucket(long latencyMicros);
+
+            /**
+             * Static function used to get the (exclusive) upper bound of the bucket
+             *
+             * @param bucket Integer representing the index of the bucket
+             * @return Long representing the upper bound (in microseconds)
+             */
+            static long getLatencyBucketBound(int bucket);
+
+            /**
+             * Destructor used to cleanup the instance
+             */
+            virtual ~RouteMetrics() = default;
+
+        // Private member functions
+        private:
+
+            /**
+             * Internal function used to find the metrics for the given route
+             *
+             * @param method String representing the route's HTTP method
+             * @param route String representing the route (including any route-argument)
+             * @return Route Stats (pointer) for the route (or null if not found)
+             */
+            std::shared_ptr<RouteStats> findRoute(const std::string& method, const std::string& route);
+    };
+}
+
+#endif //BITQUARK_ROUTEMETRICS_H
@@ -0,0 +1,213 @@
+/* This file is part of bit-quark.
+ *
+ * Copyright (c) BitBoson
+ *
+ * bit-quark is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bit-quark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bit-quark.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+
+#include <map>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <string_view>
+#include <BitBoson/BitQuark/Networking/RouteTable.h>
+
+using namespace BitBoson::BitQuark;
+
+/**
+ * Constructor used to setup the (empty) route table
+ */
+RouteTable::RouteTable()
+{
+
+    // Setup the member variables
+    _routeCount = 0;
+}
+
+/**
+ * Function used to add a route to the table
+ * NOTE: The route is only used for look-ups once the table is compiled
+ *
+ * @param method Integer representing the route's (HTTP) method
+ * @param route String representing the route's path
+ * @param hasArgument Boolean indicating whether the route captures
+ *                    the trailing portion of the path as an argument
+ * @param handlerIndex Unsigned Long representing the route's handler
+ */
+void RouteTable::addRoute(int method, const std::string& route, bool hasArgument,
+        unsigned long handlerIndex)
+{
+
+    // Find (or create) the root node for the method
+    if (method < 0)
+        return;
+    if ((unsigned long) method >= _buildRoots.size())
+        _buildRoots.resize((method + 1), -1);
+    if (_buildRoots[method] < 0)
+    {
+        _buildRoots[method] = (long) _buildNodes.size();
+        _buildNodes.push_back(BuildNode{-1, -1, {}});
+    }
+
+    // Walk down (creating as needed) the node for each of the route's segments
+    // NOTE: The root route ("/") has no segments
+    auto node = (unsigned long) _buildRoots[method];
+    unsigned long segmentStart = 1;
+    while ((route.size() > 1) && (segmentStart <= route.size()))
+    {
+        auto segmentEnd = route.find('/', segmentStart);
+        if (segmentEnd == std::string::npos)
+            segmentEnd = route.size();
+        auto segment = route.substr(segmentStart, (segmentEnd - segmentStart));
+        auto childIter = _buildNodes[node].children.find(segment);
+        if (childIter == _buildNodes[node].children.end())
+        {
+            auto child = _buildNodes.size();
+            _buildNodes[node].children[segment] = child;
+            _buildNodes.push_back(BuildNode{-1, -1, {}});
+            node = child;
+        }
+        else
+        {
+            node = childIter->second;
+        }
+        segmentStart = (segmentEnd + 1);
+    }
+
+    // Set the handler for the route (replacing any existing one)
+    if (hasArgument)
+        _buildNodes[node].argHandler = (long) handlerIndex;
+    else
+        _buildNodes[node].exactHandler = (long) handlerIndex;
+    _routeCount++;
+}
+
+/**
+ * Function used to compile the added routes into a flat (radix) tree
+ * of path segments where each node's children are stored contiguously
+ * and sorted for binary searching
+ */
+void RouteTable::compile()
+{
+
+    // Setup the compiled nodes in the same order as they were built
+    _nodes.clear();
+    _edges.clear();
+    _nodes.reserve(_buildNodes.size());
+    _edges.reserve(_buildNodes.size());
+    for (const auto& buildNode : _buildNodes)
+    {
+
+        // Add the node's (already sorted) children as a contiguous run of edges
+        _nodes.push_back(Node{buildNode.exactHandler, buildNode.argHandler,
+                _edges.size(), buildNode.children.size()});
+        for (const auto& child : buildNode.children)
+            _edges.push_back(Edge{child.first, child.second});
+    }
+    _roots = _buildRoots;
+}
+
+/**
+ * Function used to find the handler for the given method and path,
+ * preferring an exact match and then the route with the longest
+ * prefix which captures the rest of the path as its argument
+ *
+ * @param method Integer representing the request's (HTTP) method
+ * @param path String View representing the request's path
+ * @param handlerIndex Unsigned Long set to the matching route's handler
+ * @param argument String View set to the captured argument (if any)
+ * @return Boolean indicating whether a matching route was found
+ */
+bool RouteTable::find(int method, std::string_view path, unsigned long& handlerIndex,
+        std::string_view& argument) const
+{
+
+    // Only continue for absolute paths on methods with routes
+    if ((method < 0) || ((unsigned long) method >= _roots.size())
+            || (_roots[method] < 0) || path.empty() || (path[0] != '/'))
+        return false;
+
+    // Walk down the tree one segment at a time, keeping track of the
+    // deepest route which can capture the rest of the path
+    const Node* node = &_nodes[_roots[method]];
+    const Node* argNode = nullptr;
+    std::string_view::size_type argStart = 0;
+    std::string_view::size_type segmentStart = 1;
+    bool isExact = (path.size() == 1);
+    while (!isExact)
+    {
+
+        // Any route on this node with an argument captures the rest of the path
+        if (node->argHandler >= 0)
+        {
+            argNode = node;
+            argStart = segmentStart;
+        }
+
+        // Find the child for the next segment by binary searching the node's edges
+        auto segmentEnd = path.find('/', segmentStart);
+        auto segment = path.substr(segmentStart, (segmentEnd == std::string_view::npos
+                ? std::string_view::npos : (segmentEnd - segmentStart)));
+        auto edgesStart = (_edges.begin() + node->edgeStart);
+        auto edgesEnd = (edgesStart + node->edgeCount);
+        auto edgeIter = std::lower_bound(edgesStart, edgesEnd, segment,
+            [](const Edge& edge, std::string_view segment)
+            {
+                return (std::string_view(edge.segment) < segment);
+            });
+        if ((edgeIter == edgesEnd) || (std::string_view(edgeIter->segment) != segment))
+            break;
+
+        // Move onto the child (which is an exact match at the end of the path)
+        node = &_nodes[edgeIter->child];
+        isExact = (segmentEnd == std::string_view::npos);
+        segmentStart = (segmentEnd + 1);
+    }
+
+    // Return the exact route if there is one
+    if (isExact && (node->exactHandler >= 0))
+    {
+        handlerIndex = (unsigned long) node->exactHandler;
+        argument = std::string_view();
+        return true;
+    }
+
+    // Otherwise return the deepest route capturing the rest of the path
+    if (argNode != nullptr)
+    {
+        handlerIndex = (unsigned long) argNode->argHandler;
+        argument = path.substr(argStart);
+        return true;
+    }
+
+    // Return that no route was found
+    return false;
+}
+
+/**
+ * Function used to get the number of routes added to the table
+ *
+ * @return Unsigned Long representing the number of routes
+ */
+unsigned long RouteTable::getRouteCount() const
+{
+
+    // Return the number of routes
+    return _routeCount;
+}
@@ -0,0 +1,119 @@
+/* This file is part of bit-quark.
+ *
+ * Copyright (c) BitBoson
+ *
+ * bit-quark is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bit-quark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bit-quark.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+
+#ifndef BITQUARK_ROUTETABLE_H
+#define BITQUARK_ROUTETABLE_H
+
+#include <map>
+#include <string>
+#include <vector>
+#include <string_view>
+
+namespace BitBoson::BitQuark
+{
+
+    class RouteTable
+    {
+
+        // Private structures
+        private:
+            struct BuildNode
+            {
+                long exactHandler;
+                long argHandler;
+                std::map<std::string, unsigned long> children;
+            };
+            struct Node
+            {
+                long exactHandler;
+                long argHandler;
+                unsigned long edgeStart;
+                unsigned long edgeCount;
+            };
+            struct Edge
+            {
+                std::string segment;
+                unsigned long child;
+            };
+
+        // Private member variables
+        private:
+            std::vector<long> _roots;
+            std::vector<Node> _nodes;
+            std::vector<Edge> _edges;
+            std::vector<long> _buildRoots;
+            std::vector<BuildNode> _buildNodes;
+            unsigned long _routeCount;
+
+        // Public member functions
+        public:
+
+            /**
+             * Constructor used to setup the (empty) route table
+             */
+            RouteTable();
+
+            /**
+             * Function used to add a route to the table
+             * NOTE: The route is only used for look-ups once the table is compiled
+             *
+             * @param method Integer representing the route's (HTTP) method
+             * @param route String representing the route's path
+             * @param hasArgument Boolean indicating whether the route captures
+             *                    the trailing portion of the path as an argument
+             * @param handlerIndex Unsigned Long representing the route's handler
+             */
+            void addRoute(int method, const std::string& route, bool hasArgument,
+                    unsigned long handlerIndex);
+
+            /**
+             * Function used to compile the added routes into a flat (radix) tree
+             * of path segments where each node's children are stored contiguously
+             * and sorted for binary searching
+             */
+            void compile();
+
+            /**
+             * Function used to find the handler for the given method and path,
+             * preferring an exact match and then the route with the longest
+             * prefix which captures the rest of the path as its argument
+             *
+             * @param method Integer representing the request's (HTTP) method
+             * @param path String View representing the request's path
+             * @param handlerIndex Unsigned Long set to the matching route's handler
+             * @param argument String View set to the captured argument (if any)
+             * @return Boolean indicating whether a matching route was found
+             */
+            bool find(int method, std::string_view path, unsigned long& handlerIndex,
+                    std::string_view& argument) const;
+
+            /**
+             * Function used to get the number of routes added to the table
+             *
+             * @return Unsigned Long representing the number of routes
+             */
+            unsigned long getRouteCount() const;
+    };
+}
+
+#endif //BITQUARK_ROUTETABLE_H
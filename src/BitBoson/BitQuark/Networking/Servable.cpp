@@ -20,15 +20,17 @@
  */
 
 #include <iostream>
+#include <map>
 #include <mutex>
 #include <string>
+#include <string_view>
 #include <regex>
+#include <chrono>
+#include <algorithm>
 #include <thread>
 #include <functional>
 #include <unordered_map>
-#include <rapidjson/document.h>
-#include <rapidjson/writer.h>
-#include <rapidjson/stringbuffer.h>
+#include <condition_variable>
 #include <corvusoft/restbed/service.hpp>
 #include <corvusoft/restbed/session.hpp>
 #include <corvusoft/restbed/request.hpp>
@@ -36,6 +38,14 @@
 #include <corvusoft/restbed/resource.hpp>
 #include <corvusoft/restbed/settings.hpp>
 #include <BitBoson/BitQuark/Networking/Servable.h>
+#include <BitBoson/BitQuark/Networking/JsonCodec.h>
+#include <BitBoson/BitQuark/Networking/Compression.h>
+#include <BitBoson/BitQuark/Networking/BinaryCodec.h>
+#include <BitBoson/BitQuark/Networking/BinaryServer.h>
+#include <BitBoson/BitQuark/Networking/BinaryClient.h>
+#include <BitBoson/BitQuark/Networking/RouteMetrics.h>
+#include <BitBoson/BitQuark/Networking/RouteTable.h>
+#include <BitBoson/BitQuark/Networking/AdmissionController.h>
 
 using namespace BitBoson;
 using namespace BitBoson::BitQuark;
@@ -44,6 +54,7 @@ using namespace BitBoson::BitQuark;
  * Constructor used to setup the servable instace
  *
  * @param port Integer representing the port to listen on
+ *             (or zero to only serve the local transports)
  * @param isAuthenticated Boolean indicating whether the REST API
  *                        requires authentication or not
  */
@@ -59,10 +70,66 @@ Servable::Servable(int port, bool isAuthenticated)
     // Setup the settings object
     _settings = std::make_shared<restbed::Settings>();
     _settings->set_port(port);
-    _settings->set_default_header("Connection", "close");
+    _settings->set_connection_timeout(std::chrono::milliseconds(30000));
 
-    // Setup the service object
+    // Setup the options shared by all listeners, using persistent (keep-alive)
+    // connections, a 100 KiB body limit and compressing bodies over 1 KiB by default
+    _listenerOptions = std::make_shared<ListenerOptions>();
+    _listenerOptions->keepAlive = true;
+    _listenerOptions->maxBodySize = (100 * 1024);
+    _listenerOptions->compressionThreshold = 1024;
+    _listenerOptions->admissionController = std::make_shared<AdmissionController>();
+
+    // Setup the service object, dispatching all of the listeners' requests
+    // through the (compiled) route table rather than per-resource path matching
+    auto httpRoutes = std::make_shared<HttpRoutes>();
+    _httpRoutes = httpRoutes;
     _service = std::make_shared<restbed::Service>();
+    _service->set_not_found_handler(
+        [httpRoutes](const std::shared_ptr<restbed::Session> session)
+        {
+            routeHandlerFunction(session, httpRoutes);
+        });
+
+    // Setup the (initially disabled) binary and local transports for the routes
+    auto binaryRoutes = std::make_shared<BinaryRoutes>();
+    _binaryPort = 0;
+    binaryRoutes->localRoutePrefix = "/";
+    binaryRoutes->admissionController = _listenerOptions->admissionController;
+    binaryRoutes->inProcessCalls = 0;
+    binaryRoutes->inProcessOpen = false;
+    _binaryRoutes = binaryRoutes;
+    _binaryServer = std::make_shared<BinaryServer>(
+        [binaryRoutes](const char* data, unsigned long size) -> std::string
+        {
+            return binaryHandlerFunction(data, size, binaryRoutes, binaryRoutes->routePrefix);
+        });
+    _binaryServer->setMaxFrameSize(_listenerOptions->maxBodySize);
+    _unixServer = std::make_shared<BinaryServer>(
+        [binaryRoutes](const char* data, unsigned long size) -> std::string
+        {
+            return binaryHandlerFunction(data, size, binaryRoutes, binaryRoutes->localRoutePrefix);
+        });
+    _unixServer->setMaxFrameSize(_listenerOptions->maxBodySize);
+
+    // Setup the per-route metrics and serve them in the Prometheus text format
+    auto routeMetrics = std::make_shared<RouteMetrics>();
+    auto metricsResource = std::make_shared<restbed::Resource>();
+    auto listenerOptions = _listenerOptions;
+    _routeMetrics = routeMetrics;
+    metricsResource->set_path("/metrics");
+    metricsResource->set_method_handler("GET",
+        [routeMetrics, listenerOptions](const std::shared_ptr<restbed::Session> session)
+    {
+        auto request = session->get_request();
+        auto metricsString = (routeMetrics->toPrometheus()
+                + listenerOptions->admissionController->toPrometheus());
+        auto contentEncoding = compressResponseBody(request->get_header("Accept-Encoding", std::string()),
+                listenerOptions, metricsString);
+        respond(session, 200, metricsString, shouldKeepAlive(request, listenerOptions),
+                "text/plain; version=0.0.4", contentEncoding);
+    });
+    _service->publish(metricsResource);
 
     // Add-in authentication (if desired)
     // TODO: Implement authentication handler
@@ -80,10 +147,15 @@ Servable::Servable(int port, bool isAuthenticated)
  * NOTE: This is a non-blocking operation
  *
  * @param workerThreads Integer represeting the number of threads
+ * @return Boolean indicating whether the service was started with all of
+ *         its enabled transports listening (false if any failed to bind)
  */
-void Servable::start(int workerThreads)
+bool Servable::start(int workerThreads)
 {
 
+    // Create a return flag
+    bool retFlag = false;
+
     // Lock the thread for safe operation
     std::unique_lock<std::mutex> lock(_lock);
 
@@ -93,21 +165,51 @@ void Servable::start(int workerThreads)
     {
 
         // Setup the concurrency logic for multi-threading
-        // TODO: Implement actual concurrency - results in sanitize-thread data race errors
-        //unsigned int numThreads = (workerThreads <= 0 ? std::thread::hardware_concurrency() : workerThreads);
-        //numThreads = (numThreads <= 0 ? 4 : numThreads);
-        //_settings->set_worker_limit(numThreads);
+        // NOTE: Every handler owns its own copy of the request state, so
+        //       the only shared state is what the handlers themselves lock
+        unsigned int numThreads = (workerThreads <= 0 ? std::thread::hardware_concurrency() : workerThreads);
+        numThreads = (numThreads <= 0 ? 4 : numThreads);
+        _settings->set_worker_limit(numThreads);
 
         // Setup the running variable as true
         _isRunning->setValue(true);
 
-        // Actually start the server using the background thread
-        _backgroundThread = std::make_shared<std::thread>(
-            [this]()
+        // Compile the route tables now that all of the listeners have been added
+        _httpRoutes->routeTable.compile();
+        _binaryRoutes->routeTable.compile();
+
+        // Start the binary and local transports (if desired) alongside the server
+        // keeping track of whether any of them failed to start (ie. to bind)
+        retFlag = true;
+        if (_binaryPort > 0)
+            retFlag = (_binaryServer->start(_binaryPort) && retFlag);
+        if (!_unixSocketPath.empty())
+            retFlag = (_unixServer->startUnix(_unixSocketPath) && retFlag);
+        if (!_inProcessName.empty())
+        {
+            auto& registry = getInProcessRegistry();
+            std::unique_lock<std::mutex> registryLock(registry.lock);
+            if (registry.servables.emplace(_inProcessName, _binaryRoutes).second)
             {
-                _service->start(_settings);
-            });
+                std::unique_lock<std::mutex> inProcessLock(_binaryRoutes->inProcessLock);
+                _binaryRoutes->inProcessOpen = true;
+            }
+            else
+                retFlag = false;
+        }
+
+        // Actually start the server using the background thread
+        // NOTE: The server is only started if there is a port to listen on
+        if (_port > 0)
+            _backgroundThread = std::make_shared<std::thread>(
+                [this]()
+                {
+                    _service->start(_settings);
+                });
     }
+
+    // Return the return flag
+    return retFlag;
 }
 
 /**
@@ -128,106 +230,524 @@ void Servable::addListener(HttpMethod method, const std::string& route,
             std::unordered_map<std::string, std::string>&, const std::string&)> handlerFunction)
 {
 
-    // Create the rest-bed method handler resource
-    auto resource = std::make_shared<restbed::Resource>();
+    // Add the listener, only handing the string body values to the handler
+    addListenerResource(method, route, routeArg,
+        [handlerFunction](std::unordered_map<std::string, std::string>& headers,
+            std::unordered_map<std::string, std::string>& body, Payload& typedBody,
+            const std::string& routeArg) -> ResponseObj
+        {
+            return handlerFunction(headers, body, routeArg);
+        });
+}
 
-    // Setup the path (including the route-argument if desired)
-    if (routeArg.empty())
-        resource->set_path(route);
-    else
-        resource->set_path(route + "/{" + routeArg + ": .*}");
+/**
+ * Function used to add a typed Http Listener route to the servable
+ * NOTE: The handler is given the entire request body as a (typed) payload
+ *       object including all of its string, numeric and nested members
+ *
+ * @param method HttpMethod indicating the method to add the
+ *               listener onto
+ * @param route String representing the route to add the
+ *               listener onto
+ * @param routeArg String representing the trailing route-argument
+ *                 to use as a part of the processing
+ * @param handlerFunction Callback Function used to handle
+ *                        all requests made on this new route
+ */
+void Servable::addTypedListener(HttpMethod method, const std::string& route,
+        const std::string& routeArg,
+        std::function<ResponseObj(std::unordered_map<std::string, std::string>&,
+            Payload&, const std::string&)> handlerFunction)
+{
 
-    // Setup the resource to handle GET requests if desired
-    if (method == HttpMethod::GET)
-        resource->set_method_handler("GET",
-            [handlerFunction, routeArg](const std::shared_ptr<restbed::Session> session)
+    // Add the listener, merging the string body values back into the payload
+    addListenerResource(method, route, routeArg,
+        [handlerFunction](std::unordered_map<std::string, std::string>& headers,
+            std::unordered_map<std::string, std::string>& body, Payload& typedBody,
+            const std::string& routeArg) -> ResponseObj
         {
-            genericHandlerFunction(session, routeArg, handlerFunction);
+            if (typedBody.isNull())
+                typedBody = Payload::object();
+            for (const auto& bodyItem : body)
+                typedBody.addMember(bodyItem.first, bodyItem.second);
+            return handlerFunction(headers, typedBody, routeArg);
         });
+}
+
+/**
+ * Internal function used to add the Rest-Bed resource for a Http Listener route
+ *
+ * @param method HttpMethod indicating the method to add the
+ *               listener onto
+ * @param route String representing the route to add the
+ *               listener onto
+ * @param routeArg String representing the trailing route-argument
+ *                 to use as a part of the processing
+ * @param handlerFunction Callback Function used to handle
+ *                        all requests made on this new route
+ */
+void Servable::addListenerResource(HttpMethod method, const std::string& route,
+        const std::string& routeArg,
+        std::function<ResponseObj(std::unordered_map<std::string, std::string>&,
+            std::unordered_map<std::string, std::string>&, Payload&, const std::string&)> handlerFunction)
+{
 
-    // Setup the resource to handle POST requests if desired
-    else if (method == HttpMethod::POST)
-        resource->set_method_handler("POST",
-            [handlerFunction, routeArg](const std::shared_ptr<restbed::Session> session)
+    // Setup the metrics for the route (shared by all of its transports)
+    auto routeStats = _routeMetrics->addRoute((method == HttpMethod::GET ? "GET" : "POST"),
+            (routeArg.empty() ? route : (route + "/{" + routeArg + "}")));
+
+    // Setup the admission class for the route (shared by all of its transports)
+    auto routeClass = AdmissionController::classify(route);
+
+    // Add the route to the route table for the HTTP requests
+    // NOTE: Routes are only added before the service is started
+    //       so the route tables are never modified while in use
+    auto listenerOptions = _listenerOptions;
+    _httpRoutes->routeTable.addRoute(method, route, !routeArg.empty(), _httpRoutes->handlers.size());
+    _httpRoutes->handlers.push_back(
+        [handlerFunction, listenerOptions, routeStats, routeClass]
+            (const std::shared_ptr<restbed::Session> session, const std::string& routeArgVal)
         {
-            genericHandlerFunction(session, routeArg, handlerFunction);
+            genericHandlerFunction(session, routeArgVal, listenerOptions,
+                    routeStats, routeClass, handlerFunction);
         });
 
-    // Add the resource to the service
-    _service->publish(resource);
+    // Add the route for the binary transport as well
+    _binaryRoutes->routeTable.addRoute(method, route, !routeArg.empty(), _binaryRoutes->routes.size());
+    _binaryRoutes->routes.push_back(BinaryRoute{handlerFunction, routeStats, routeClass});
 }
 
 /**
- * Internal static function used to handle the request with all boilder-plate operations
+ * Function used to add a streaming Http Listener route to the servable
+ * NOTE: The stream function is called once per request to setup the
+ *       handlers which are then given the (raw) request body in chunks
+ *       as they arrive followed by a call to complete the request
  *
- * @param session Sessing representing the Rest-Bed session object
+ * @param method HttpMethod indicating the method to add the
+ *               listener onto
+ * @param route String representing the route to add the
+ *               listener onto
  * @param routeArg String representing the trailing route-argument
  *                 to use as a part of the processing
+ * @param streamFunction Callback Function used to setup the stream
+ *                       handlers for each request on this new route
+ * @param maxBodySize Long representing the maximum body size in bytes
+ *                    (or a negative value to use the servable's limit)
+ */
+void Servable::addStreamingListener(HttpMethod method, const std::string& route,
+        const std::string& routeArg,
+        std::function<StreamObj(std::unordered_map<std::string, std::string>&,
+            const std::string&)> streamFunction, long maxBodySize)
+{
+
+    // Add the route to the route table for the HTTP requests
+    auto listenerOptions = _listenerOptions;
+    _httpRoutes->routeTable.addRoute(method, route, !routeArg.empty(), _httpRoutes->handlers.size());
+    _httpRoutes->handlers.push_back(
+        [streamFunction, listenerOptions, maxBodySize]
+            (const std::shared_ptr<restbed::Session> session, const std::string& routeArgVal)
+        {
+            streamingHandlerFunction(session, routeArgVal, listenerOptions, maxBodySize, streamFunction);
+        });
+}
+
+/**
+ * Function used to enable or disable persistent (keep-alive) connections
+ * NOTE: The idle timeout only applies if set before the service is started
+ *
+ * @param keepAlive Boolean indicating whether to keep connections alive
+ * @param idleTimeout Integer representing the time (in milliseconds) an
+ *                    idle connection is kept open waiting for a request
+ */
+void Servable::setKeepAlive(bool keepAlive, int idleTimeout)
+{
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_lock);
+
+    // Setup the keep-alive values accordingly
+    _listenerOptions->keepAlive = keepAlive;
+    _settings->set_connection_timeout(std::chrono::milliseconds(idleTimeout));
+}
+
+/**
+ * Function used to set the maximum request body size for (non-streaming)
+ * listeners which do not specify their own limit
+ *
+ * @param maxBodySize Long representing the maximum body size in bytes
+ */
+void Servable::setMaxBodySize(long maxBodySize)
+{
+
+    // Setup the maximum body size (ensuring it is not negative)
+    _listenerOptions->maxBodySize = (maxBodySize < 0 ? 0 : maxBodySize);
+    _binaryServer->setMaxFrameSize(_listenerOptions->maxBodySize);
+    _unixServer->setMaxFrameSize(_listenerOptions->maxBodySize);
+}
+
+/**
+ * Function used to set the size above which (non-streaming) response
+ * bodies are compressed for clients which accept gzip or deflate
+ *
+ * @param compressionThreshold Long representing the threshold in bytes
+ *                             (or a negative value to disable compression)
+ */
+void Servable::setCompressionThreshold(long compressionThreshold)
+{
+
+    // Setup the compression threshold
+    _listenerOptions->compressionThreshold = compressionThreshold;
+}
+
+/**
+ * Function used to additionally serve the (non-streaming) routes under
+ * the given prefix using the binary (length-prefixed frame) transport
+ * over persistent connections on a separate port
+ * NOTE: This only applies if set before the service is started
+ *
+ * @param port Integer representing the port to serve the binary transport on
+ * @param routePrefix String representing the prefix of the routes to serve
+ */
+void Servable::enableBinaryTransport(int port, const std::string& routePrefix)
+{
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_lock);
+
+    // Setup the binary transport values accordingly
+    _binaryPort = port;
+    _binaryRoutes->routePrefix = routePrefix;
+}
+
+/**
+ * Function used to additionally serve the (non-streaming) routes under
+ * the given prefix using the binary transport over a Unix domain socket
+ * for co-located clients (using "unix://" URLs)
+ * NOTE: This only applies if set before the service is started
+ *
+ * @param socketPath String representing the path of the socket file
+ * @param routePrefix String representing the prefix of the routes to serve
+ */
+void Servable::enableUnixTransport(const std::string& socketPath, const std::string& routePrefix)
+{
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_lock);
+
+    // Setup the Unix domain socket transport values accordingly
+    _unixSocketPath = socketPath;
+    _binaryRoutes->localRoutePrefix = routePrefix;
+}
+
+/**
+ * Function used to additionally serve the (non-streaming) routes under
+ * the given prefix to clients in the same process (using "inproc://" URLs)
+ * by calling the handlers directly without encoding or decoding the bodies
+ * NOTE: This only applies if set before the service is started
+ *
+ * @param name String representing the name to register the servable as
+ * @param routePrefix String representing the prefix of the routes to serve
+ */
+void Servable::enableInProcessTransport(const std::string& name, const std::string& routePrefix)
+{
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_lock);
+
+    // Setup the in-process transport values accordingly
+    _inProcessName = name;
+    _binaryRoutes->localRoutePrefix = routePrefix;
+}
+
+/**
+ * Function used to serve all (non-streaming) routes using the local
+ * transport described by the given URL (ie. "unix://%2Ftmp%2Fa.sock"
+ * or "inproc://name") if it is a local transport URL
+ * NOTE: This only applies if set before the service is started
+ *
+ * @param url String representing the (base) URL to serve the routes on
+ * @return Boolean indicating whether the URL was a local transport URL
+ */
+bool Servable::enableLocalTransport(const std::string& url)
+{
+
+    // Serve the in-process transport under the URL's name
+    std::string destination;
+    std::string path;
+    if (isInProcessUrl(url))
+    {
+        auto nameEnd = url.find('/', 9);
+        enableInProcessTransport(url.substr(9, (nameEnd == std::string::npos
+                ? std::string::npos : (nameEnd - 9))));
+        return true;
+    }
+
+    // Serve the Unix domain socket transport at the URL's (decoded) socket path
+    if ((url.compare(0, 7, "unix://") == 0) && BinaryClient::splitUrl(url, destination, path))
+    {
+        enableUnixTransport(destination.substr(5));
+        return true;
+    }
+
+    // Return that the URL was not for a local transport
+    return false;
+}
+
+/**
+ * Static function used to determine whether the URL uses the in-process transport
+ *
+ * @param url String representing the URL/URI to check
+ * @return Boolean indicating whether the URL uses the in-process transport
+ */
+bool Servable::isInProcessUrl(const std::string& url)
+{
+
+    // Return whether the URL uses the in-process scheme
+    return (url.compare(0, 9, "inproc://") == 0);
+}
+
+/**
+ * Static function used to make a request on a servable in this
+ * process by calling its handler directly
+ * NOTE: The bodies are handed to the handler (which may modify them)
+ *       so they are taken by rvalue reference and never copied here
+ *
+ * @param method Servable HTTP Method indicating the method to use
+ * @param url String representing the (in-process) URL/URI for the request
+ * @param body Unordered String-String map representing the string values
+ * @param data Payload representing the typed (object) members
+ * @param transportFailed Boolean set to indicate no servable was found
+ * @return Servable Response-Object representing the response information
+ */
+Servable::ResponseObj Servable::invokeInProcess(HttpMethod method, const std::string& url,
+        std::unordered_map<std::string, std::string>&& body, Payload&& data,
+        bool& transportFailed)
+{
+
+    // Split the URL into the servable's name and the path
+    std::shared_ptr<BinaryRoutes> binaryRoutes = nullptr;
+    transportFailed = true;
+    if (!isInProcessUrl(url))
+        return ResponseObj{400, {{"Status", "Error"}, {"Message", "In-Process Request Failed"}}, Payload()};
+    auto pathStart = url.find('/', 9);
+    auto name = url.substr(9, (pathStart == std::string::npos ? std::string::npos : (pathStart - 9)));
+    auto path = (pathStart == std::string::npos ? "/" : url.substr(pathStart));
+
+    // Find the servable and mark the call as in-flight so it
+    // cannot be stopped until the call has completed
+    // NOTE: Do this in a separate context to leverage RAII for the mutex/lock
+    {
+        auto& registry = getInProcessRegistry();
+        std::unique_lock<std::mutex> registryLock(registry.lock);
+        auto servableIter = registry.servables.find(name);
+        if (servableIter != registry.servables.end())
+        {
+            std::unique_lock<std::mutex> inProcessLock(servableIter->second->inProcessLock);
+            if (servableIter->second->inProcessOpen)
+            {
+                servableIter->second->inProcessCalls++;
+                binaryRoutes = servableIter->second;
+            }
+        }
+    }
+
+    // Return a failure if there is no such servable being served
+    if (binaryRoutes == nullptr)
+        return ResponseObj{400, {{"Status", "Error"}, {"Message", "In-Process Request Failed"}}, Payload()};
+    transportFailed = false;
+
+    // Call the handler directly on the caller's bodies (without copying them)
+    auto response = dispatchRoute(binaryRoutes, binaryRoutes->localRoutePrefix,
+            method, path, body, data, 0, nullptr);
+
+    // Indicate that the call has completed
+    std::unique_lock<std::mutex> inProcessLock(binaryRoutes->inProcessLock);
+    binaryRoutes->inProcessCalls--;
+    binaryRoutes->inProcessDrained.notify_all();
+    return response;
+}
+
+/**
+ * Function used to get the per-route metrics (latencies, response
+ * codes, body sizes, etc) collected for the servable's listeners
+ * NOTE: These are also served in the Prometheus text format on "/metrics"
+ *
+ * @return Route Metrics (pointer) for the servable's listeners
+ */
+std::shared_ptr<RouteMetrics> Servable::getRouteMetrics()
+{
+
+    // Return the route metrics
+    return _routeMetrics;
+}
+
+/**
+ * Function used to get the admission controller used to limit the number
+ * of requests handled at once (by route class) and shed the excess
+ * NOTE: Nothing is limited until the controller's limits are set
+ *
+ * @return Admission Controller (pointer) for the servable's listeners
+ */
+std::shared_ptr<AdmissionController> Servable::getAdmissionController()
+{
+
+    // Return the admission controller
+    return _listenerOptions->admissionController;
+}
+
+/**
+ * Internal static function used to dispatch a request to the handler of
+ * the matching route in the (compiled) route table
+ *
+ * @param session Session representing the Rest-Bed session object
+ * @param httpRoutes HTTP Routes representing the routes being served
+ */
+void Servable::routeHandlerFunction(const std::shared_ptr<restbed::Session> session,
+        std::shared_ptr<HttpRoutes> httpRoutes)
+{
+
+    // Find the route for the request's method and path (and its route-argument)
+    const auto request = session->get_request();
+    const auto& methodString = request->get_method();
+    int method = (methodString == "GET" ? HttpMethod::GET : (methodString == "POST" ? HttpMethod::POST : -1));
+    auto path = request->get_path();
+    unsigned long routeIndex = 0;
+    std::string_view routeArgVal;
+    if (!httpRoutes->routeTable.find(method, path, routeIndex, routeArgVal))
+    {
+
+        // Return an error if no route matches (closing the connection
+        // since the request's body is never read)
+        respond(session, 404, "{\"Status\":\"Error\",\"Message\":\"Route Not Found\"}", false);
+        return;
+    }
+
+    // Actually have the route's handler handle the request
+    httpRoutes->handlers[routeIndex](session, std::string(routeArgVal));
+}
+
+/**
+ * Internal static function used to handle the request with all boilder-plate operations
+ *
+ * @param session Sessing representing the Rest-Bed session object
+ * @param routeArgVal String representing the value of the trailing
+ *                    route-argument (if any) captured by the route table
+ * @param listenerOptions Listener Options shared by all of the servable's listeners
+ * @param routeStats Route Stats used to record the request's metrics
+ * @param routeClass Route Class used to admit the request
  * @param handlerFunction Handler function (pointer) used to handle the request
  */
 void Servable::genericHandlerFunction(
-    const std::shared_ptr<restbed::Session> session, const std::string& routeArg,
+    const std::shared_ptr<restbed::Session> session, const std::string& routeArgVal,
+    std::shared_ptr<ListenerOptions> listenerOptions,
+    std::shared_ptr<RouteMetrics::RouteStats> routeStats,
+    AdmissionController::RouteClass routeClass,
     std::function<ResponseObj(std::unordered_map<std::string, std::string>&,
-        std::unordered_map<std::string, std::string>&, const std::string&)> handlerFunction)
+        std::unordered_map<std::string, std::string>&, Payload&, const std::string&)> handlerFunction)
 {
 
+    // Track the request (including reading its body) as in-flight
+    auto startTime = std::chrono::steady_clock::now();
+    RouteMetrics::recordStart(*routeStats);
+
     // Extract the request information from the session object
     const auto request = session->get_request();
 
     // Parse all standard header-items
-    int contentLength = request->get_header("Content-Length", 0);
+    long contentLength = request->get_header("Content-Length", 0L);
 
     // Mark the request as invalid if it was too large and trim it
     bool wasTooLarge = false;
-    if (contentLength > (100 * 1024))
+    long maxBodySize = listenerOptions->maxBodySize;
+    if (contentLength > maxBodySize)
     {
         wasTooLarge = true;
-        contentLength = (100 * 1024);
+        contentLength = maxBodySize;
     }
 
-    // Extract the route-argument if it was specified
-    std::string routeArgVal;
-    if (!routeArg.empty())
-        routeArgVal = request->get_path_parameter(routeArg);
+    // Mark the request as invalid if its body length is unknown (chunked)
+    // NOTE: Nothing is read since the body cannot be framed without a length
+    bool wasLengthMissing = isLengthRequired(request);
+    if (wasLengthMissing)
+        contentLength = 0;
 
     // Get all of the provided header values
     std::unordered_map<std::string, std::string> headerValues;
     for (const auto& headerItem : request->get_headers())
         headerValues[headerItem.first] = headerItem.second;
 
+    // Determine whether the connection should be kept alive after responding
+    // and which encodings the response can be compressed with
+    bool keepConnectionAlive = shouldKeepAlive(request, listenerOptions);
+    auto acceptEncoding = request->get_header("Accept-Encoding", std::string());
+
     // Actually have the session handle the request
+    // NOTE: The fetch callback can run on a different worker thread after
+    //       this function returns, so all request state is captured by value
     session->fetch(contentLength,
-        [handlerFunction, &headerValues, wasTooLarge, routeArgVal]
-            (const std::shared_ptr<restbed::Session> session, const restbed::Bytes& body)
+        [handlerFunction, headerValues, wasTooLarge, wasLengthMissing, routeArgVal, keepConnectionAlive,
+            acceptEncoding, routeStats, startTime, routeClass, listenerOptions]
+            (const std::shared_ptr<restbed::Session> session, const restbed::Bytes& body) mutable
     {
 
+        // Keep track of the response for the request's metrics
+        int responseCode = 500;
+        unsigned long responseBytes = 0;
+        unsigned long requestBytes = body.size();
+
+        // Setup the function used to finish-up the request once it has been responded to
+        auto finishRequest = [keepConnectionAlive, routeStats, startTime, requestBytes]
+                (const std::shared_ptr<restbed::Session>& session, int responseCode,
+                    unsigned long responseBytes)
+        {
+
+            // Ensure that the session is closed (unless it was kept alive)
+            if (session->is_open() && !keepConnectionAlive)
+            {
+                std::string returnJson = "Invalid HTTP Request: Internal Error";
+                session->close(500, returnJson,
+                    {{"Content-Length", std::to_string(returnJson.size())}});
+            }
+
+            // Record the completed request's metrics
+            RouteMetrics::recordEnd(*routeStats, responseCode, requestBytes, responseBytes, startTime);
+        };
+
         // If the request as too large, return appropriate error code
         if (wasTooLarge)
         {
             std::string returnJson = "Failed to read HTTP Request: Request Body Too Long";
             session->close(400, returnJson,
                 {{"Content-Length", std::to_string(returnJson.size())}});
+            responseCode = 400;
+            responseBytes = returnJson.size();
         }
 
-        // Only continue if the session was not too large
-        if (!wasTooLarge)
+        // If the request's body had no length, return appropriate error code
+        else if (wasLengthMissing)
         {
+            std::string returnJson = "Failed to read HTTP Request: Content-Length Required";
+            session->close(411, returnJson,
+                {{"Content-Length", std::to_string(returnJson.size())}});
+            responseCode = 411;
+            responseBytes = returnJson.size();
+        }
 
-            // Extract the JSON body from the request
-            std::string bodyDataRaw = "";
-            for (unsigned long ii = 0; ii < body.size(); ii++)
-                bodyDataRaw += body[ii];
+        // Only continue if the session was not too large (or missing its length)
+        else
+        {
 
-            // Parse the body data into a JSON object and then
-            // get all of the provided body values
+            // Parse the body data (in-place, without copying it) into a
+            // JSON object and then get all of the provided body values
             bool jsonBodyPresentAndHasErrors = false;
+            Payload typedBodyValues;
             std::unordered_map<std::string, std::string> bodyValues;
-            if (!bodyDataRaw.empty())
+            if (!body.empty())
             {
 
                 // Attempt to actually do the JSON object parsing
-                rapidjson::Document jsonDoc;
-                rapidjson::ParseResult parseResult = jsonDoc.Parse(bodyDataRaw.c_str());
+                bool parseResult = JsonCodec::decode(reinterpret_cast<const char*>(body.data()),
+                        body.size(), bodyValues, typedBodyValues);
 
                 // Handle the case where the JSON parsing was unsuccessful
                 if (!parseResult)
@@ -237,68 +757,481 @@ void Servable::genericHandlerFunction(
                     std::string returnJson = "Failed to read HTTP Request: Invalid JSON Body";
                     session->close(400, returnJson,
                         {{"Content-Length", std::to_string(returnJson.size())}});
+                    responseCode = 400;
+                    responseBytes = returnJson.size();
 
                     // Mark that there was a body with errors
                     jsonBodyPresentAndHasErrors = true;
                 }
-
-                // Handle the case where the JSON parsing was successful
-                if (parseResult)
-                {
-
-                    // Actually parse the body values for handling later
-                    for (rapidjson::Value::ConstMemberIterator itr = jsonDoc.MemberBegin();
-                            itr != jsonDoc.MemberEnd(); ++itr)
-                        if (jsonDoc[itr->name.GetString()].IsString())
-                            bodyValues[itr->name.GetString()] = jsonDoc[itr->name.GetString()].GetString();
-                }
             }
 
             // Only continue if there were no errors in parsing the JSON body (if present)
+            // NOTE: Admission happens once the body has been read so that a
+            //       dropped connection can never hold onto any capacity
+            // NOTE: Requests waiting for capacity are parked rather than holding
+            //       onto a worker thread and are resumed by a later release
             if (!jsonBodyPresentAndHasErrors)
             {
+                auto admissionController = listenerOptions->admissionController;
+                admissionController->admit(routeClass,
+                    [session, finishRequest, handlerFunction, headerValues,
+                        bodyValues = std::move(bodyValues), typedBodyValues = std::move(typedBodyValues),
+                        routeArgVal, keepConnectionAlive, acceptEncoding,
+                        routeClass, listenerOptions, admissionController](bool admitted) mutable
+                    {
 
-                // Call the underlying handler function
-                auto response = handlerFunction(headerValues, bodyValues, routeArgVal);
+                        // Shed the request, telling the caller when to try again
+                        if (!admitted)
+                        {
+                            std::string returnJson = "{\"Status\":\"Error\",\"Message\":\"Server Overloaded\"}";
+                            session->close(503, returnJson,
+                                {{"Content-Length", std::to_string(returnJson.size())},
+                                 {"Retry-After", std::to_string(admissionController->getRetryAfter())},
+                                 {"Connection", "close"}});
+                            finishRequest(session, 503, returnJson.size());
+                            return;
+                        }
 
-                // Convert the unordered map in the response to a json object string
-                std::string returnMsg;
-                for (const auto& reponseItem : response.body)
-                    returnMsg += "\"" + reponseItem.first + "\":\"" + reponseItem.second + "\",";
-                if (!returnMsg.empty())
-                {
-                    returnMsg = returnMsg.substr(0, returnMsg.size() - 1);
-                    returnMsg = "{" + returnMsg + "}";
-                }
+                        // Call the underlying handler function (unless the caller went
+                        // away while it was parked) releasing its capacity when done
+                        // NOTE: Errors are not propagated since this may be resumed
+                        //       from the release of an unrelated request
+                        int responseCode = 500;
+                        unsigned long responseBytes = 0;
+                        try
+                        {
+                            AdmissionController::Guard admissionGuard(*admissionController, routeClass);
+                            if (session->is_open())
+                            {
+
+                                // Call the underlying handler function
+                                auto response = handlerFunction(headerValues, bodyValues,
+                                        typedBodyValues, routeArgVal);
 
-                // Close the session object with the return information for the function
-                session->close(response.code, returnMsg,
-                    {{"Content-Length", std::to_string(returnMsg.size())}});
+                                // Respond with the (possibly compressed) return information for the
+                                // function, either keeping the connection alive for the next request
+                                // or closing it
+                                auto responseString = getResponseString(response);
+                                auto contentEncoding = compressResponseBody(acceptEncoding,
+                                        listenerOptions, responseString);
+                                respond(session, response.code, responseString, keepConnectionAlive,
+                                        "", contentEncoding);
+                                responseCode = response.code;
+                                responseBytes = responseString.size();
+                            }
+                        }
+                        catch (...)
+                        {
+
+                            // Respond with an error (closing the connection, even if it
+                            // would otherwise be kept alive) so the caller is not left waiting
+                            std::string returnJson = "Invalid HTTP Request: Internal Error";
+                            if (session->is_open())
+                                session->close(500, returnJson,
+                                    {{"Content-Length", std::to_string(returnJson.size())}});
+                            responseCode = 500;
+                            responseBytes = returnJson.size();
+                        }
+                        finishRequest(session, responseCode, responseBytes);
+                    });
+                return;
             }
         }
 
-        // Ensure that the session is closed
-        if (session->is_open())
-        {
-            std::string returnJson = "Invalid HTTP Request: Internal Error";
-            session->close(500, returnJson,
-                {{"Content-Length", std::to_string(returnJson.size())}});
-        }
+        // Finish-up the request (which was not handled)
+        finishRequest(session, responseCode, responseBytes);
     });
 }
 
 /**
- * Destructor used to cleanup the instance and stop
- * all background processes if they are running
+ * Internal static function used to handle a binary transport request
+ * frame with all boiler-plate operations
+ *
+ * @param data Character Array representing the request frame contents
+ * @param size Unsigned Long representing the size of the frame contents
+ * @param binaryRoutes Binary Routes representing the routes being served
+ * @param routePrefix String representing the prefix of the routes to serve
+ * @return String representing the response frame to send back
  */
-Servable::~Servable()
+std::string Servable::binaryHandlerFunction(const char* data, unsigned long size,
+        std::shared_ptr<BinaryRoutes> binaryRoutes, const std::string& routePrefix)
+{
+
+    // Decode the request frame (in-place, without copying it)
+    int method = 0;
+    std::string path;
+    Payload typedBodyValues;
+    std::unordered_map<std::string, std::string> bodyValues;
+    if (!BinaryCodec::decodeRequest(data, size, method, path, bodyValues, typedBodyValues))
+        return BinaryCodec::encodeResponse(400,
+                {{"Status", "Error"}, {"Message", "Invalid Binary Request"}}, Payload());
+
+    // Handle the request and return its (encoded) response frame
+    std::string responseFrame;
+    dispatchRoute(binaryRoutes, routePrefix, method, path, bodyValues, typedBodyValues, size, &responseFrame);
+    return responseFrame;
+}
+
+/**
+ * Internal static function used to find the route for a (binary or
+ * in-process) request and call its handler with admission control
+ * and metrics, optionally encoding the response as a binary frame
+ *
+ * @param binaryRoutes Binary Routes representing the routes being served
+ * @param routePrefix String representing the prefix of the routes to serve
+ * @param method Integer representing the request's HTTP method
+ * @param path String representing the request's path
+ * @param bodyValues Unordered String-String map representing the string values
+ * @param typedBodyValues Payload representing the typed (object) members
+ * @param requestBytes Unsigned Long representing the size of the request
+ * @param responseFrame String to encode the response frame into (if not null)
+ * @return Servable Response-Object representing the response information
+ */
+Servable::ResponseObj Servable::dispatchRoute(const std::shared_ptr<BinaryRoutes>& binaryRoutes,
+        const std::string& routePrefix, int method, const std::string& path,
+        std::unordered_map<std::string, std::string>& bodyValues,
+        Payload& typedBodyValues, unsigned long requestBytes, std::string* responseFrame)
+{
+
+    // Find the route for the path (and its route-argument) in the route table
+    unsigned long routeIndex = 0;
+    std::string_view routeArgVal;
+    const BinaryRoute* binaryRoute = nullptr;
+    if ((path.compare(0, routePrefix.size(), routePrefix) == 0)
+            && binaryRoutes->routeTable.find(method, path, routeIndex, routeArgVal))
+        binaryRoute = &binaryRoutes->routes[routeIndex];
+
+    // Return an error if the route is not served by the transport
+    if (binaryRoute == nullptr)
+    {
+        ResponseObj response{404, {{"Status", "Error"}, {"Message", "Route Not Found"}}, Payload()};
+        if (responseFrame != nullptr)
+            *responseFrame = BinaryCodec::encodeResponse(response.code, response.body, response.data);
+        return response;
+    }
+
+    // Shed the request if it cannot be admitted, telling the caller when to try again
+    // NOTE: Otherwise call the underlying handler function (there are no headers
+    //       on the binary or in-process transports)
+    ResponseObj response;
+    auto startTime = std::chrono::steady_clock::now();
+    RouteMetrics::recordStart(*binaryRoute->routeStats);
+    // NOTE: These transports dedicate a thread to the caller so waiting for
+    //       admission here never holds onto one of the server's workers
+    auto& admissionController = binaryRoutes->admissionController;
+    if (!admissionController->admit(binaryRoute->routeClass))
+    {
+        response = ResponseObj{503, {{"Status", "Error"},
+                {"Message", "Server Overloaded"},
+                {"RetryAfter", std::to_string(admissionController->getRetryAfter())}}, Payload()};
+    }
+    else
+    {
+        AdmissionController::Guard admissionGuard(*admissionController, binaryRoute->routeClass);
+        std::unordered_map<std::string, std::string> headerValues;
+        response = binaryRoute->handlerFunction(headerValues, bodyValues, typedBodyValues,
+                std::string(routeArgVal));
+    }
+
+    // Encode the response frame (if desired) and record the request's metrics
+    unsigned long responseBytes = 0;
+    if (responseFrame != nullptr)
+    {
+        *responseFrame = BinaryCodec::encodeResponse(response.code, response.body, response.data);
+        responseBytes = (responseFrame->size() - BinaryCodec::FRAME_HEADER_SIZE);
+    }
+    RouteMetrics::recordEnd(*binaryRoute->routeStats, response.code, requestBytes, responseBytes, startTime);
+    return response;
+}
+
+/**
+ * Internal static function used to get the process-wide registry
+ * of servables served using the in-process transport
+ *
+ * @return In-Process Registry reference for the process
+ */
+Servable::InProcessRegistry& Servable::getInProcessRegistry()
+{
+
+    // Return the (lazily created) registry
+    static InProcessRegistry registry;
+    return registry;
+}
+
+/**
+ * Internal static function used to handle a streaming request with all
+ * boiler-plate operations
+ *
+ * @param session Session representing the Rest-Bed session object
+ * @param routeArgVal String representing the value of the trailing
+ *                    route-argument (if any) captured by the route table
+ * @param listenerOptions Listener Options shared by all of the servable's listeners
+ * @param maxBodySize Long representing the maximum body size in bytes
+ *                    (or a negative value to use the servable's limit)
+ * @param streamFunction Callback Function used to setup the stream handlers
+ */
+void Servable::streamingHandlerFunction(
+    const std::shared_ptr<restbed::Session> session, const std::string& routeArgVal,
+    std::shared_ptr<ListenerOptions> listenerOptions, long maxBodySize,
+    std::function<StreamObj(std::unordered_map<std::string, std::string>&,
+        const std::string&)> streamFunction)
+{
+
+    // Extract the request information from the session object
+    const auto request = session->get_request();
+
+    // Parse all standard header-items
+    long contentLength = request->get_header("Content-Length", 0L);
+    if (maxBodySize < 0)
+        maxBodySize = listenerOptions->maxBodySize;
+
+    // Reject the request outright if it is too large
+    // NOTE: The body is never read so the connection cannot be re-used
+    if (contentLength > maxBodySize)
+    {
+        std::string returnJson = "Failed to read HTTP Request: Request Body Too Long";
+        session->close(413, returnJson,
+            {{"Content-Length", std::to_string(returnJson.size())}});
+    }
+
+    // Reject the request outright if its body length is unknown (chunked)
+    else if (isLengthRequired(request))
+    {
+        std::string returnJson = "Failed to read HTTP Request: Content-Length Required";
+        session->close(411, returnJson,
+            {{"Content-Length", std::to_string(returnJson.size())}});
+    }
+
+    // Only continue if the request was not too large (or missing its length)
+    else
+    {
+
+        // Get all of the provided header values
+        std::unordered_map<std::string, std::string> headerValues;
+        for (const auto& headerItem : request->get_headers())
+            headerValues[headerItem.first] = headerItem.second;
+
+        // Setup the stream handlers for this request and start reading the body
+        auto streamObj = std::make_shared<StreamObj>(streamFunction(headerValues, routeArgVal));
+        fetchNextChunk(session, contentLength, shouldKeepAlive(request, listenerOptions), streamObj);
+    }
+}
+
+/**
+ * Internal static function used to read the next chunk of a streaming request
+ *
+ * @param session Session representing the Rest-Bed session object
+ * @param remaining Long representing the number of body bytes left to read
+ * @param keepAlive Boolean indicating whether to keep the connection alive
+ * @param streamObj Stream Object representing the request's stream handlers
+ */
+void Servable::fetchNextChunk(const std::shared_ptr<restbed::Session> session,
+        long remaining, bool keepAlive, std::shared_ptr<StreamObj> streamObj)
+{
+
+    // Complete the request once the entire body has been handled
+    if (remaining <= 0)
+    {
+        auto response = streamObj->completionHandler();
+        respond(session, response.code, getResponseString(response), keepAlive);
+    }
+
+    // Otherwise, read (at most) the next chunk of the body
+    else
+    {
+        const long chunkSize = (64 * 1024);
+        session->fetch(std::min(remaining, chunkSize),
+            [remaining, keepAlive, streamObj]
+                (const std::shared_ptr<restbed::Session> session, const restbed::Bytes& body)
+        {
+
+            // Hand the chunk to the handler as a view over the received bytes
+            auto chunk = std::string_view(reinterpret_cast<const char*>(body.data()), body.size());
+            if (body.empty() || !streamObj->chunkHandler(chunk))
+            {
+
+                // Stop reading the body if the handler rejected it
+                // NOTE: The rest of the body is never read so the
+                //       connection cannot be re-used
+                std::string returnJson = "Failed to read HTTP Request: Request Body Rejected";
+                session->close(400, returnJson,
+                    {{"Content-Length", std::to_string(returnJson.size())}});
+            }
+
+            // Continue on with the rest of the body
+            else
+            {
+                fetchNextChunk(session, (remaining - (long) body.size()), keepAlive, streamObj);
+            }
+        });
+    }
+}
+
+/**
+ * Internal static function used to determine whether the given request
+ * has a body which cannot be read since it has no Content-Length
+ * NOTE: Transfer-Coded (chunked) bodies are not decoded by the server so
+ *       these requests must be rejected rather than read as being empty
+ *
+ * @param request Request representing the Rest-Bed request object
+ * @return Boolean indicating whether the request is missing its length
+ */
+bool Servable::isLengthRequired(const std::shared_ptr<const restbed::Request> request)
+{
+
+    // Any transfer-coding other than identity means the body is not framed
+    // by its Content-Length (which must be ignored in that case anyways)
+    auto transferEncoding = request->get_header("Transfer-Encoding", std::string());
+    std::transform(transferEncoding.begin(), transferEncoding.end(),
+            transferEncoding.begin(), ::tolower);
+    return (!transferEncoding.empty() && (transferEncoding != "identity"));
+}
+
+/**
+ * Internal static function used to determine whether the connection
+ * for the given request should be kept alive after responding
+ * NOTE: HTTP/1.1 connections are persistent unless the client opts-out
+ *
+ * @param request Request representing the Rest-Bed request object
+ * @param listenerOptions Listener Options shared by all of the servable's listeners
+ * @return Boolean indicating whether to keep the connection alive
+ */
+bool Servable::shouldKeepAlive(const std::shared_ptr<const restbed::Request> request,
+        std::shared_ptr<ListenerOptions> listenerOptions)
+{
+
+    // Get the (case-insensitive) connection header
+    std::string connectionHeader = request->get_header("Connection", std::string());
+    std::transform(connectionHeader.begin(), connectionHeader.end(),
+            connectionHeader.begin(), ::tolower);
+
+    // Return whether the connection should be kept alive
+    return (listenerOptions->keepAlive
+            && ((request->get_version() >= 1.1)
+                ? (connectionHeader != "close") : (connectionHeader == "keep-alive")));
+}
+
+/**
+ * Internal static function used to convert a response object's body
+ * into the JSON string sent back to the caller
+ *
+ * @param response ResponseObj representing the response to convert
+ * @return String representing the JSON response body
+ */
+std::string Servable::getResponseString(const ResponseObj& response)
+{
+
+    // Convert the unordered map (and typed data) in the response to a json object string
+    return JsonCodec::encode(response.body, response.data);
+}
+
+/**
+ * Internal static function used to compress the response body (in-place)
+ * if the client accepts a supported encoding and the body is large enough
+ *
+ * @param acceptEncoding String representing the request's Accept-Encoding header
+ * @param listenerOptions Listener Options shared by all of the servable's listeners
+ * @param body String representing the response body to (possibly) compress
+ * @return String representing the Content-Encoding used (empty if uncompressed)
+ */
+std::string Servable::compressResponseBody(const std::string& acceptEncoding,
+        std::shared_ptr<ListenerOptions> listenerOptions, std::string& body)
+{
+
+    // Only compress bodies above the threshold for clients accepting an encoding
+    long compressionThreshold = listenerOptions->compressionThreshold;
+    if ((compressionThreshold < 0) || (body.size() <= (unsigned long) compressionThreshold)
+            || acceptEncoding.empty())
+        return "";
+    auto encoding = Compression::negotiate(acceptEncoding);
+    if (encoding == Compression::Encoding::IDENTITY)
+        return "";
+
+    // Only use the compressed body if it is actually smaller
+    std::string compressedBody;
+    if (!Compression::compress(body, encoding, compressedBody) || (compressedBody.size() >= body.size()))
+        return "";
+    body = std::move(compressedBody);
+    return Compression::getName(encoding);
+}
+
+/**
+ * Internal static function used to send the response for a request
+ *
+ * @param session Session representing the Rest-Bed session object
+ * @param code Integer representing the HTTP status code to respond with
+ * @param body String representing the response body to send
+ * @param keepAlive Boolean indicating whether to keep the connection alive
+ * @param contentType String representing the response body's content type
+ *                    (or empty to leave it unspecified)
+ * @param contentEncoding String representing the response body's encoding
+ *                        (or empty if it is not compressed)
+ */
+void Servable::respond(const std::shared_ptr<restbed::Session> session,
+        int code, const std::string& body, bool keepAlive,
+        const std::string& contentType, const std::string& contentEncoding)
+{
+
+    // Setup the response headers
+    std::multimap<std::string, std::string> headers = {
+            {"Content-Length", std::to_string(body.size())},
+            {"Connection", (keepAlive ? "keep-alive" : "close")}};
+    if (!contentType.empty())
+        headers.insert({"Content-Type", contentType});
+    if (!contentEncoding.empty())
+    {
+        headers.insert({"Content-Encoding", contentEncoding});
+        headers.insert({"Vary", "Accept-Encoding"});
+    }
+
+    // Either yield the response and keep the connection open for
+    // the next request (on the same session) or close it outright
+    if (keepAlive)
+        session->yield(code, body, headers);
+    else
+        session->close(code, body, headers);
+}
+
+/**
+ * Function used to stop the service and wait for all in-flight
+ * handlers to complete
+ * NOTE: Derived classes must call this before tearing-down any
+ *       state their handlers rely on
+ */
+void Servable::stop()
 {
 
     // Lock the thread for safe operation
     std::unique_lock<std::mutex> lock(_lock);
 
-    // Stop the background service
-    _service->stop();
+    // Stop serving in-process requests and wait for those in-flight to complete
+    // NOTE: Do this in a separate context to leverage RAII for the mutex/lock
+    if (!_inProcessName.empty())
+    {
+        auto& registry = getInProcessRegistry();
+        std::unique_lock<std::mutex> registryLock(registry.lock);
+        auto servableIter = registry.servables.find(_inProcessName);
+        if ((servableIter != registry.servables.end()) && (servableIter->second == _binaryRoutes))
+            registry.servables.erase(servableIter);
+    }
+    {
+        std::unique_lock<std::mutex> inProcessLock(_binaryRoutes->inProcessLock);
+        _binaryRoutes->inProcessOpen = false;
+        _binaryRoutes->inProcessDrained.wait(inProcessLock,
+            [this]()
+            {
+                return (_binaryRoutes->inProcessCalls == 0);
+            });
+    }
+
+    // Shed any requests still parked waiting for admission so they are
+    // not stranded, then stop the background service and binary transports
+    // NOTE: This also joins all of the service's worker threads
+    _listenerOptions->admissionController->shedParkedRequests();
+    _unixServer->stop();
+    _binaryServer->stop();
+    if (_backgroundThread != nullptr)
+        _service->stop();
 
     // Wait for the thread to complete (if it exists)
     if (_backgroundThread != nullptr)
@@ -308,3 +1241,14 @@ Servable::~Servable()
     // Indicate that the background service has stopped
     _isRunning->setValue(false);
 }
+
+/**
+ * Destructor used to cleanup the instance and stop
+ * all background processes if they are running
+ */
+Servable::~Servable()
+{
+
+    // Stop the background service (if it is still running)
+    stop();
+}
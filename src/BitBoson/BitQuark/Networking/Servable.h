@@ -23,9 +23,13 @@
 #define BITQUARK_SERVABLE_H
 
 #include <mutex>
+#include <atomic>
 #include <string>
+#include <string_view>
 #include <thread>
+#include <vector>
 #include <functional>
+#include <condition_variable>
 #include <unordered_map>
 #include <corvusoft/restbed/service.hpp>
 #include <corvusoft/restbed/session.hpp>
@@ -34,6 +38,11 @@
 #include <corvusoft/restbed/resource.hpp>
 #include <corvusoft/restbed/settings.hpp>
 #include <BitBoson/StandardModel/Threading/ThreadSafeFlag.h>
+#include <BitBoson/BitQuark/Networking/Payload.h>
+#include <BitBoson/BitQuark/Networking/BinaryServer.h>
+#include <BitBoson/BitQuark/Networking/RouteMetrics.h>
+#include <BitBoson/BitQuark/Networking/RouteTable.h>
+#include <BitBoson/BitQuark/Networking/AdmissionController.h>
 
 using namespace BitBoson;
 namespace BitBoson::BitQuark
@@ -53,13 +62,69 @@ namespace BitBoson::BitQuark
             {
                 int code;
                 std::unordered_map<std::string, std::string> body;
+                Payload data;
+            };
+            struct StreamObj
+            {
+                std::function<bool(std::string_view)> chunkHandler;
+                std::function<ResponseObj()> completionHandler;
+            };
+
+        // Private structures
+        private:
+            struct ListenerOptions
+            {
+                std::atomic<bool> keepAlive;
+                std::atomic<long> maxBodySize;
+                std::atomic<long> compressionThreshold;
+                std::shared_ptr<AdmissionController> admissionController;
+            };
+            struct HttpRoutes
+            {
+                RouteTable routeTable;
+                std::vector<std::function<void(const std::shared_ptr<restbed::Session>,
+                    const std::string&)>> handlers;
+            };
+            struct BinaryRoute
+            {
+                std::function<ResponseObj(std::unordered_map<std::string, std::string>&,
+                    std::unordered_map<std::string, std::string>&, Payload&,
+                    const std::string&)> handlerFunction;
+                std::shared_ptr<RouteMetrics::RouteStats> routeStats;
+                AdmissionController::RouteClass routeClass;
+            };
+            struct BinaryRoutes
+            {
+                std::string routePrefix;
+                std::string localRoutePrefix;
+                RouteTable routeTable;
+                std::vector<BinaryRoute> routes;
+                std::shared_ptr<AdmissionController> admissionController;
+                std::mutex inProcessLock;
+                std::condition_variable inProcessDrained;
+                long inProcessCalls;
+                bool inProcessOpen;
+            };
+            struct InProcessRegistry
+            {
+                std::mutex lock;
+                std::unordered_map<std::string, std::shared_ptr<BinaryRoutes>> servables;
             };
 
         // Private member variables
         private:
             int _port;
+            int _binaryPort;
+            std::string _unixSocketPath;
+            std::string _inProcessName;
             std::mutex _lock;
             std::shared_ptr<StandardModel::ThreadSafeFlag> _isRunning;
+            std::shared_ptr<ListenerOptions> _listenerOptions;
+            std::shared_ptr<HttpRoutes> _httpRoutes;
+            std::shared_ptr<BinaryRoutes> _binaryRoutes;
+            std::shared_ptr<BinaryServer> _binaryServer;
+            std::shared_ptr<BinaryServer> _unixServer;
+            std::shared_ptr<RouteMetrics> _routeMetrics;
             std::shared_ptr<restbed::Settings> _settings;
             std::shared_ptr<restbed::Service> _service;
             std::shared_ptr<std::thread> _backgroundThread;
@@ -71,6 +136,7 @@ namespace BitBoson::BitQuark
              * Constructor used to setup the servable instace
              *
              * @param port Integer representing the port to listen on
+             *             (or zero to only serve the local transports)
              * @param isAuthenticated Boolean indicating whether the REST API
              *                        requires authentication or not
              */
@@ -81,8 +147,133 @@ namespace BitBoson::BitQuark
              * NOTE: This is a non-blocking operation
              *
              * @param workerThreads Integer represeting the number of threads
+             *                      (defaults to the hardware concurrency)
+             * @return Boolean indicating whether the service was started with all of
+             *         its enabled transports listening (false if any failed to bind)
+             */
+            virtual bool start(int workerThreads=0);
+
+            /**
+             * Function used to stop the service and wait for all in-flight
+             * handlers to complete
+             * NOTE: Derived classes must call this before tearing-down any
+             *       state their handlers rely on
+             */
+            void stop();
+
+            /**
+             * Function used to enable or disable persistent (keep-alive) connections
+             * NOTE: The idle timeout only applies if set before the service is started
+             *
+             * @param keepAlive Boolean indicating whether to keep connections alive
+             * @param idleTimeout Integer representing the time (in milliseconds) an
+             *                    idle connection is kept open waiting for a request
+             */
+            void setKeepAlive(bool keepAlive, int idleTimeout=30000);
+
+            /**
+             * Function used to set the maximum request body size for (non-streaming)
+             * listeners which do not specify their own limit
+             *
+             * @param maxBodySize Long representing the maximum body size in bytes
+             */
+            void setMaxBodySize(long maxBodySize);
+
+            /**
+             * Function used to set the size above which (non-streaming) response
+             * bodies are compressed for clients which accept gzip or deflate
+             *
+             * @param compressionThreshold Long representing the threshold in bytes
+             *                             (or a negative value to disable compression)
+             */
+            void setCompressionThreshold(long compressionThreshold);
+
+            /**
+             * Function used to additionally serve the (non-streaming) routes under
+             * the given prefix using the binary (length-prefixed frame) transport
+             * over persistent connections on a separate port
+             * NOTE: This only applies if set before the service is started
+             *
+             * @param port Integer representing the port to serve the binary transport on
+             * @param routePrefix String representing the prefix of the routes to serve
+             */
+            void enableBinaryTransport(int port, const std::string& routePrefix="/internal/");
+
+            /**
+             * Function used to additionally serve the (non-streaming) routes under
+             * the given prefix using the binary transport over a Unix domain socket
+             * for co-located clients (using "unix://" URLs)
+             * NOTE: This only applies if set before the service is started
+             *
+             * @param socketPath String representing the path of the socket file
+             * @param routePrefix String representing the prefix of the routes to serve
+             */
+            void enableUnixTransport(const std::string& socketPath, const std::string& routePrefix="/");
+
+            /**
+             * Function used to additionally serve the (non-streaming) routes under
+             * the given prefix to clients in the same process (using "inproc://" URLs)
+             * by calling the handlers directly without encoding or decoding the bodies
+             * NOTE: This only applies if set before the service is started
+             *
+             * @param name String representing the name to register the servable as
+             * @param routePrefix String representing the prefix of the routes to serve
              */
-            virtual void start(int workerThreads=0);
+            void enableInProcessTransport(const std::string& name, const std::string& routePrefix="/");
+
+            /**
+             * Function used to serve all (non-streaming) routes using the local
+             * transport described by the given URL (ie. "unix://%2Ftmp%2Fa.sock"
+             * or "inproc://name") if it is a local transport URL
+             * NOTE: This only applies if set before the service is started
+             *
+             * @param url String representing the (base) URL to serve the routes on
+             * @return Boolean indicating whether the URL was a local transport URL
+             */
+            bool enableLocalTransport(const std::string& url);
+
+            /**
+             * Static function used to determine whether the URL uses the in-process transport
+             *
+             * @param url String representing the URL/URI to check
+             * @return Boolean indicating whether the URL uses the in-process transport
+             */
+            static bool isInProcessUrl(const std::string& url);
+
+            /**
+             * Static function used to make a request on a servable in this
+             * process by calling its handler directly
+             * NOTE: The bodies are handed to the handler (which may modify them)
+             *       so they are taken by rvalue reference and never copied here
+             *
+             * @param method Servable HTTP Method indicating the method to use
+             * @param url String representing the (in-process) URL/URI for the request
+             * @param body Unordered String-String map representing the string values
+             * @param data Payload representing the typed (object) members
+             * @param transportFailed Boolean set to indicate no servable was found
+             * @return Servable Response-Object representing the response information
+             */
+            static ResponseObj invokeInProcess(HttpMethod method, const std::string& url,
+                    std::unordered_map<std::string, std::string>&& body, Payload&& data,
+                    bool& transportFailed);
+
+            /**
+             * Function used to get the per-route metrics (latencies, response
+             * codes, body sizes, etc) collected for the servable's listeners
+             * NOTE: These are also served in the Prometheus text format on "/metrics"
+             *
+             * @return Route Metrics (pointer) for the servable's listeners
+             */
+            std::shared_ptr<RouteMetrics> getRouteMetrics();
+
+            /**
+             * Function used to get the admission controller used to limit the number
+             * of requests handled at once (by route class) and shed the excess
+             * NOTE: Nothing is limited until the controller's limits are set
+             *
+             * @return Admission Controller (pointer) for the servable's listeners
+             */
+            std::shared_ptr<AdmissionController> getAdmissionController();
 
             /**
              * Destructor used to cleanup the instance and stop
@@ -110,21 +301,227 @@ namespace BitBoson::BitQuark
                     std::function<ResponseObj(std::unordered_map<std::string, std::string>&,
                         std::unordered_map<std::string, std::string>&, const std::string&)> handlerFunction);
 
+            /**
+             * Function used to add a typed Http Listener route to the servable
+             * NOTE: The handler is given the entire request body as a (typed) payload
+             *       object including all of its string, numeric and nested members
+             *
+             * @param method HttpMethod indicating the method to add the
+             *               listener onto
+             * @param route String representing the route to add the
+             *               listener onto
+             * @param routeArg String representing the trailing route-argument
+             *                 to use as a part of the processing
+             * @param handlerFunction Callback Function used to handle
+             *                        all requests made on this new route
+             */
+            void addTypedListener(HttpMethod method, const std::string& route,
+                    const std::string& routeArg,
+                    std::function<ResponseObj(std::unordered_map<std::string, std::string>&,
+                        Payload&, const std::string&)> handlerFunction);
+
+            /**
+             * Function used to add a streaming Http Listener route to the servable
+             * NOTE: The stream function is called once per request to setup the
+             *       handlers which are then given the (raw) request body in chunks
+             *       as they arrive followed by a call to complete the request
+             *
+             * @param method HttpMethod indicating the method to add the
+             *               listener onto
+             * @param route String representing the route to add the
+             *               listener onto
+             * @param routeArg String representing the trailing route-argument
+             *                 to use as a part of the processing
+             * @param streamFunction Callback Function used to setup the stream
+             *                       handlers for each request on this new route
+             * @param maxBodySize Long representing the maximum body size in bytes
+             *                    (or a negative value to use the servable's limit)
+             */
+            void addStreamingListener(HttpMethod method, const std::string& route,
+                    const std::string& routeArg,
+                    std::function<StreamObj(std::unordered_map<std::string, std::string>&,
+                        const std::string&)> streamFunction, long maxBodySize=-1);
+
         // Private member functions
         private:
 
             /**
-             * Internal static function used to handle the request with all boilder-plate operations
+             * Internal function used to add the Rest-Bed resource for a Http Listener route
              *
-             * @param session Sessing representing the Rest-Bed session object
+             * @param method HttpMethod indicating the method to add the
+             *               listener onto
+             * @param route String representing the route to add the
+             *               listener onto
              * @param routeArg String representing the trailing route-argument
              *                 to use as a part of the processing
+             * @param handlerFunction Callback Function used to handle
+             *                        all requests made on this new route
+             */
+            void addListenerResource(HttpMethod method, const std::string& route,
+                    const std::string& routeArg,
+                    std::function<ResponseObj(std::unordered_map<std::string, std::string>&,
+                        std::unordered_map<std::string, std::string>&, Payload&,
+                        const std::string&)> handlerFunction);
+
+            /**
+             * Internal static function used to dispatch a request to the handler of
+             * the matching route in the (compiled) route table
+             *
+             * @param session Session representing the Rest-Bed session object
+             * @param httpRoutes HTTP Routes representing the routes being served
+             */
+            static void routeHandlerFunction(const std::shared_ptr<restbed::Session> session,
+                    std::shared_ptr<HttpRoutes> httpRoutes);
+
+            /**
+             * Internal static function used to handle the request with all boilder-plate operations
+             *
+             * @param session Sessing representing the Rest-Bed session object
+             * @param routeArgVal String representing the value of the trailing
+             *                    route-argument (if any) captured by the route table
+             * @param listenerOptions Listener Options shared by all of the servable's listeners
+             * @param routeStats Route Stats used to record the request's metrics
+             * @param routeClass Route Class used to admit the request
              * @param handlerFunction Handler function (pointer) used to handle the request
              */
             static void genericHandlerFunction(
-                const std::shared_ptr<restbed::Session> session, const std::string& routeArg,
+                const std::shared_ptr<restbed::Session> session, const std::string& routeArgVal,
+                std::shared_ptr<ListenerOptions> listenerOptions,
+                std::shared_ptr<RouteMetrics::RouteStats> routeStats,
+                AdmissionController::RouteClass routeClass,
                 std::function<ResponseObj(std::unordered_map<std::string, std::string>&,
-                    std::unordered_map<std::string, std::string>&, const std::string&)> handlerFunction);
+                    std::unordered_map<std::string, std::string>&, Payload&,
+                    const std::string&)> handlerFunction);
+
+            /**
+             * Internal static function used to handle a binary transport request
+             * frame with all boiler-plate operations
+             *
+             * @param data Character Array representing the request frame contents
+             * @param size Unsigned Long representing the size of the frame contents
+             * @param binaryRoutes Binary Routes representing the routes being served
+             * @param routePrefix String representing the prefix of the routes to serve
+             * @return String representing the response frame to send back
+             */
+            static std::string binaryHandlerFunction(const char* data, unsigned long size,
+                    std::shared_ptr<BinaryRoutes> binaryRoutes, const std::string& routePrefix);
+
+            /**
+             * Internal static function used to find the route for a (binary or
+             * in-process) request and call its handler with admission control
+             * and metrics, optionally encoding the response as a binary frame
+             *
+             * @param binaryRoutes Binary Routes representing the routes being served
+             * @param routePrefix String representing the prefix of the routes to serve
+             * @param method Integer representing the request's HTTP method
+             * @param path String representing the request's path
+             * @param bodyValues Unordered String-String map representing the string values
+             * @param typedBodyValues Payload representing the typed (object) members
+             * @param requestBytes Unsigned Long representing the size of the request
+             * @param responseFrame String to encode the response frame into (if not null)
+             * @return Servable Response-Object representing the response information
+             */
+            static ResponseObj dispatchRoute(const std::shared_ptr<BinaryRoutes>& binaryRoutes,
+                    const std::string& routePrefix, int method, const std::string& path,
+                    std::unordered_map<std::string, std::string>& bodyValues,
+                    Payload& typedBodyValues, unsigned long requestBytes, std::string* responseFrame);
+
+            /**
+             * Internal static function used to get the process-wide registry
+             * of servables served using the in-process transport
+             *
+             * @return In-Process Registry reference for the process
+             */
+            static InProcessRegistry& getInProcessRegistry();
+
+            /**
+             * Internal static function used to handle a streaming request with all
+             * boiler-plate operations
+             *
+             * @param session Session representing the Rest-Bed session object
+             * @param routeArgVal String representing the value of the trailing
+             *                    route-argument (if any) captured by the route table
+             * @param listenerOptions Listener Options shared by all of the servable's listeners
+             * @param maxBodySize Long representing the maximum body size in bytes
+             *                    (or a negative value to use the servable's limit)
+             * @param streamFunction Callback Function used to setup the stream handlers
+             */
+            static void streamingHandlerFunction(
+                const std::shared_ptr<restbed::Session> session, const std::string& routeArgVal,
+                std::shared_ptr<ListenerOptions> listenerOptions, long maxBodySize,
+                std::function<StreamObj(std::unordered_map<std::string, std::string>&,
+                    const std::string&)> streamFunction);
+
+            /**
+             * Internal static function used to read the next chunk of a streaming request
+             *
+             * @param session Session representing the Rest-Bed session object
+             * @param remaining Long representing the number of body bytes left to read
+             * @param keepAlive Boolean indicating whether to keep the connection alive
+             * @param streamObj Stream Object representing the request's stream handlers
+             */
+            static void fetchNextChunk(const std::shared_ptr<restbed::Session> session,
+                    long remaining, bool keepAlive, std::shared_ptr<StreamObj> streamObj);
+
+            /**
+             * Internal static function used to determine whether the given request
+             * has a body which cannot be read since it has no Content-Length
+             * NOTE: Transfer-Coded (chunked) bodies are not decoded by the server so
+             *       these requests must be rejected rather than read as being empty
+             *
+             * @param request Request representing the Rest-Bed request object
+             * @return Boolean indicating whether the request is missing its length
+             */
+            static bool isLengthRequired(const std::shared_ptr<const restbed::Request> request);
+
+            /**
+             * Internal static function used to determine whether the connection
+             * for the given request should be kept alive after responding
+             * NOTE: HTTP/1.1 connections are persistent unless the client opts-out
+             *
+             * @param request Request representing the Rest-Bed request object
+             * @param listenerOptions Listener Options shared by all of the servable's listeners
+             * @return Boolean indicating whether to keep the connection alive
+             */
+            static bool shouldKeepAlive(const std::shared_ptr<const restbed::Request> request,
+                    std::shared_ptr<ListenerOptions> listenerOptions);
+
+            /**
+             * Internal static function used to convert a response object's body
+             * into the JSON string sent back to the caller
+             *
+             * @param response ResponseObj representing the response to convert
+             * @return String representing the JSON response body
+             */
+            static std::string getResponseString(const ResponseObj& response);
+
+            /**
+             * Internal static function used to compress the response body (in-place)
+             * if the client accepts a supported encoding and the body is large enough
+             *
+             * @param acceptEncoding String representing the request's Accept-Encoding header
+             * @param listenerOptions Listener Options shared by all of the servable's listeners
+             * @param body String representing the response body to (possibly) compress
+             * @return String representing the Content-Encoding used (empty if uncompressed)
+             */
+            static std::string compressResponseBody(const std::string& acceptEncoding,
+                    std::shared_ptr<ListenerOptions> listenerOptions, std::string& body);
+
+            /**
+             * Internal static function used to send the response for a request
+             *
+             * @param session Session representing the Rest-Bed session object
+             * @param code Integer representing the HTTP status code to respond with
+             * @param body String representing the response body to send
+             * @param keepAlive Boolean indicating whether to keep the connection alive
+             * @param contentType String representing the response body's content type
+             *                    (or empty to leave it unspecified)
+             * @param contentEncoding String representing the response body's encoding
+             *                        (or empty if it is not compressed)
+             */
+            static void respond(const std::shared_ptr<restbed::Session> session,
+                    int code, const std::string& body, bool keepAlive,
+                    const std::string& contentType="", const std::string& contentEncoding="");
 
     };
 }
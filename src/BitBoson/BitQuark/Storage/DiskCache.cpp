@@ -0,0 +1,443 @@
+/* This file is part of bit-quark.
+ *
+ * Copyright (c) BitBoson
+ *
+ * bit-quark is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bit-quark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bit-quark.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+#include <list>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <utility>
+#include <fstream>
+#include <algorithm>
+#include <filesystem>
+#include <BitBoson/StandardModel/Crypto/Crypto.h>
+#include <BitBoson/BitQuark/Storage/DiskCache.h>
+
+using namespace BitBoson::BitQuark;
+
+/**
+ * Constructor used to setup the (size-bounded) disk cache in the given
+ * directory, picking-up any objects cached there by a previous process
+ * NOTE: A directory should only be used by a single disk cache at once
+ *
+ * @param directory String representing the directory to cache objects in
+ * @param maxSize Unsigned Long Long representing the maximum bytes to cache
+ */
+DiskCache::DiskCache(const std::string& directory, unsigned long long maxSize)
+{
+
+    // Setup the member variables
+    _directory = directory;
+    _maxSize = maxSize;
+    _currSize = 0;
+    _hitCount = 0;
+    _missCount = 0;
+    _evictionCount = 0;
+    _tempFileCount = 0;
+
+    // Create the cache directory (if it doesn't already exist)
+    std::error_code errorCode;
+    std::filesystem::create_directories(_directory, errorCode);
+
+    // Find the objects cached by a previous process (along with when they
+    // were last used) removing any partially written object files
+    std::vector<std::pair<std::filesystem::file_time_type, std::string>> cachedFiles;
+    for (const auto& dirEntry : std::filesystem::directory_iterator(_directory, errorCode))
+    {
+        if (dirEntry.path().extension() == ".tmp")
+            std::filesystem::remove(dirEntry.path(), errorCode);
+        else if (dirEntry.path().extension() == ".object")
+            cachedFiles.emplace_back(dirEntry.last_write_time(errorCode),
+                    dirEntry.path().filename().string());
+    }
+
+    // Add the cached objects from the least to the most recently used
+    std::sort(cachedFiles.begin(), cachedFiles.end());
+    for (const auto& cachedFile : cachedFiles)
+    {
+        auto fileSize = std::filesystem::file_size(
+                std::filesystem::path(_directory) / cachedFile.second, errorCode);
+        if (!errorCode)
+        {
+            _lruFiles.push_front(cachedFile.second);
+            _entries[cachedFile.second] = CacheEntry{fileSize, _lruFiles.begin()};
+            _currSize += fileSize;
+        }
+    }
+
+    // Evict the least recently used objects until the cache fits
+    while ((_currSize > _maxSize) && !_lruFiles.empty())
+    {
+        removeEntry(_lruFiles.back(), true);
+        _evictionCount++;
+    }
+}
+
+/**
+ * Function used to get the cached object for the given key
+ * NOTE: This marks the object as the most recently used
+ *
+ * @param key String representing the key for the object to get
+ * @param value String to populate with the object's value
+ * @param eTag String to populate with the object's ETag
+ * @return Boolean indicating whether the object was cached or not
+ */
+bool DiskCache::getItem(const std::string& key, std::string& value, std::string& eTag)
+{
+
+    // Create a return flag
+    bool wasCached = false;
+
+    // Mark the object as the most recently used (if it is cached)
+    // Do this in a separate context to leverage RAII for the mutex/lock
+    auto fileName = getFileName(key);
+    bool isCached = false;
+    {
+
+        // Lock the thread for safe operation
+        std::unique_lock<std::mutex> lock(_lock);
+
+        // Move the object to the front of the usage list
+        auto entryIter = _entries.find(fileName);
+        if (entryIter != _entries.end())
+        {
+            _lruFiles.splice(_lruFiles.begin(), _lruFiles, entryIter->second.lruPosition);
+            isCached = true;
+        }
+    }
+
+    // Read the object from its file (outside of the lock since
+    // replaced or evicted files are swapped/removed atomically)
+    if (isCached)
+    {
+
+        // Record the use on the file itself so the usage order survives restarts
+        std::error_code errorCode;
+        auto filePath = std::filesystem::path(_directory) / fileName;
+        std::filesystem::last_write_time(filePath,
+                std::filesystem::file_time_type::clock::now(), errorCode);
+
+        // Read the ETag (the first line) and then the value (the rest of the file)
+        std::ifstream fileStream(filePath, std::ios::binary);
+        if (fileStream && std::getline(fileStream, eTag))
+        {
+            auto headerSize = fileStream.tellg();
+            fileStream.seekg(0, std::ios::end);
+            auto fileSize = fileStream.tellg();
+            fileStream.seekg(headerSize);
+            value.resize((size_t) (fileSize - headerSize));
+            fileStream.read(&value[0], (std::streamsize) value.size());
+            wasCached = (fileStream.gcount() == (std::streamsize) value.size());
+        }
+    }
+
+    // Return the return flag
+    return wasCached;
+}
+
+/**
+ * Function used to add (or replace) the cached object for the given key
+ * NOTE: Least recently used objects are evicted to make room for it
+ *
+ * @param key String representing the key for the object to add
+ * @param value String representing the object's value
+ * @param eTag String representing the object's ETag
+ * @return Boolean indicating whether the object was cached or not
+ */
+bool DiskCache::addItem(const std::string& key, const std::string& value, const std::string& eTag)
+{
+
+    // Create a return flag
+    bool wasCached = false;
+
+    // Only cache the object if it could ever fit (otherwise
+    // just remove any previous version of the object)
+    auto fileName = getFileName(key);
+    unsigned long long fileSize = (eTag.size() + 1 + value.size());
+    if (fileSize > _maxSize)
+        removeItem(key);
+    else
+    {
+
+        // Get a unique temporary file name to write the object to
+        // Do this in a separate context to leverage RAII for the mutex/lock
+        std::string tempFileName;
+        {
+
+            // Lock the thread for safe operation
+            std::unique_lock<std::mutex> lock(_lock);
+
+            // Setup the temporary file name
+            tempFileName = fileName + "." + std::to_string(_tempFileCount++) + ".tmp";
+        }
+
+        // Write the ETag (as the first line) and the value to the temporary file
+        // so that a partially written object is never read (or picked-up on restart)
+        auto tempFilePath = std::filesystem::path(_directory) / tempFileName;
+        bool wasWritten = false;
+        {
+            std::ofstream fileStream(tempFilePath, std::ios::binary | std::ios::trunc);
+            fileStream << eTag << '\n';
+            fileStream.write(value.data(), (std::streamsize) value.size());
+            fileStream.close();
+            wasWritten = !fileStream.fail();
+        }
+
+        // Lock the thread for safe operation
+        std::unique_lock<std::mutex> lock(_lock);
+
+        // Swap the written file in for any previous version of the object
+        std::error_code errorCode;
+        if (wasWritten)
+        {
+            std::filesystem::rename(tempFilePath, std::filesystem::path(_directory) / fileName, errorCode);
+            wasWritten = !errorCode;
+        }
+        if (!wasWritten)
+            std::filesystem::remove(tempFilePath, errorCode);
+
+        // Remove the previous version of the object (its file was already
+        // replaced if the object was written)
+        removeEntry(fileName, !wasWritten);
+
+        // Add the object as the most recently used (evicting the least
+        // recently used objects until the cache fits)
+        if (wasWritten)
+        {
+            _lruFiles.push_front(fileName);
+            _entries[fileName] = CacheEntry{fileSize, _lruFiles.begin()};
+            _currSize += fileSize;
+            while (_currSize > _maxSize)
+            {
+                removeEntry(_lruFiles.back(), true);
+                _evictionCount++;
+            }
+            wasCached = true;
+        }
+    }
+
+    // Return the return flag
+    return wasCached;
+}
+
+/**
+ * Function used to invalidate (remove) the cached object for the given key
+ *
+ * @param key String representing the key for the object to remove
+ */
+void DiskCache::removeItem(const std::string& key)
+{
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_lock);
+
+    // Remove the object (and its file)
+    removeEntry(getFileName(key), true);
+}
+
+/**
+ * Function used to invalidate (remove) every cached object
+ */
+void DiskCache::clear()
+{
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_lock);
+
+    // Remove all of the objects (and their files)
+    while (!_lruFiles.empty())
+        removeEntry(_lruFiles.back(), true);
+}
+
+/**
+ * Function used to record a read served from the cache
+ */
+void DiskCache::recordHit()
+{
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_lock);
+
+    // Record the hit
+    _hitCount++;
+}
+
+/**
+ * Function used to record a read which could not be served from the cache
+ */
+void DiskCache::recordMiss()
+{
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_lock);
+
+    // Record the miss
+    _missCount++;
+}
+
+/**
+ * Function used to get the number of reads served from the cache
+ *
+ * @return Unsigned Long Long representing the number of cache hits
+ */
+unsigned long long DiskCache::getHitCount()
+{
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_lock);
+
+    // Return the hit count
+    return _hitCount;
+}
+
+/**
+ * Function used to get the number of reads not served from the cache
+ *
+ * @return Unsigned Long Long representing the number of cache misses
+ */
+unsigned long long DiskCache::getMissCount()
+{
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_lock);
+
+    // Return the miss count
+    return _missCount;
+}
+
+/**
+ * Function used to get the number of objects evicted to make room
+ *
+ * @return Unsigned Long Long representing the number of cache evictions
+ */
+unsigned long long DiskCache::getEvictionCount()
+{
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_lock);
+
+    // Return the eviction count
+    return _evictionCount;
+}
+
+/**
+ * Function used to get the number of objects in the cache
+ *
+ * @return Unsigned Long representing the number of cached objects
+ */
+unsigned long DiskCache::getItemCount()
+{
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_lock);
+
+    // Return the number of cached objects
+    return _entries.size();
+}
+
+/**
+ * Function used to get the total size of the cached object files
+ *
+ * @return Unsigned Long Long representing the cached bytes
+ */
+unsigned long long DiskCache::getSize()
+{
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_lock);
+
+    // Return the cached bytes
+    return _currSize;
+}
+
+/**
+ * Function used to get the maximum size of the cached object files
+ *
+ * @return Unsigned Long Long representing the maximum cached bytes
+ */
+unsigned long long DiskCache::getMaxSize()
+{
+
+    // Return the maximum cached bytes
+    return _maxSize;
+}
+
+/**
+ * Function used to get the directory the objects are cached in
+ *
+ * @return String representing the cache directory
+ */
+std::string DiskCache::getDirectory()
+{
+
+    // Return the cache directory
+    return _directory;
+}
+
+/**
+ * Internal function used to get the file name for the given key
+ *
+ * @param key String representing the key for the object
+ * @return String representing the object's file name (within the directory)
+ */
+std::string DiskCache::getFileName(const std::string& key)
+{
+
+    // Name the file by the hash of the key (so any key is a valid file name)
+    return StandardModel::Crypto::sha256(key) + ".object";
+}
+
+/**
+ * Internal function used to remove the cached object file with the given name
+ * NOTE: The caller must hold the instance's lock
+ *
+ * @param fileName String representing the object's file name
+ * @param removeFile Boolean indicating whether to remove the file itself
+ * @return Boolean indicating whether the object was cached or not
+ */
+bool DiskCache::removeEntry(const std::string& fileName, bool removeFile)
+{
+
+    // Create a return flag
+    bool wasCached = false;
+
+    // Setup the object's file path (before the file name may be released)
+    auto filePath = std::filesystem::path(_directory) / fileName;
+
+    // Remove the object (and its size) if it is cached
+    auto entryIter = _entries.find(fileName);
+    if (entryIter != _entries.end())
+    {
+        _currSize -= entryIter->second.size;
+        _lruFiles.erase(entryIter->second.lruPosition);
+        _entries.erase(entryIter);
+        wasCached = true;
+    }
+
+    // Remove the object's file (even if it wasn't tracked)
+    if (removeFile)
+    {
+        std::error_code errorCode;
+        std::filesystem::remove(filePath, errorCode);
+    }
+
+    // Return the return flag
+    return wasCached;
+}
@@ -0,0 +1,191 @@
+/* This file is part of bit-quark.
+ *
+ * Copyright (c) BitBoson
+ *
+ * bit-quark is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bit-quark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bit-quark.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+#ifndef BITQUARK_DISKCACHE_H
+#define BITQUARK_DISKCACHE_H
+
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace BitBoson::BitQuark
+{
+
+    class DiskCache
+    {
+
+        // Private structures
+        private:
+            struct CacheEntry
+            {
+                unsigned long long size;
+                std::list<std::string>::iterator lruPosition;
+            };
+
+        // Private member variables
+        private:
+            std::mutex _lock;
+            std::string _directory;
+            unsigned long long _maxSize;
+            unsigned long long _currSize;
+            unsigned long long _hitCount;
+            unsigned long long _missCount;
+            unsigned long long _evictionCount;
+            unsigned long long _tempFileCount;
+            std::list<std::string> _lruFiles;
+            std::unordered_map<std::string, CacheEntry> _entries;
+
+        // Public member functions
+        public:
+
+            /**
+             * Constructor used to setup the (size-bounded) disk cache in the given
+             * directory, picking-up any objects cached there by a previous process
+             * NOTE: A directory should only be used by a single disk cache at once
+             *
+             * @param directory String representing the directory to cache objects in
+             * @param maxSize Unsigned Long Long representing the maximum bytes to cache
+             */
+            DiskCache(const std::string& directory, unsigned long long maxSize);
+
+            /**
+             * Function used to get the cached object for the given key
+             * NOTE: This marks the object as the most recently used
+             *
+             * @param key String representing the key for the object to get
+             * @param value String to populate with the object's value
+             * @param eTag String to populate with the object's ETag
+             * @return Boolean indicating whether the object was cached or not
+             */
+            bool getItem(const std::string& key, std::string& value, std::string& eTag);
+
+            /**
+             * Function used to add (or replace) the cached object for the given key
+             * NOTE: Least recently used objects are evicted to make room for it
+             *
+             * @param key String representing the key for the object to add
+             * @param value String representing the object's value
+             * @param eTag String representing the object's ETag
+             * @return Boolean indicating whether the object was cached or not
+             */
+            bool addItem(const std::string& key, const std::string& value, const std::string& eTag);
+
+            /**
+             * Function used to invalidate (remove) the cached object for the given key
+             *
+             * @param key String representing the key for the object to remove
+             */
+            void removeItem(const std::string& key);
+
+            /**
+             * Function used to invalidate (remove) every cached object
+             */
+            void clear();
+
+            /**
+             * Function used to record a read served from the cache
+             */
+            void recordHit();
+
+            /**
+             * Function used to record a read which could not be served from the cache
+             */
+            void recordMiss();
+
+            /**
+             * Function used to get the number of reads served from the cache
+             *
+             * @return Unsigned Long Long representing the number of cache hits
+             */
+            unsigned long long getHitCount();
+
+            /**
+             * Function used to get the number of reads not served from the cache
+             *
+             * @return Unsigned Long Long representing the number of cache misses
+             */
+            unsigned long long getMissCount();
+
+            /**
+             * Function used to get the number of objects evicted to make room
+             *
+             * @return Unsigned Long Long representing the number of cache evictions
+             */
+            unsigned long long getEvictionCount();
+
+            /**
+             * Function used to get the number of objects in the cache
+             *
+             * @return Unsigned Long representing the number of cached objects
+             */
+            unsigned long getItemCount();
+
+            /**
+             * Function used to get the total size of the cached object files
+             *
+             * @return Unsigned Long Long representing the cached bytes
+             */
+            unsigned long long getSize();
+
+            /**
+             * Function used to get the maximum size of the cached object files
+             *
+             * @return Unsigned Long Long representing the maximum cached bytes
+             */
+            unsigned long long getMaxSize();
+
+            /**
+             * Function used to get the directory the objects are cached in
+             *
+             * @return String representing the cache directory
+             */
+            std::string getDirectory();
+
+            /**
+             * Destructor used to cleanup the instance
+             */
+            virtual ~DiskCache() = default;
+
+        // Private member functions
+        private:
+
+            /**
+             * Internal function used to get the file name for the given key
+             *
+             * @param key String representing the key for the object
+             * @return String representing the object's file name (within the directory)
+             */
+            std::string getFileName(const std::string& key);
+
+            /**
+             * Internal function used to remove the cached object file with the given name
+             * NOTE: The caller must hold the instance's lock
+             *
+             * @param fileName String representing the object's file name
+             * @param removeFile Boolean indicating whether to remove the file itself
+             * @return Boolean indicating whether the object was cached or not
+             */
+            bool removeEntry(const std::string& fileName, bool removeFile);
+    };
+}
+
+#endif //BITQUARK_DISKCACHE_H
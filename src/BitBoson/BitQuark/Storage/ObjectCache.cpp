@@ -0,0 +1,333 @@
+/* This file is part of bit-quark.
+ *
+ * Copyright (c) BitBoson
+ *
+ * bit-quark is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bit-quark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bit-quark.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+#include <list>
+#include <mutex>
+#include <chrono>
+#include <string>
+#include <memory>
+#include <BitBoson/BitQuark/Storage/ObjectCache.h>
+
+using namespace BitBoson::BitQuark;
+
+/**
+ * Constructor used to setup the (size-bounded) object cache
+ *
+ * @param maxSize Unsigned Long Long representing the maximum bytes of values to cache
+ */
+ObjectCache::ObjectCache(unsigned long long maxSize)
+{
+
+    // Setup the member variables
+    _maxSize = maxSize;
+    _currSize = 0;
+    _generation = 0;
+    _hitCount = 0;
+    _missCount = 0;
+    _evictionCount = 0;
+}
+
+/**
+ * Function used to get the cached object for the given key
+ * NOTE: This marks the object as the most recently used
+ *
+ * @param key String representing the key for the object to get
+ * @param cachedObject Cached Object to populate with the cached object
+ * @return Boolean indicating whether the object was cached or not
+ */
+bool ObjectCache::getItem(const std::string& key, CachedObject& cachedObject)
+{
+
+    // Create a return flag
+    bool wasCached = false;
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_lock);
+
+    // If the object is cached, return it and mark it as the most recently used
+    auto entryIter = _entries.find(key);
+    if (entryIter != _entries.end())
+    {
+        _lruKeys.splice(_lruKeys.begin(), _lruKeys, entryIter->second.lruPosition);
+        cachedObject = entryIter->second.cachedObject;
+        wasCached = true;
+    }
+
+    // Return the return flag
+    return wasCached;
+}
+
+/**
+ * Function used to add (or replace) the cached object for the given key
+ * NOTE: The object is not cached if the cache has been invalidated since
+ *       the given generation (as the object may already be out-of-date)
+ *       and least recently used objects are evicted to make room for it
+ *
+ * @param key String representing the key for the object to add
+ * @param value String representing the object's value
+ * @param eTag String representing the object's ETag
+ * @param generation Unsigned Long Long representing the generation the
+ *                   object was read at (see getGeneration)
+ * @return Boolean indicating whether the object was cached or not
+ */
+bool ObjectCache::addItem(const std::string& key, std::shared_ptr<const std::string> value,
+        const std::string& eTag, unsigned long long generation)
+{
+
+    // Create a return flag
+    bool wasCached = false;
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_lock);
+
+    // Only cache the object if it is still up-to-date and could ever fit
+    if ((value != nullptr) && (generation == _generation) && (value->size() <= _maxSize))
+    {
+
+        // Remove any previous version of the object
+        removeEntry(key);
+
+        // Evict the least recently used objects until the object fits
+        while ((_currSize + value->size()) > _maxSize)
+        {
+            removeEntry(_lruKeys.back());
+            _evictionCount++;
+        }
+
+        // Add the object as the most recently used
+        _lruKeys.push_front(key);
+        _currSize += value->size();
+        _entries[key] = CacheEntry{CachedObject{std::move(value), eTag,
+                std::chrono::steady_clock::now()}, _lruKeys.begin()};
+        wasCached = true;
+    }
+
+    // Return the return flag
+    return wasCached;
+}
+
+/**
+ * Function used to record that the cached object for the given key
+ * is (still) up-to-date with the given ETag
+ *
+ * @param key String representing the key for the object
+ * @param eTag String representing the object's current ETag
+ */
+void ObjectCache::revalidateItem(const std::string& key, const std::string& eTag)
+{
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_lock);
+
+    // Only update the object if it is (still) the same version
+    auto entryIter = _entries.find(key);
+    if ((entryIter != _entries.end()) && (entryIter->second.cachedObject.eTag == eTag))
+        entryIter->second.cachedObject.validatedAt = std::chrono::steady_clock::now();
+}
+
+/**
+ * Function used to invalidate (remove) the cached object for the given key
+ *
+ * @param key String representing the key for the object to remove
+ */
+void ObjectCache::removeItem(const std::string& key)
+{
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_lock);
+
+    // Remove the object and move to the next generation so that
+    // any in-flight reads of the object are not cached
+    removeEntry(key);
+    _generation++;
+}
+
+/**
+ * Function used to invalidate (remove) every cached object
+ */
+void ObjectCache::clear()
+{
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_lock);
+
+    // Remove all of the objects and move to the next generation
+    _entries.clear();
+    _lruKeys.clear();
+    _currSize = 0;
+    _generation++;
+}
+
+/**
+ * Function used to get the cache's current generation (which
+ * changes every time an object is invalidated)
+ *
+ * @return Unsigned Long Long representing the cache's generation
+ */
+unsigned long long ObjectCache::getGeneration()
+{
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_lock);
+
+    // Return the generation
+    return _generation;
+}
+
+/**
+ * Function used to record a read served from the cache
+ */
+void ObjectCache::recordHit()
+{
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_lock);
+
+    // Record the hit
+    _hitCount++;
+}
+
+/**
+ * Function used to record a read which could not be served from the cache
+ */
+void ObjectCache::recordMiss()
+{
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_lock);
+
+    // Record the miss
+    _missCount++;
+}
+
+/**
+ * Function used to get the number of reads served from the cache
+ *
+ * @return Unsigned Long Long representing the number of cache hits
+ */
+unsigned long long ObjectCache::getHitCount()
+{
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_lock);
+
+    // Return the hit count
+    return _hitCount;
+}
+
+/**
+ * Function used to get the number of reads not served from the cache
+ *
+ * @return Unsigned Long Long representing the number of cache misses
+ */
+unsigned long long ObjectCache::getMissCount()
+{
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_lock);
+
+    // Return the miss count
+    return _missCount;
+}
+
+/**
+ * Function used to get the number of objects evicted to make room
+ *
+ * @return Unsigned Long Long representing the number of cache evictions
+ */
+unsigned long long ObjectCache::getEvictionCount()
+{
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_lock);
+
+    // Return the eviction count
+    return _evictionCount;
+}
+
+/**
+ * Function used to get the number of objects in the cache
+ *
+ * @return Unsigned Long representing the number of cached objects
+ */
+unsigned long ObjectCache::getItemCount()
+{
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_lock);
+
+    // Return the number of cached objects
+    return _entries.size();
+}
+
+/**
+ * Function used to get the total size of the cached values
+ *
+ * @return Unsigned Long Long representing the cached bytes
+ */
+unsigned long long ObjectCache::getSize()
+{
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_lock);
+
+    // Return the cached bytes
+    return _currSize;
+}
+
+/**
+ * Function used to get the maximum size of the cached values
+ *
+ * @return Unsigned Long Long representing the maximum cached bytes
+ */
+unsigned long long ObjectCache::getMaxSize()
+{
+
+    // Return the maximum cached bytes
+    return _maxSize;
+}
+
+/**
+ * Internal function used to remove the cached object for the given key
+ * NOTE: The caller must hold the instance's lock
+ *
+ * @param key String representing the key for the object to remove
+ * @return Boolean indicating whether the object was cached or not
+ */
+bool ObjectCache::removeEntry(const std::string& key)
+{
+
+    // Create a return flag
+    bool wasCached = false;
+
+    // Remove the object (and its size) if it is cached
+    auto entryIter = _entries.find(key);
+    if (entryIter != _entries.end())
+    {
+        _currSize -= entryIter->second.cachedObject.value->size();
+        _lruKeys.erase(entryIter->second.lruPosition);
+        _entries.erase(entryIter);
+        wasCached = true;
+    }
+
+    // Return the return flag
+    return wasCached;
+}
@@ -0,0 +1,203 @@
+/* This file is part of bit-quark.
+ *
+ * Copyright (c) BitBoson
+ *
+ * bit-quark is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bit-quark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bit-quark.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+#ifndef BITQUARK_OBJECTCACHE_H
+#define BITQUARK_OBJECTCACHE_H
+
+#include <list>
+#include <mutex>
+#include <chrono>
+#include <string>
+#include <memory>
+#include <unordered_map>
+
+namespace BitBoson::BitQuark
+{
+
+    class ObjectCache
+    {
+
+        // Public structures
+        public:
+            struct CachedObject
+            {
+                std::shared_ptr<const std::string> value;
+                std::string eTag;
+                std::chrono::steady_clock::time_point validatedAt;
+            };
+
+        // Private structures
+        private:
+            struct CacheEntry
+            {
+                CachedObject cachedObject;
+                std::list<std::string>::iterator lruPosition;
+            };
+
+        // Private member variables
+        private:
+            std::mutex _lock;
+            unsigned long long _maxSize;
+            unsigned long long _currSize;
+            unsigned long long _generation;
+            unsigned long long _hitCount;
+            unsigned long long _missCount;
+            unsigned long long _evictionCount;
+            std::list<std::string> _lruKeys;
+            std::unordered_map<std::string, CacheEntry> _entries;
+
+        // Public member functions
+        public:
+
+            /**
+             * Constructor used to setup the (size-bounded) object cache
+             *
+             * @param maxSize Unsigned Long Long representing the maximum bytes of values to cache
+             */
+            explicit ObjectCache(unsigned long long maxSize);
+
+            /**
+             * Function used to get the cached object for the given key
+             * NOTE: This marks the object as the most recently used
+             *
+             * @param key String representing the key for the object to get
+             * @param cachedObject Cached Object to populate with the cached object
+             * @return Boolean indicating whether the object was cached or not
+             */
+            bool getItem(const std::string& key, CachedObject& cachedObject);
+
+            /**
+             * Function used to add (or replace) the cached object for the given key
+             * NOTE: The object is not cached if the cache has been invalidated since
+             *       the given generation (as the object may already be out-of-date)
+             *       and least recently used objects are evicted to make room for it
+             *
+             * @param key String representing the key for the object to add
+             * @param value String representing the object's value
+             * @param eTag String representing the object's ETag
+             * @param generation Unsigned Long Long representing the generation the
+             *                   object was read at (see getGeneration)
+             * @return Boolean indicating whether the object was cached or not
+             */
+            bool addItem(const std::string& key, std::shared_ptr<const std::string> value,
+                    const std::string& eTag, unsigned long long generation);
+
+            /**
+             * Function used to record that the cached object for the given key
+             * is (still) up-to-date with the given ETag
+             *
+             * @param key String representing the key for the object
+             * @param eTag String representing the object's current ETag
+             */
+            void revalidateItem(const std::string& key, const std::string& eTag);
+
+            /**
+             * Function used to invalidate (remove) the cached object for the given key
+             *
+             * @param key String representing the key for the object to remove
+             */
+            void removeItem(const std::string& key);
+
+            /**
+             * Function used to invalidate (remove) every cached object
+             */
+            void clear();
+
+            /**
+             * Function used to get the cache's current generation (which
+             * changes every time an object is invalidated)
+             *
+             * @return Unsigned Long Long representing the cache's generation
+             */
+            unsigned long long getGeneration();
+
+            /**
+             * Function used to record a read served from the cache
+             */
+            void recordHit();
+
+            /**
+             * Function used to record a read which could not be served from the cache
+             */
+            void recordMiss();
+
+            /**
+             * Function used to get the number of reads served from the cache
+             *
+             * @return Unsigned Long Long representing the number of cache hits
+             */
+            unsigned long long getHitCount();
+
+            /**
+             * Function used to get the number of reads not served from the cache
+             *
+             * @return Unsigned Long Long representing the number of cache misses
+             */
+            unsigned long long getMissCount();
+
+            /**
+             * Function used to get the number of objects evicted to make room
+             *
+             * @return Unsigned Long Long representing the number of cache evictions
+             */
+            unsigned long long getEvictionCount();
+
+            /**
+             * Function used to get the number of objects in the cache
+             *
+             * @return Unsigned Long representing the number of cached objects
+             */
+            unsigned long getItemCount();
+
+            /**
+             * Function used to get the total size of the cached values
+             *
+             * @return Unsigned Long Long representing the cached bytes
+             */
+            unsigned long long getSize();
+
+            /**
+             * Function used to get the maximum size of the cached values
+             *
+             * @return Unsigned Long Long representing the maximum cached bytes
+             */
+            unsigned long long getMaxSize();
+
+            /**
+             * Destructor used to cleanup the instance
+             */
+            virtual ~ObjectCache() = default;
+
+        // Private member functions
+        private:
+
+            /**
+             * Internal function used to remove the cached object for the given key
+             * NOTE: The caller must hold the instance's lock
+             *
+             * @param key String representing the key for the object to remove
+             * @return Boolean indicating whether the object was cached or not
+             */
+            bool removeEntry(const std::string& key);
+    };
+}
+
+#endif //BITQUARK_OBJECTCACHE_H
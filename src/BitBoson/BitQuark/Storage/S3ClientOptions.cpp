@@ -0,0 +1,240 @@
+/* This file is part of bit-quark.
+ *
+ * Copyright (c) BitBoson
+ *
+ * bit-quark is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bit-quark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bit-quark.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#include <string>
+#include <thread>
+#include <aws/core/Aws.h>
+#include <aws/core/client/ClientConfiguration.h>
+#include <aws/core/utils/threading/Executor.h>
+#include <BitBoson/BitQuark/Storage/S3ClientOptions.h>
+
+using namespace BitBoson::BitQuark;
+
+/**
+ * Constructor used to setup the S3 client options with the
+ * defaults (matching the AWS SDK's defaults over plain HTTP
+ * using path-style addressing)
+ */
+S3ClientOptions::S3ClientOptions()
+{
+
+    // Setup the member variables
+    _maxConnections = 25;
+    _connectTimeoutMs = 1000;
+    _requestTimeoutMs = 3000;
+    _executorThreads = 0;
+    setAsyncThreads(0);
+    _enableTcpKeepAlive = true;
+    _tcpKeepAliveIntervalMs = 30000;
+    _usePathStyleAddressing = true;
+    _useHttps = false;
+}
+
+/**
+ * Function used to set the maximum number of (pooled) connections
+ * the S3 client can have open at once
+ * NOTE: This should be sized to the process's S3 concurrency
+ *
+ * @param maxConnections Unsigned Long representing the connection limit
+ */
+void S3ClientOptions::setMaxConnections(unsigned long maxConnections)
+{
+
+    // Setup the connection limit (ensuring there is at least one connection)
+    _maxConnections = (maxConnections == 0 ? 1 : maxConnections);
+}
+
+/**
+ * Function used to set the connect and request timeouts
+ *
+ * @param connectTimeoutMs Long representing the connect timeout (in milliseconds)
+ * @param requestTimeoutMs Long representing the request timeout (in milliseconds)
+ */
+void S3ClientOptions::setTimeouts(long connectTimeoutMs, long requestTimeoutMs)
+{
+
+    // Setup the timeouts
+    _connectTimeoutMs = connectTimeoutMs;
+    _requestTimeoutMs = requestTimeoutMs;
+}
+
+/**
+ * Function used to set the number of threads used to run the
+ * client's asynchronous operations
+ *
+ * @param executorThreads Unsigned Long representing the number of threads
+ *                        (or zero to use the SDK's default executor)
+ */
+void S3ClientOptions::setExecutorThreads(unsigned long executorThreads)
+{
+
+    // Setup the number of executor threads
+    _executorThreads = executorThreads;
+}
+
+/**
+ * Function used to set the number of threads used to run the
+ * data-store's own asynchronous (future-returning) operations
+ *
+ * @param asyncThreads Unsigned Long representing the number of threads
+ *                     (or zero to use one per hardware thread)
+ */
+void S3ClientOptions::setAsyncThreads(unsigned long asyncThreads)
+{
+
+    // Setup the number of asynchronous threads (ensuring there is at least one)
+    _asyncThreads = (asyncThreads == 0 ? std::thread::hardware_concurrency() : asyncThreads);
+    _asyncThreads = (_asyncThreads == 0 ? 4 : _asyncThreads);
+}
+
+/**
+ * Function used to set whether TCP keep-alive probes are sent
+ * on the client's (idle) connections
+ *
+ * @param enableTcpKeepAlive Boolean indicating whether to send keep-alive probes
+ * @param tcpKeepAliveIntervalMs Unsigned Long representing the probe interval
+ *                               (in milliseconds)
+ */
+void S3ClientOptions::setTcpKeepAlive(bool enableTcpKeepAlive, unsigned long tcpKeepAliveIntervalMs)
+{
+
+    // Setup the keep-alive values
+    _enableTcpKeepAlive = enableTcpKeepAlive;
+    _tcpKeepAliveIntervalMs = tcpKeepAliveIntervalMs;
+}
+
+/**
+ * Function used to set whether the bucket is addressed in the path
+ * (ie. "endpoint/bucket/key") rather than as a virtual host
+ *
+ * @param usePathStyleAddressing Boolean indicating whether to use path-style addressing
+ */
+void S3ClientOptions::setPathStyleAddressing(bool usePathStyleAddressing)
+{
+
+    // Setup the addressing style
+    _usePathStyleAddressing = usePathStyleAddressing;
+}
+
+/**
+ * Function used to set whether the endpoint is connected to using HTTPS
+ *
+ * @param useHttps Boolean indicating whether to use HTTPS
+ */
+void S3ClientOptions::setHttps(bool useHttps)
+{
+
+    // Setup the protocol
+    _useHttps = useHttps;
+}
+
+/**
+ * Function used to get the maximum number of (pooled) connections
+ *
+ * @return Unsigned Long representing the connection limit
+ */
+unsigned long S3ClientOptions::getMaxConnections() const
+{
+
+    // Return the connection limit
+    return _maxConnections;
+}
+
+/**
+ * Function used to get the number of threads used to run the
+ * client's asynchronous operations
+ *
+ * @return Unsigned Long representing the number of threads (zero for the default)
+ */
+unsigned long S3ClientOptions::getExecutorThreads() const
+{
+
+    // Return the number of executor threads
+    return _executorThreads;
+}
+
+/**
+ * Function used to get the number of threads used to run the
+ * data-store's own asynchronous (future-returning) operations
+ *
+ * @return Unsigned Long representing the number of threads (always positive)
+ */
+unsigned long S3ClientOptions::getAsyncThreads() const
+{
+
+    // Return the number of asynchronous threads
+    return _asyncThreads;
+}
+
+/**
+ * Function used to get whether the bucket is addressed in the path
+ *
+ * @return Boolean indicating whether path-style addressing is used
+ */
+bool S3ClientOptions::usePathStyleAddressing() const
+{
+
+    // Return the addressing style
+    return _usePathStyleAddressing;
+}
+
+/**
+ * Function used to get whether the endpoint is connected to using HTTPS
+ *
+ * @return Boolean indicating whether HTTPS is used
+ */
+bool S3ClientOptions::useHttps() const
+{
+
+    // Return the protocol
+    return _useHttps;
+}
+
+/**
+ * Function used to get the AWS client configuration for the options
+ *
+ * @param endpoint String representing the S3-Endpoint to connect to
+ * @return AWS Client Configuration representing the options
+ */
+Aws::Client::ClientConfiguration S3ClientOptions::getClientConfiguration(const std::string& endpoint) const
+{
+
+    // Setup the endpoint and protocol
+    Aws::Client::ClientConfiguration config;
+    config.endpointOverride = endpoint;
+    config.scheme = (_useHttps ? Aws::Http::Scheme::HTTPS : Aws::Http::Scheme::HTTP);
+
+    // Setup the connection pool, timeouts and keep-alive values
+    config.maxConnections = (unsigned) _maxConnections;
+    config.connectTimeoutMs = _connectTimeoutMs;
+    config.requestTimeoutMs = _requestTimeoutMs;
+    config.enableTcpKeepAlive = _enableTcpKeepAlive;
+    config.tcpKeepAliveIntervalMs = _tcpKeepAliveIntervalMs;
+
+    // Setup a dedicated pool of threads for asynchronous operations (if desired)
+    if (_executorThreads > 0)
+        config.executor = Aws::MakeShared<Aws::Utils::Threading::PooledThreadExecutor>(
+                "S3ClientOptions", _executorThreads);
+
+    // Return the client configuration
+    return config;
+}
@@ -0,0 +1,170 @@
+/* This file is part of bit-quark.
+ *
+ * Copyright (c) BitBoson
+ *
+ * bit-quark is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bit-quark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bit-quark.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#ifndef BITQUARK_S3CLIENTOPTIONS_H
+#define BITQUARK_S3CLIENTOPTIONS_H
+
+#include <string>
+#include <aws/core/Aws.h>
+#include <aws/core/client/ClientConfiguration.h>
+
+namespace BitBoson::BitQuark
+{
+
+    class S3ClientOptions
+    {
+
+        // Private member variables
+        private:
+            unsigned long _maxConnections;
+            long _connectTimeoutMs;
+            long _requestTimeoutMs;
+            unsigned long _executorThreads;
+            unsigned long _asyncThreads;
+            bool _enableTcpKeepAlive;
+            unsigned long _tcpKeepAliveIntervalMs;
+            bool _usePathStyleAddressing;
+            bool _useHttps;
+
+        // Public member functions
+        public:
+
+            /**
+             * Constructor used to setup the S3 client options with the
+             * defaults (matching the AWS SDK's defaults over plain HTTP
+             * using path-style addressing)
+             */
+            S3ClientOptions();
+
+            /**
+             * Function used to set the maximum number of (pooled) connections
+             * the S3 client can have open at once
+             * NOTE: This should be sized to the process's S3 concurrency
+             *
+             * @param maxConnections Unsigned Long representing the connection limit
+             */
+            void setMaxConnections(unsigned long maxConnections);
+
+            /**
+             * Function used to set the connect and request timeouts
+             *
+             * @param connectTimeoutMs Long representing the connect timeout (in milliseconds)
+             * @param requestTimeoutMs Long representing the request timeout (in milliseconds)
+             */
+            void setTimeouts(long connectTimeoutMs, long requestTimeoutMs);
+
+            /**
+             * Function used to set the number of threads used to run the
+             * client's asynchronous operations
+             *
+             * @param executorThreads Unsigned Long representing the number of threads
+             *                        (or zero to use the SDK's default executor)
+             */
+            void setExecutorThreads(unsigned long executorThreads);
+
+            /**
+             * Function used to set the number of threads used to run the
+             * data-store's own asynchronous (future-returning) operations
+             *
+             * @param asyncThreads Unsigned Long representing the number of threads
+             *                     (or zero to use one per hardware thread)
+             */
+            void setAsyncThreads(unsigned long asyncThreads);
+
+            /**
+             * Function used to set whether TCP keep-alive probes are sent
+             * on the client's (idle) connections
+             *
+             * @param enableTcpKeepAlive Boolean indicating whether to send keep-alive probes
+             * @param tcpKeepAliveIntervalMs Unsigned Long representing the probe interval
+             *                               (in milliseconds)
+             */
+            void setTcpKeepAlive(bool enableTcpKeepAlive, unsigned long tcpKeepAliveIntervalMs=30000);
+
+            /**
+             * Function used to set whether the bucket is addressed in the path
+             * (ie. "endpoint/bucket/key") rather than as a virtual host
+             *
+             * @param usePathStyleAddressing Boolean indicating whether to use path-style addressing
+             */
+            void setPathStyleAddressing(bool usePathStyleAddressing);
+
+            /**
+             * Function used to set whether the endpoint is connected to using HTTPS
+             *
+             * @param useHttps Boolean indicating whether to use HTTPS
+             */
+            void setHttps(bool useHttps);
+
+            /**
+             * Function used to get the maximum number of (pooled) connections
+             *
+             * @return Unsigned Long representing the connection limit
+             */
+            unsigned long getMaxConnections() const;
+
+            /**
+             * Function used to get the number of threads used to run the
+             * client's asynchronous operations
+             *
+             * @return Unsigned Long representing the number of threads (zero for the default)
+             */
+            unsigned long getExecutorThreads() const;
+
+            /**
+             * Function used to get the number of threads used to run the
+             * data-store's own asynchronous (future-returning) operations
+             *
+             * @return Unsigned Long representing the number of threads (always positive)
+             */
+            unsigned long getAsyncThreads() const;
+
+            /**
+             * Function used to get whether the bucket is addressed in the path
+             *
+             * @return Boolean indicating whether path-style addressing is used
+             */
+            bool usePathStyleAddressing() const;
+
+            /**
+             * Function used to get whether the endpoint is connected to using HTTPS
+             *
+             * @return Boolean indicating whether HTTPS is used
+             */
+            bool useHttps() const;
+
+            /**
+             * Function used to get the AWS client configuration for the options
+             *
+             * @param endpoint String representing the S3-Endpoint to connect to
+             * @return AWS Client Configuration representing the options
+             */
+            Aws::Client::ClientConfiguration getClientConfiguration(const std::string& endpoint) const;
+
+            /**
+             * Destructor used to cleanup the instance
+             */
+            virtual ~S3ClientOptions() = default;
+    };
+}
+
+#endif //BITQUARK_S3CLIENTOPTIONS_H
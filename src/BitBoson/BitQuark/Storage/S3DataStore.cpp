@@ -19,19 +19,37 @@
  *     - Tyler Parcell <OriginLegend>
  */
 
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <thread>
+#include <algorithm>
+#include <set>
+#include <cctype>
+#include <cstdlib>
 #include <aws/core/Aws.h>
 #include <aws/s3/model/Delete.h>
+#include <aws/s3/model/CompletedPart.h>
+#include <aws/core/utils/memory/AWSMemory.h>
 #include <aws/s3/model/PutObjectRequest.h>
 #include <aws/s3/model/GetObjectRequest.h>
 #include <aws/s3/model/HeadObjectRequest.h>
 #include <aws/s3/model/DeleteObjectRequest.h>
 #include <aws/core/auth/AWSCredentials.h>
 #include <aws/s3/model/ListObjectsRequest.h>
+#include <aws/s3/model/ListObjectsV2Request.h>
+#include <aws/s3/model/UploadPartRequest.h>
 #include <aws/s3/model/DeleteObjectsRequest.h>
+#include <aws/s3/model/CompletedMultipartUpload.h>
+#include <aws/s3/model/AbortMultipartUploadRequest.h>
+#include <aws/s3/model/CreateMultipartUploadRequest.h>
+#include <aws/s3/model/CompleteMultipartUploadRequest.h>
 #include <boost/iostreams/stream.hpp>
 #include <boost/iostreams/device/array.hpp>
 #include <BitBoson/StandardModel/Utils/Utils.h>
 #include <BitBoson/StandardModel/Crypto/Crypto.h>
+#include <BitBoson/BitQuark/Storage/DiskCache.h>
+#include <BitBoson/BitQuark/Storage/ObjectCache.h>
 #include <BitBoson/BitQuark/Storage/S3DataStore.h>
 
 using namespace BitBoson;
@@ -41,22 +59,51 @@ using namespace BitBoson::BitQuark;
  * Constructor used to setup the s3-data-store instance
  *
  * @param s3Credentials S3 Credentials used to setup the S3 connection with
+ * @param s3ClientOptions S3 Client Options used to setup the S3 connection
+ *                        pool and timeouts with (or null for the defaults)
  */
-S3DataStore::S3DataStore(std::shared_ptr<S3Credentials> s3Credentials)
+S3DataStore::S3DataStore(std::shared_ptr<S3Credentials> s3Credentials,
+        std::shared_ptr<S3ClientOptions> s3ClientOptions)
 {
 
     // Setup member variables
     _bucket = s3Credentials->getBucket();
     _directory = s3Credentials->getDirectoryPrefix();
-    auto usePathStyleAddressing = true; // TODO: Implement in S3Credentials
+
+    // Fall-back to the default client options if none were provided
+    if (s3ClientOptions == nullptr)
+        s3ClientOptions = std::make_shared<S3ClientOptions>();
+
+    // Setup the synchronization state (shared so the instance stays assignable)
+    _sync = std::make_shared<S3Sync>();
+    _sync->asyncPending = 0;
+    _sync->isStopping = false;
+    _sync->metadataChanges = 0;
+    _sync->metadataFlushThreshold = 100;
+    _sync->metadataFlushIntervalMs = 1000;
+    _sync->reconcileConcurrency = 8;
+    _sync->reconcileInitialDelayMs = 100;
+    _sync->reconcileMaxDelayMs = 30000;
+    _sync->reconcileDeadlineMs = 10000;
+    _sync->nextReconcile = std::chrono::steady_clock::time_point::max();
+    _sync->multipartThreshold = (16ULL * 1024 * 1024);
+    _sync->multipartPartSize = (8ULL * 1024 * 1024);
+    _sync->multipartConcurrency = 4;
+    _sync->objectCacheRevalidateMs = 0;
+
+    // Setup the thread-pool used to run asynchronous operations
+    // NOTE: This is sized separately from the SDK's executor (which defaults
+    //       to none) since a pool without threads would never run anything
+    _asyncPool = std::make_shared<StandardModel::ThreadPool<std::function<void()>>>(
+        [](std::shared_ptr<std::function<void()>> operation) {
+            (*operation)();
+        }, (int) s3ClientOptions->getAsyncThreads());
 
     // Obtain the AWS SDK Options (force Singleton Instance)
     _awsOptions = AwsOptionsSingleton::getAwsOptions();
 
-    // Setup the Client Configuration (to use configured HTTP(S) protocol)
-    Aws::Client::ClientConfiguration config;
-    config.endpointOverride = s3Credentials->getS3Endpoint();
-    config.scheme = Aws::Http::Scheme::HTTP;
+    // Setup the Client Configuration (protocol, connection pool, timeouts, etc.)
+    auto config = s3ClientOptions->getClientConfiguration(s3Credentials->getS3Endpoint());
 
     // Setup the S3 Credentials
     Aws::Auth::AWSCredentials credentials{Aws::String(s3Credentials->getAccessKey()),
@@ -64,51 +111,104 @@ S3DataStore::S3DataStore(std::shared_ptr<S3Credentials> s3Credentials)
 
     // Setup the S3 Client based on the provided keys and configuration information
     _s3Client = std::make_shared<Aws::S3::S3Client>(credentials, config,
-            Aws::Client::AWSAuthV4Signer::PayloadSigningPolicy::Always, !usePathStyleAddressing);
+            Aws::Client::AWSAuthV4Signer::PayloadSigningPolicy::Always, !s3ClientOptions->usePathStyleAddressing());
+
+    // Push out any pending metadata from other instances in this process
+    // on the same directory so that the metadata loaded is up-to-date
+    // Do this in a separate context to leverage RAII for the mutex/lock
+    {
+
+        // Lock the thread for safe operation
+        auto& instanceRegistry = getInstanceRegistry();
+        std::unique_lock<std::mutex> lock(instanceRegistry.lock);
+
+        // Flush each of the other instances' metadata
+        auto registryIter = instanceRegistry.instances.find(getRegistryKey());
+        if (registryIter != instanceRegistry.instances.end())
+            for (auto instance : registryIter->second)
+                instance->flushMetaData();
+    }
 
     // Load the S3-Meta-Data from the S3-Data-Store directly
     _internalMd = getMetaData();
+
+    // Start pushing out the (coalesced) metadata in the background
+    startBackgroundThreads();
 }
 
 /**
- * Function used to add an item to the s3-data-store
+ * Move constructor used to take over another s3-data-store instance
+ * NOTE: The other instance must not have asynchronous operations outstanding
  *
- * @param key String representing the key for the item to add
- * @param item String item to add to the data store
- * @return Boolean indicating whether the item was added or not
+ * @param other S3-Data-Store instance to take over
  */
-bool S3DataStore::addItem(const std::string& key, const std::string& item)
+S3DataStore::S3DataStore(S3DataStore&& other) noexcept
 {
 
-    // Create a return flag
-    bool wasAdded = false;
+    // Take over the other instance's state
+    *this = std::move(other);
+}
 
-    // Only process if the key isn't empty
-    // and doesn't start with a '.'
-    if (!key.empty() && (key[0] != '.'))
-    {
+/**
+ * Move assignment operator used to take over another s3-data-store instance
+ * NOTE: Neither instance may have asynchronous operations outstanding
+ *
+ * @param other S3-Data-Store instance to take over
+ * @return S3-Data-Store reference to this instance
+ */
+S3DataStore& S3DataStore::operator=(S3DataStore&& other) noexcept
+{
 
-        // Start by getting the size of the size of the object
-        auto currSize = getObjectSize(key);
+    // Only take over the other instance if it is actually another instance
+    if (this != &other)
+    {
 
-        // Next, add the item to the s3-bucket
-        wasAdded = addItemHelper(key, item);
+        // Release this instance's current state
+        shutdown();
+
+        // Stop the other instance's metadata flusher since
+        // it is bound to the other instance
+        if (other._sync != nullptr)
+            other.stopBackgroundThreads();
+
+        // Take over the other instance's state
+        _bucket = std::move(other._bucket);
+        _directory = std::move(other._directory);
+        _internalMd = std::move(other._internalMd);
+        _awsOptions = other._awsOptions;
+        _s3Client = std::move(other._s3Client);
+        _memoizationMap = std::move(other._memoizationMap);
+        _objectSizes = std::move(other._objectSizes);
+        _sync = std::move(other._sync);
+        _asyncPool = std::move(other._asyncPool);
+        _objectCache = std::move(other._objectCache);
+        _diskCache = std::move(other._diskCache);
+
+        // Restart the metadata flusher for this instance
+        if (_sync != nullptr)
+            startBackgroundThreads();
+    }
 
-        // If the operation was successful, update the metadata
-        if (wasAdded)
-        {
+    // Return a reference to this instance
+    return *this;
+}
 
-            // Update the total size in the metadata
-            auto newSize = item.size() - currSize;
-            _internalMd.dataSize += newSize;
+/**
+ * Function used to add an item to the s3-data-store
+ *
+ * @param key String representing the key for the item to add
+ * @param item String item to add to the data store
+ * @return Boolean indicating whether the item was added or not
+ */
+bool S3DataStore::addItem(const std::string& key, const std::string& item)
+{
 
-            // Add the current object's size to the memoization map
-            _memoizationMap[key] = item.size();
+    // Add the item (tracking its size) to the s3-bucket
+    bool wasAdded = addItemAndTrackSize(key, item);
 
-            // Push out the updated internal metadata
-            setMetaData(_internalMd);
-        }
-    }
+    // If the operation was successful, record the updated internal metadata
+    if (wasAdded)
+        markMetaDataChanged();
 
     // Return the return flag
     return wasAdded;
@@ -121,30 +221,174 @@ bool S3DataStore::addItem(const std::string& key, const std::string& item)
  * @return String representing the value for the given key
  */
 std::string S3DataStore::getItem(const std::string& key)
+{
+
+    // Get the value (ignoring its ETag)
+    std::string eTag;
+    return getItemWithETag(key, eTag);
+}
+
+/**
+ * Function used to get the value for the given key along with its ETag
+ * (for use with conditional writes such as compare-and-set)
+ *
+ * @param key String representing the key for the item to get
+ * @param eTag String to populate with the value's ETag (empty if missing)
+ * @return String representing the value for the given key
+ */
+std::string S3DataStore::getItemWithETag(const std::string& key, std::string& eTag)
 {
 
     // Create the return string/value
     std::string retValue;
+    eTag.clear();
 
     // Only process if the key isn't empty
     if (!key.empty())
     {
 
-        // Create the Get Object request
-        Aws::S3::Model::GetObjectRequest getObjectRequest;
-        getObjectRequest.WithBucket(_bucket).WithKey(_directory + "/" + Aws::String(key));
+        // Get the object caches (if enabled) and how long cached objects are
+        // served without being re-validated against the s3-data-store
+        // Do this in a separate context to leverage RAII for the mutex/lock
+        std::shared_ptr<ObjectCache> objectCache;
+        std::shared_ptr<DiskCache> diskCache;
+        long revalidateAfterMs = 0;
+        {
 
-        // Actually perform the request on the given client
-        auto getObjectOutcome = _s3Client->GetObject(getObjectRequest);
+            // Lock the thread for safe operation
+            std::unique_lock<std::mutex> lock(_sync->lock);
 
-        // Only attempt to write the file if the request was successful
-        if (getObjectOutcome.IsSuccess())
+            // Get the object caches and their policy
+            objectCache = _objectCache;
+            diskCache = _diskCache;
+            revalidateAfterMs = _sync->objectCacheRevalidateMs;
+        }
+
+        // Look-up the object in the in-memory object cache (if enabled)
+        ObjectCache::CachedObject cachedObject;
+        unsigned long long cacheGeneration = 0;
+        bool isCached = false;
+        if (objectCache != nullptr)
+        {
+            cacheGeneration = objectCache->getGeneration();
+            isCached = objectCache->getItem(key, cachedObject);
+        }
+
+        // Serve the object directly from the cache if it was validated recently enough
+        bool isSizeKnown = false;
+        if (isCached && ((std::chrono::steady_clock::now() - cachedObject.validatedAt)
+                < std::chrono::milliseconds(revalidateAfterMs)))
+        {
+            objectCache->recordHit();
+            retValue = *cachedObject.value;
+            eTag = cachedObject.eTag;
+            isSizeKnown = true;
+        }
+
+        // Otherwise, read the object from the s3-data-store
+        else
+        {
+
+            // Fall-back to the on-disk cache (if enabled) for objects which
+            // are not cached in-memory (these are always re-validated)
+            bool isOnDisk = false;
+            if (!isCached && (diskCache != nullptr))
+            {
+                std::string diskValue;
+                isOnDisk = diskCache->getItem(getDiskCacheKey(key), diskValue, cachedObject.eTag);
+                if (isOnDisk)
+                    cachedObject.value = std::make_shared<const std::string>(std::move(diskValue));
+            }
+
+            // Create the Get Object request (only downloading the
+            // object if it has changed since it was cached)
+            Aws::S3::Model::GetObjectRequest getObjectRequest;
+            getObjectRequest.WithBucket(_bucket).WithKey(_directory + "/" + Aws::String(key));
+            if (isCached || isOnDisk)
+                getObjectRequest.SetIfNoneMatch(cachedObject.eTag);
+
+            // Actually perform the request on the given client
+            auto getObjectOutcome = _s3Client->GetObject(getObjectRequest);
+
+            // Only attempt to write the file if the request was successful
+            if (getObjectOutcome.IsSuccess())
+            {
+
+                // Read the object data from the response directly into the (pre-sized) value
+                auto& getObjectResult = getObjectOutcome.GetResult();
+                auto& objectBody = getObjectResult.GetBody();
+                retValue.resize((size_t) std::max(getObjectResult.GetContentLength(), 0LL));
+                objectBody.read(&retValue[0], (std::streamsize) retValue.size());
+                retValue.resize((size_t) objectBody.gcount());
+                eTag = getObjectResult.GetETag().c_str();
+                isSizeKnown = true;
+
+                // Cache the object (if enabled) along with its ETag
+                if (objectCache != nullptr)
+                {
+                    objectCache->recordMiss();
+                    objectCache->addItem(key, std::make_shared<const std::string>(retValue),
+                            getObjectResult.GetETag(), cacheGeneration);
+                }
+                if (diskCache != nullptr)
+                {
+                    diskCache->recordMiss();
+                    diskCache->addItem(getDiskCacheKey(key), retValue, getObjectResult.GetETag());
+                }
+            }
+
+            // If the cached object has not changed, serve it from the cache
+            // (promoting objects from the on-disk cache to the in-memory cache)
+            else if ((isCached || isOnDisk) && (getObjectOutcome.GetError().GetResponseCode()
+                    == Aws::Http::HttpResponseCode::NOT_MODIFIED))
+            {
+                if (isCached)
+                {
+                    objectCache->revalidateItem(key, cachedObject.eTag);
+                    objectCache->recordHit();
+                }
+                else
+                {
+                    diskCache->recordHit();
+                    if (objectCache != nullptr)
+                    {
+                        objectCache->recordMiss();
+                        objectCache->addItem(key, cachedObject.value, cachedObject.eTag, cacheGeneration);
+                    }
+                }
+                retValue = *cachedObject.value;
+                eTag = cachedObject.eTag;
+                isSizeKnown = true;
+            }
+
+            // Otherwise the read missed the caches (removing the object
+            // from the caches if it no longer exists)
+            else
+            {
+                bool isMissing = (getObjectOutcome.GetError().GetResponseCode()
+                        == Aws::Http::HttpResponseCode::NOT_FOUND);
+                if (objectCache != nullptr)
+                    objectCache->recordMiss();
+                if (diskCache != nullptr)
+                    diskCache->recordMiss();
+                if (isMissing && (isCached || isOnDisk))
+                    invalidateCachedItem(key);
+
+                // A missing object is known to have no size
+                isSizeKnown = isMissing;
+            }
+        }
+
+        // Record the object's size (unless a write has already recorded it)
+        // so that a later write of the object does not need to look it up
+        if (isSizeKnown)
         {
 
-            // Extract the object data from the response and save it in memory
-            std::ostringstream localStream;
-            localStream << getObjectOutcome.GetResult().GetBody().rdbuf();
-            retValue = localStream.str();
+            // Lock the thread for safe operation
+            std::unique_lock<std::mutex> lock(_sync->lock);
+
+            // Record the object's size
+            recordObjectSizeUnlocked(key, (long long int) retValue.size(), false);
         }
     }
 
@@ -153,52 +397,123 @@ std::string S3DataStore::getItem(const std::string& key)
 }
 
 /**
- * Function used to get the given object's size
+ * Function used to stream the value for the given key into the given sink
+ * NOTE: The value is read in part-sized ranges so that only a single part
+ *       is ever held in memory at once (starting with a small range so
+ *       that small values never need a part-sized buffer)
+ * NOTE: Every part is read from the same version of the value, so the
+ *       read fails (part-way through) if the value is replaced during it
  *
  * @param key String representing the key for the item to get
- * @return Long Long Integer representing the object's size in bytes
+ * @param sink Output Stream to write the value for the given key to
+ * @return Boolean indicating whether the entire value was written or not
  */
-long long int S3DataStore::getObjectSize(const std::string& key)
+bool S3DataStore::getItem(const std::string& key, std::ostream& sink)
 {
 
-    // Create the return value
-    long long int retValue = 0;
+    // Create a return flag
+    bool wasRead = false;
 
     // Only process if the key isn't empty
     if (!key.empty())
     {
 
-        // Attempt to get the value from the memoization map
-        long currMapVal = -1;
-        if (_memoizationMap.find(key) != _memoizationMap.end())
-            currMapVal = _memoizationMap[key];
+        // Get the size of the parts to read the value in
+        // Do this in a separate context to leverage RAII for the mutex/lock
+        long long int partSize = 0;
+        {
 
-        // Create the Head Object request
-        Aws::S3::Model::HeadObjectRequest headObjectRequest;
-        headObjectRequest.WithBucket(_bucket).WithKey(_directory + "/" + Aws::String(key));
+            // Lock the thread for safe operation
+            std::unique_lock<std::mutex> lock(_sync->lock);
 
-        // Actually perform the request on the given client
-        auto headObjectOutcome = _s3Client->HeadObject(headObjectRequest);
+            // Get the part size
+            partSize = (long long int) _sync->multipartPartSize;
+        }
+
+        // Continuously read the next part of the value (and write it
+        // to the sink) until the end of the value has been reached
+        // NOTE: The later parts are only read from the version of the
+        //       value (ETag) which the first part was read from since
+        //       the parts already written to the sink cannot be undone
+        long long int readSize = std::min(partSize, (long long int) INITIAL_STREAM_READ_SIZE);
+        std::vector<char> partBuffer((size_t) readSize);
+        long long int offset = 0;
+        long long int objectSize = -1;
+        std::string eTag;
+        bool wasReplaced = false;
+        while (true)
+        {
+
+            // Read the next part, exiting if the read failed (or the value was replaced)
+            auto bytesRead = readItemRange(key, offset, partBuffer.data(), readSize,
+                    eTag, wasReplaced, objectSize);
+            if (bytesRead < 0)
+                break;
 
-        // Only attempt to write the file if the request was successful
-        if (headObjectOutcome.IsSuccess())
+            // Write the part out to the sink, exiting if the write failed
+            sink.write(partBuffer.data(), (std::streamsize) bytesRead);
+            offset += bytesRead;
+            if (!sink)
+                break;
+
+            // Exit once the final (short) part has been written
+            if ((bytesRead < readSize) || ((objectSize >= 0) && (offset >= objectSize)))
+            {
+                wasRead = true;
+                break;
+            }
+
+            // Read the following parts in full, but never beyond the
+            // (reported) end of the value
+            readSize = partSize;
+            if (objectSize >= 0)
+                readSize = std::min(readSize, (objectSize - offset));
+            if ((long long int) partBuffer.size() < readSize)
+                partBuffer.resize((size_t) readSize);
+        }
+
+        // Record the object's size (unless a write has already recorded it)
+        // so that a later write of the object does not need to look it up
+        // Do this in a separate context to leverage RAII for the mutex/lock
+        if (wasRead)
         {
 
-            // Extract the object's size from the head-object response
-            retValue = headObjectOutcome.GetResult().GetContentLength();
+            // Lock the thread for safe operation
+            std::unique_lock<std::mutex> lock(_sync->lock);
+
+            // Record the object's size
+            recordObjectSizeUnlocked(key, offset, false);
         }
+    }
 
-        // If the memoization map's value is the same as the cloud
-        // value, and they are non-negative, then remove the value
-        // from the memoization map since things are synchronized
-        if ((currMapVal == retValue) && (currMapVal >= 0))
-            _memoizationMap.erase(key);
+    // Return the return flag
+    return wasRead;
+}
+
+/**
+ * Function used to get the given range of the value for the given key
+ * NOTE: The range is shortened if it extends past the end of the value
+ *
+ * @param key String representing the key for the item to get
+ * @param offset Long Long Integer representing the offset to start reading at
+ * @param length Long Long Integer representing the number of bytes to read
+ * @return String representing the range of the value for the given key
+ */
+std::string S3DataStore::getItemRange(const std::string& key, long long int offset,
+        long long int length)
+{
+
+    // Create the return string/value
+    std::string retValue;
 
-        // We always trust the current map value so return it
-        // as long as it exists, otherwise we'll leave the cloud
-        // value in place (because the map doesn't have the item)
-        if (currMapVal >= 0)
-            retValue = currMapVal;
+    // Only process if there is anything to read
+    if (length > 0)
+    {
+
+        // Read the range directly into the (pre-sized) return value
+        retValue.resize((size_t) length);
+        auto bytesRead = getItemRange(key, offset, &retValue[0], length);
+        retValue.resize((size_t) std::max(bytesRead, 0LL));
     }
 
     // Return the return value
@@ -206,107 +521,1600 @@ long long int S3DataStore::getObjectSize(const std::string& key)
 }
 
 /**
- * Function used to list all of the items in the S3 Data-store
- * NOTE: This will effectively translate to S3-list operation(s)
+ * Function used to read the given range of the value for the given key
+ * directly into the given (caller-owned) buffer
+ * NOTE: The buffer contents are undefined if the read fails
  *
- * @param prefix String representing the object-key prefix to use (if any)
- * @return Generator of Strings representing the keys in the S3 data-store
+ * @param key String representing the key for the item to get
+ * @param offset Long Long Integer representing the offset to start reading at
+ * @param buffer Character Pointer representing the buffer to read into
+ * @param bufferSize Long Long Integer representing the number of bytes to read
+ * @return Long Long Integer representing the bytes read (zero if the offset
+ *         is past the end of the value) or -1 if the read failed
  */
-std::shared_ptr<StandardModel::Generator<std::string>> S3DataStore::listItems(
-        const std::string& prefix)
+long long int S3DataStore::getItemRange(const std::string& key, long long int offset,
+        char* buffer, long long int bufferSize)
 {
 
-    // Create and return a generator for getting the S3 Data-Store elements
-    auto bucket = _bucket;
-    auto directory = _directory;
-    auto s3Client = _s3Client;
-    return std::make_shared<StandardModel::Generator<std::string>>(
-            [bucket, directory, s3Client, prefix]
-            (std::shared_ptr<StandardModel::Yieldable<std::string>> yielder)
+    // Read the range from whichever version of the value is current
+    std::string eTag;
+    bool wasReplaced = false;
+    long long int objectSize = -1;
+    return readItemRange(key, offset, buffer, bufferSize, eTag, wasReplaced, objectSize);
+}
+
+/**
+ * Internal function used to read the given range of the value for the
+ * given key directly into the given (caller-owned) buffer, only reading
+ * from the version of the value with the given ETag (if one is given)
+ *
+ * @param key String representing the key for the item to get
+ * @param offset Long Long Integer representing the offset to start reading at
+ * @param buffer Character Pointer representing the buffer to read into
+ * @param bufferSize Long Long Integer representing the number of bytes to read
+ * @param eTag String representing the ETag the value must have (or empty for
+ *             any version) which is set to the ETag of the value read
+ * @param wasReplaced Boolean set to indicate the value no longer has the ETag
+ * @param objectSize Long Long Integer set to the value's total size (if the
+ *                   read reported it) or left unchanged otherwise
+ * @return Long Long Integer representing the bytes read (zero if the offset
+ *         is past the end of the value) or -1 if the read failed
+ */
+long long int S3DataStore::readItemRange(const std::string& key, long long int offset,
+        char* buffer, long long int bufferSize, std::string& eTag, bool& wasReplaced,
+        long long int& objectSize)
+{
+
+    // Create the return value
+    long long int bytesRead = -1;
+    wasReplaced = false;
+
+    // Only process if the key isn't empty and the range is valid
+    if (!key.empty() && (offset >= 0) && (buffer != nullptr) && (bufferSize > 0))
+    {
+
+        // Setup the output stream-buffer over the caller's buffer
+        typedef boost::iostreams::basic_array_sink<char> BufferStream;
+        boost::iostreams::stream_buffer<BufferStream> outputDataRaw(buffer, (size_t) bufferSize);
+
+        // Create the (ranged) Get Object request
+        Aws::S3::Model::GetObjectRequest getObjectRequest;
+        getObjectRequest.WithBucket(_bucket).WithKey(_directory + "/" + Aws::String(key))
+                .WithRange(Aws::String("bytes=" + std::to_string(offset) + "-"
+                        + std::to_string(offset + bufferSize - 1)));
+        if (!eTag.empty())
+            getObjectRequest.SetIfMatch(Aws::String(eTag.c_str()));
+
+        // Have the response body written directly into the caller's buffer
+        // NOTE: The AWS SDK takes ownership of (and releases) the stream
+        getObjectRequest.SetResponseStreamFactory([&outputDataRaw]()
         {
+            return Aws::New<Aws::IOStream>("S3DataStore", &outputDataRaw);
+        });
 
-            // Run in a loop to list/delete everything
-            bool keepListing = true;
-            bool wasTruncated = false;
-            Aws::String previousMarker;
-            while (keepListing)
-            {
+        // Actually perform the request on the given client
+        auto getObjectOutcome = _s3Client->GetObject(getObjectRequest);
 
-                // Exit the loop early if the generator terminated
-                if (yielder->isTerminated())
-                    break;
+        // Determine how many bytes were read (reading past the end reads nothing)
+        // and which version of the value they were read from
+        // NOTE: The ETag's pre-condition is checked before the range is, so a
+        //       replaced value is always reported as such
+        if (getObjectOutcome.IsSuccess())
+        {
+            bytesRead = std::min(getObjectOutcome.GetResult().GetContentLength(), bufferSize);
+            eTag = getObjectOutcome.GetResult().GetETag().c_str();
+
+            // Extract the value's total size from the Content-Range (ie. "bytes 0-9/10")
+            const auto& contentRange = getObjectOutcome.GetResult().GetContentRange();
+            auto sizeStart = contentRange.find('/');
+            if ((sizeStart != Aws::String::npos) && (sizeStart + 1 < contentRange.size())
+                    && std::isdigit((unsigned char) contentRange[sizeStart + 1]))
+                objectSize = std::strtoll(contentRange.c_str() + sizeStart + 1, nullptr, 10);
+        }
+        else if (getObjectOutcome.GetError().GetResponseCode()
+                == Aws::Http::HttpResponseCode::REQUESTED_RANGE_NOT_SATISFIABLE)
+            bytesRead = 0;
+        else if (getObjectOutcome.GetError().GetResponseCode()
+                == Aws::Http::HttpResponseCode::PRECONDITION_FAILED)
+            wasReplaced = true;
+    }
 
-                // Construct the list-objects request
-                Aws::S3::Model::ListObjectsRequest listObjectsRequest;
-                listObjectsRequest.WithBucket(bucket).WithPrefix(directory + Aws::String("/" + prefix));
+    // Return the return value
+    return bytesRead;
+}
 
-                // Add in the marker from the previous listing (if applicable)
-                if (wasTruncated)
-                    listObjectsRequest.WithMarker(previousMarker);
+/**
+ * Function used to replace the value for the given key only if the value
+ * has not changed since it was read (i.e. it still has the expected ETag)
+ * NOTE: This is a single (atomic) conditional write
+ *
+ * @param key String representing the key for the item to replace
+ * @param expectedETag String representing the ETag the value must still have
+ * @param item String item to replace the value with
+ * @return Boolean indicating whether the value was replaced or not
+ */
+bool S3DataStore::compareAndSet(const std::string& key, const std::string& expectedETag,
+        const std::string& item)
+{
 
-                // Actually perform the request
-                auto objectListing = s3Client->ListObjects(listObjectsRequest);
+    // Create a return flag
+    bool wasSet = false;
 
-                // Only continue if the operation was successful
-                if (objectListing.IsSuccess())
-                {
+    // Only process if there is an ETag to compare against
+    if (!expectedETag.empty())
+    {
 
-                    // Loop through all of the results and extract all object keys
-                    // and yield them to the input yielder
-                    auto objectList = objectListing.GetResult().GetContents();
-                    for (const auto& s3Object : objectList)
-                    {
-                        Aws::String keyString = s3Object.GetKey();
-                        keyString.erase(0, directory.size() + 1);
+        // Replace the item (tracking its size) only if it still matches
+        wasSet = addItemAndTrackSize(key, item, expectedETag, "");
 
-                        // Exit the loop early if the generator terminated
-                        if (yielder->isTerminated())
-                            break;
+        // If the operation was successful, record the updated internal metadata
+        if (wasSet)
+            markMetaDataChanged();
+    }
 
-                        // Only yield items that don't start with a '.'
-                        if ((keyString[0] != '.') && (!keyString.empty()))
-                            yielder->yield(keyString.c_str());
-                    }
+    // Return the return flag
+    return wasSet;
+}
 
-                    // Determine if we need to keep looping (i.e. if the response was truncated)
-                    wasTruncated = objectListing.GetResult().GetIsTruncated();
-                    previousMarker = objectListing.GetResult().GetNextMarker();
-                    keepListing = wasTruncated;
-                }
+/**
+ * Function used to add an item to the s3-data-store only if no
+ * value already exists for the given key
+ * NOTE: This is a single (atomic) conditional write
+ *
+ * @param key String representing the key for the item to add
+ * @param item String item to add to the data store
+ * @return Boolean indicating whether the item was added or not
+ */
+bool S3DataStore::putIfAbsent(const std::string& key, const std::string& item)
+{
 
-                // Handle the case where the object listing failed (return false)
-                else
-                {
+    // Add the item (tracking its size) only if it does not exist
+    bool wasAdded = addItemAndTrackSize(key, item, "", "*");
 
-                    // Indicate to stop listing (and exit the loop) if an error occurred
-                    keepListing = false;
-                }
-            }
+    // If the operation was successful, record the updated internal metadata
+    if (wasAdded)
+        markMetaDataChanged();
 
-            // Complete the yielder
-            yielder->complete();
+    // Return the return flag
+    return wasAdded;
+}
+
+/**
+ * Function used to get the values for the given keys in a single batch
+ * NOTE: Values are read in parallel, up to the given concurrency
+ *
+ * @param keys Vector of Strings representing the keys for the items to get
+ * @param maxConcurrency Unsigned Long representing the maximum requests in-flight
+ * @return Unordered String-String map of each key to its value (empty if missing)
+ */
+std::unordered_map<std::string, std::string> S3DataStore::getItems(
+        const std::vector<std::string>& keys, unsigned long maxConcurrency)
+{
+
+    // Read all of the items in parallel into their own slots
+    std::vector<std::string> values(keys.size());
+    runBatch(keys.size(), maxConcurrency, [this, &keys, &values](unsigned long index)
+        {
+            values[index] = getItem(keys[index]);
         });
+
+    // Build-up and return the key-value results
+    std::unordered_map<std::string, std::string> retMap;
+    for (unsigned long ii = 0; ii < keys.size(); ii++)
+        retMap[keys[ii]] = values[ii];
+    return retMap;
 }
 
 /**
- * Function used to get the S3-Data-Store size
- * NOTE: This only accounts for object raw data
+ * Function used to add the given items to the s3-data-store in a single batch
+ * NOTE: Items are written in parallel, up to the given concurrency, and the
+ *       metadata is only updated once for the entire batch
  *
- * @return Long representing the size in bytes
+ * @param items Unordered String-String map representing the key-value items to add
+ * @param maxConcurrency Unsigned Long representing the maximum requests in-flight
+ * @return Boolean indicating whether all of the items were added or not
  */
-long S3DataStore::getSize()
+bool S3DataStore::addItems(const std::unordered_map<std::string, std::string>& items,
+        unsigned long maxConcurrency)
 {
-    // Get and return the internally tracked size
-    return _internalMd.dataSize;
+
+    // Index the items so that they can be divided-up between the workers
+    std::vector<const std::pair<const std::string, std::string>*> indexedItems;
+    for (const auto& item : items)
+        indexedItems.push_back(&item);
+
+    // Write all of the items in parallel (tracking any failures)
+    std::atomic<unsigned long> addedCount(0);
+    runBatch(indexedItems.size(), maxConcurrency,
+        [this, &indexedItems, &addedCount](unsigned long index)
+        {
+            if (addItemAndTrackSize(indexedItems[index]->first, indexedItems[index]->second))
+                addedCount++;
+        });
+
+    // Record the updated internal metadata once for the batch
+    if (addedCount > 0)
+        markMetaDataChanged(addedCount);
+
+    // Return whether all of the items were added
+    return (addedCount == indexedItems.size());
 }
 
 /**
- * Function used to delete the given item from the key-value s3-data-store
+ * Function used to delete the given items from the s3-data-store in a single batch
+ * NOTE: The metadata is only updated once for the entire batch
+ *
+ * @param keys Vector of Strings representing the keys for the items to delete
+ * @param supportsMultiDelete Boolean indicating whether the back-end
+ *                            cloud provider supports multi-item S3 delete
+ * @param maxConcurrency Unsigned Long representing the maximum requests in-flight
+ * @return Boolean indicating whether all of the items were deleted or not
+ */
+bool S3DataStore::deleteItems(const std::vector<std::string>& keys,
+        bool supportsMultiDelete, unsigned long maxConcurrency)
+{
+
+    // Create a return flag
+    bool retFlag = true;
+
+    // Remove any duplicate keys and order them so that write access
+    // to the keys is always taken in the same order
+    std::vector<std::string> uniqueKeys;
+    for (const auto& key : keys)
+    {
+        if (key.empty())
+            retFlag = false;
+        else
+            uniqueKeys.push_back(key);
+    }
+    std::sort(uniqueKeys.begin(), uniqueKeys.end());
+    uniqueKeys.erase(std::unique(uniqueKeys.begin(), uniqueKeys.end()), uniqueKeys.end());
+
+    // If the backend does not support multi-item delete, then delete
+    // the object keys one-by-one (in parallel)
+    unsigned long deletedCount = 0;
+    if (!supportsMultiDelete)
+    {
+
+        // Delete all of the items in parallel (tracking any failures)
+        std::atomic<bool> allDeleted(true);
+        std::atomic<unsigned long> trackedDeletedCount(0);
+        runBatch(uniqueKeys.size(), maxConcurrency,
+            [this, &uniqueKeys, &allDeleted, &trackedDeletedCount](unsigned long index)
+            {
+                if (!deleteItemAndTrackSize(uniqueKeys[index]))
+                    allDeleted = false;
+                else if (uniqueKeys[index][0] != '.')
+                    trackedDeletedCount++;
+            });
+        retFlag &= allDeleted;
+        deletedCount = trackedDeletedCount;
+    }
+
+    // Otherwise delete the keys using multi-item delete requests
+    // of (at most) 1000 keys each - the S3 limit per request
+    else
+    {
+
+        // Loop through each chunk of keys
+        const unsigned long chunkSize = 1000;
+        for (unsigned long chunkStart = 0; chunkStart < uniqueKeys.size(); chunkStart += chunkSize)
+        {
+
+            // Take write access to the keys in the chunk so they are sized in order
+            auto chunkEnd = std::min(chunkStart + chunkSize, (unsigned long) uniqueKeys.size());
+            for (auto ii = chunkStart; ii < chunkEnd; ii++)
+                acquireKey(uniqueKeys[ii]);
+
+            // Get the objects' original sizes (in the bucket) in parallel
+            std::vector<long long int> origSizes(chunkEnd - chunkStart);
+            runBatch(origSizes.size(), maxConcurrency,
+                [this, &uniqueKeys, &origSizes, chunkStart](unsigned long index)
+                {
+                    if (uniqueKeys[chunkStart + index][0] != '.')
+                        origSizes[index] = getObjectSize(uniqueKeys[chunkStart + index]);
+                });
+
+            // Create the multi-item delete request for the chunk
+            Aws::Vector<Aws::S3::Model::ObjectIdentifier> deleteVect;
+            for (auto ii = chunkStart; ii < chunkEnd; ii++)
+                deleteVect.push_back(Aws::S3::Model::ObjectIdentifier().WithKey(
+                        _directory + "/" + Aws::String(uniqueKeys[ii])));
+            auto deleteObjects = Aws::S3::Model::Delete().WithObjects(deleteVect).WithQuiet(true);
+            Aws::S3::Model::DeleteObjectsRequest deleteObjectsRequest;
+            deleteObjectsRequest.WithBucket(_bucket).WithDelete(deleteObjects);
+
+            // Actually perform the object deletion and determine which (if any) failed
+            std::unordered_set<std::string> failedKeys;
+            auto deleteObjectsOutcome = _s3Client->DeleteObjects(deleteObjectsRequest);
+            if (deleteObjectsOutcome.IsSuccess())
+            {
+                for (const auto& deleteError : deleteObjectsOutcome.GetResult().GetErrors())
+                {
+                    Aws::String keyString = deleteError.GetKey();
+                    keyString.erase(0, _directory.size() + 1);
+                    failedKeys.insert(keyString.c_str());
+                }
+            }
+            retFlag &= (deleteObjectsOutcome.IsSuccess() && failedKeys.empty());
+
+            // Update the size of the deleted items in the metadata
+            // Do this in a separate context to leverage RAII for the mutex/lock
+            if (deleteObjectsOutcome.IsSuccess())
+            {
+
+                // Lock the thread for safe operation
+                std::unique_lock<std::mutex> lock(_sync->lock);
+
+                // Remove each deleted item's size (ignoring keys which begin with a '.')
+                for (auto ii = chunkStart; ii < chunkEnd; ii++)
+                {
+                    if (failedKeys.find(uniqueKeys[ii]) == failedKeys.end())
+                    {
+                        recordObjectSizeUnlocked(uniqueKeys[ii], 0);
+                        if (uniqueKeys[ii][0] != '.')
+                        {
+                            _internalMd.dataSize -= origSizes[ii - chunkStart];
+                            _memoizationMap.erase(uniqueKeys[ii]);
+                            deletedCount++;
+                        }
+                    }
+                }
+            }
+
+            // Invalidate any cached versions of the objects in the chunk
+            for (auto ii = chunkStart; ii < chunkEnd; ii++)
+                invalidateCachedItem(uniqueKeys[ii]);
+
+            // Release write access to the keys in the chunk
+            for (auto ii = chunkStart; ii < chunkEnd; ii++)
+                releaseKey(uniqueKeys[ii]);
+        }
+    }
+
+    // Record the updated internal metadata once for the batch
+    if (deletedCount > 0)
+        markMetaDataChanged(deletedCount);
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Function used to add an item to the s3-data-store asynchronously
+ * NOTE: The instance must outlive the returned future
+ *
+ * @param key String representing the key for the item to add
+ * @param item String item to add to the data store
+ * @return Future of the Boolean indicating whether the item was added or not
+ */
+std::future<bool> S3DataStore::addItemAsync(const std::string& key, std::string item)
+{
+
+    // Setup the promise to be fulfilled once the item is added
+    auto resultPromise = std::make_shared<std::promise<bool>>();
+    auto resultFuture = resultPromise->get_future();
+
+    // Add the item on the asynchronous thread-pool
+    auto itemValue = std::make_shared<std::string>(std::move(item));
+    runAsync([this, resultPromise, key, itemValue]()
+        {
+            resultPromise->set_value(addItem(key, *itemValue));
+        });
+
+    // Return the future for the result
+    return resultFuture;
+}
+
+/**
+ * Function used to get the value for the given key asynchronously
+ * NOTE: The instance must outlive the returned future
+ *
+ * @param key String representing the key for the item to get
+ * @return Future of the String representing the value for the given key
+ */
+std::future<std::string> S3DataStore::getItemAsync(const std::string& key)
+{
+
+    // Setup the promise to be fulfilled once the item is read
+    auto resultPromise = std::make_shared<std::promise<std::string>>();
+    auto resultFuture = resultPromise->get_future();
+
+    // Get the item on the asynchronous thread-pool
+    runAsync([this, resultPromise, key]()
+        {
+            resultPromise->set_value(getItem(key));
+        });
+
+    // Return the future for the result
+    return resultFuture;
+}
+
+/**
+ * Function used to delete the given item from the s3-data-store asynchronously
+ * NOTE: The instance must outlive the returned future
+ *
+ * @param key String representing the key for the item to delete
+ * @return Future of the Boolean indicating whether the item was deleted or not
+ */
+std::future<bool> S3DataStore::deleteItemAsync(const std::string& key)
+{
+
+    // Setup the promise to be fulfilled once the item is deleted
+    auto resultPromise = std::make_shared<std::promise<bool>>();
+    auto resultFuture = resultPromise->get_future();
+
+    // Delete the item on the asynchronous thread-pool
+    runAsync([this, resultPromise, key]()
+        {
+            resultPromise->set_value(deleteItem(key));
+        });
+
+    // Return the future for the result
+    return resultFuture;
+}
+
+/**
+ * Function used to get the given object's size
+ *
+ * @param key String representing the key for the item to get
+ * @return Long Long Integer representing the object's size in bytes
+ */
+long long int S3DataStore::getObjectSize(const std::string& key)
+{
+
+    // Create the return value
+    long long int retValue = 0;
+
+    // Only process if the key isn't empty
+    if (!key.empty())
+    {
+
+        // Attempt to get the value from the memoization map or known sizes
+        // Do this in a separate context to leverage RAII for the mutex/lock
+        bool isKnown = false;
+        {
+
+            // Lock the thread for safe operation
+            std::unique_lock<std::mutex> lock(_sync->lock);
+
+            // We always trust the current map value so use it
+            // as long as it exists, otherwise fall-back to the
+            // size last read, written or listed for the object
+            // NOTE: Objects without a known size are always looked-up
+            //       since other processes may have written them
+            auto memoIter = _memoizationMap.find(key);
+            auto sizeIter = _objectSizes.find(key);
+            if (memoIter != _memoizationMap.end())
+            {
+                retValue = memoIter->second.size;
+                isKnown = true;
+            }
+            else if (sizeIter != _objectSizes.end())
+            {
+                retValue = sizeIter->second;
+                isKnown = true;
+            }
+        }
+
+        // Only look-up the object's size in the cloud if it isn't already known
+        if (!isKnown)
+            retValue = reconcileObjectSize(key);
+    }
+
+    // Return the return value
+    return retValue;
+}
+
+/**
+ * Internal function used to invalidate (remove) any cached versions
+ * of the given object from the in-memory and on-disk caches
+ *
+ * @param key String representing the key for the object
+ */
+void S3DataStore::invalidateCachedItem(const std::string& key)
+{
+
+    // Remove the object from the in-memory cache (if enabled)
+    auto objectCache = getObjectCache();
+    if (objectCache != nullptr)
+        objectCache->removeItem(key);
+
+    // Remove the object from the on-disk cache (if enabled)
+    auto diskCache = getDiskCache();
+    if (diskCache != nullptr)
+        diskCache->removeItem(getDiskCacheKey(key));
+}
+
+/**
+ * Internal function used to get the on-disk cache key for the given key
+ * NOTE: This includes the bucket and directory so that on-disk caches can
+ *       be safely re-used across s3-data-stores
+ *
+ * @param key String representing the key for the object
+ * @return String representing the object's on-disk cache key
+ */
+std::string S3DataStore::getDiskCacheKey(const std::string& key) const
+{
+
+    // Return the fully qualified object key
+    return getRegistryKey() + "/" + key;
+}
+
+/**
+ * Internal function used to look-up the given object's size in the
+ * s3-data-store, removing it from the memoization map if it matches
+ *
+ * @param key String representing the key for the object
+ * @return Long Long Integer representing the object's size in bytes
+ */
+long long int S3DataStore::reconcileObjectSize(const std::string& key)
+{
+
+    // Create the return value
+    long long int retValue = 0;
+
+    // Create the Head Object request
+    Aws::S3::Model::HeadObjectRequest headObjectRequest;
+    headObjectRequest.WithBucket(_bucket).WithKey(_directory + "/" + Aws::String(key));
+
+    // Actually perform the request on the given client
+    auto headObjectOutcome = _s3Client->HeadObject(headObjectRequest);
+
+    // Extract the object's size from the head-object response
+    // (where an object which was not found has no size)
+    bool isSizeKnown = headObjectOutcome.IsSuccess();
+    if (isSizeKnown)
+        retValue = headObjectOutcome.GetResult().GetContentLength();
+    bool isKnown = (isSizeKnown || (headObjectOutcome.GetError().GetResponseCode()
+            == Aws::Http::HttpResponseCode::NOT_FOUND));
+
+    // Update the local state based on the cloud value
+    // Do this in a separate context to leverage RAII for the mutex/lock
+    {
+
+        // Lock the thread for safe operation
+        std::unique_lock<std::mutex> lock(_sync->lock);
+
+        // Record the object's size (unless a write has already recorded it)
+        if (isKnown)
+            recordObjectSizeUnlocked(key, retValue, false);
+
+        // If the memoization map's value is the same as the cloud
+        // value then remove the value from the memoization map
+        // since things are synchronized, otherwise back-off the
+        // next check of the value exponentially
+        auto memoIter = _memoizationMap.find(key);
+        if (isKnown && (memoIter != _memoizationMap.end()) && (memoIter->second.size == retValue))
+        {
+            _memoizationMap.erase(memoIter);
+        }
+        else if (memoIter != _memoizationMap.end())
+        {
+            auto recheckDelayMs = _sync->reconcileMaxDelayMs;
+            if (memoIter->second.rechecks < 30)
+                recheckDelayMs = std::min(recheckDelayMs,
+                        (_sync->reconcileInitialDelayMs << memoIter->second.rechecks));
+            memoIter->second.rechecks++;
+            memoIter->second.nextCheck = (std::chrono::steady_clock::now()
+                    + std::chrono::milliseconds(recheckDelayMs));
+        }
+    }
+
+    // Return the return value
+    return retValue;
+}
+
+/**
+ * Internal function used to record the given object's (known) size,
+ * evicting another object's size if too many sizes are known
+ * NOTE: The instance's lock must be held when calling this function
+ *
+ * @param key String representing the key for the object
+ * @param size Long Long Integer representing the object's size in bytes
+ * @param replace Boolean indicating whether to replace an existing size
+ */
+void S3DataStore::recordObjectSizeUnlocked(const std::string& key, long long int size, bool replace)
+{
+
+    // Update the object's size if it is already known
+    auto sizeIter = _objectSizes.find(key);
+    if (sizeIter != _objectSizes.end())
+    {
+        if (replace)
+            sizeIter->second = size;
+    }
+
+    // Otherwise, record the object's size, evicting an (arbitrary) other
+    // object's size to make room if needed since it can always be looked-up
+    else
+    {
+        if (_objectSizes.size() >= MAX_KNOWN_OBJECT_SIZES)
+            _objectSizes.erase(_objectSizes.begin());
+        _objectSizes.emplace(key, size);
+    }
+}
+
+/**
+ * Function used to list all of the items in the S3 Data-store
+ * NOTE: This will effectively translate to S3-list operation(s) where the
+ *       next page is always requested before the current page is yielded
+ *
+ * @param prefix String representing the object-key prefix to use (if any)
+ * @param maxConcurrency Unsigned Long representing the number of key-ranges to
+ *                       list in parallel (keys are still yielded in order),
+ *                       which are split based on a sample of the stored keys
+ * @return Generator of Strings representing the keys in the S3 data-store
+ */
+std::shared_ptr<StandardModel::Generator<std::string>> S3DataStore::listItems(
+        const std::string& prefix, unsigned long maxConcurrency)
+{
+
+    // Create and return a generator for getting the S3 Data-Store elements
+    auto bucket = _bucket;
+    auto directory = _directory;
+    auto s3Client = _s3Client;
+    auto shardCount = std::max(maxConcurrency, 1UL);
+    return std::make_shared<StandardModel::Generator<std::string>>(
+            [bucket, directory, s3Client, prefix, shardCount]
+            (std::shared_ptr<StandardModel::Yieldable<std::string>> yielder)
+        {
+
+            // Setup the state of each (contiguous) key-range being listed
+            struct ListingShard
+            {
+                Aws::String startAfter;
+                Aws::String lastKey;
+                Aws::String continuationToken;
+                std::vector<std::string> keys;
+                Aws::S3::Model::ListObjectsV2OutcomeCallable pendingPage;
+                unsigned long bufferedPages;
+                bool isDone;
+            };
+
+            // Split the key-space after the prefix into key-ranges based on the
+            // keys actually stored, such that each range lists the keys after its
+            // start key up to (and including) the next range's start key
+            Aws::String listPrefix = directory + Aws::String("/" + prefix);
+            std::vector<Aws::String> splitKeys;
+            if (shardCount > 1)
+            {
+
+                // Sample the first page of the listing (rolled-up by "directory")
+                Aws::S3::Model::ListObjectsV2Request sampleRequest;
+                sampleRequest.WithBucket(bucket).WithPrefix(listPrefix).WithDelimiter("/");
+                auto sampleListing = s3Client->ListObjectsV2(sampleRequest);
+                if (sampleListing.IsSuccess())
+                {
+
+                    // If the keys are grouped into "directories", split the
+                    // ranges evenly between the listed common-prefixes
+                    const auto& commonPrefixes = sampleListing.GetResult().GetCommonPrefixes();
+                    if (commonPrefixes.size() > 1)
+                    {
+                        for (unsigned long ii = 1; ii < shardCount; ii++)
+                            splitKeys.push_back(commonPrefixes[
+                                    (ii * commonPrefixes.size()) / shardCount].GetPrefix());
+                    }
+
+                    // Otherwise, if the keys span multiple pages, split the ranges
+                    // evenly over the (two-character) key-space spanned by the
+                    // characters used in the sampled keys
+                    // NOTE: This keeps the ranges even for hashed (ie. hex) keys
+                    else if (sampleListing.GetResult().GetIsTruncated())
+                    {
+                        std::set<unsigned char> keyCharSet;
+                        for (const auto& s3Object : sampleListing.GetResult().GetContents())
+                            keyCharSet.insert(s3Object.GetKey().begin() + listPrefix.size(),
+                                    s3Object.GetKey().end());
+                        std::vector<char> keyChars(keyCharSet.begin(), keyCharSet.end());
+                        for (unsigned long ii = 1; (ii < shardCount) && !keyChars.empty(); ii++)
+                        {
+                            auto splitIndex = (ii * keyChars.size() * keyChars.size()) / shardCount;
+                            splitKeys.push_back(listPrefix
+                                    + keyChars[splitIndex / keyChars.size()]
+                                    + keyChars[splitIndex % keyChars.size()]);
+                        }
+                    }
+                    splitKeys.erase(std::unique(splitKeys.begin(), splitKeys.end()), splitKeys.end());
+                }
+            }
+
+            // Setup the key-ranges on the chosen split keys
+            std::vector<ListingShard> shards(splitKeys.size() + 1);
+            for (unsigned long ii = 0; ii < shards.size(); ii++)
+            {
+                shards[ii].isDone = false;
+                shards[ii].bufferedPages = 0;
+                if (ii > 0)
+                    shards[ii].startAfter = splitKeys[ii - 1];
+                if (ii < splitKeys.size())
+                    shards[ii].lastKey = splitKeys[ii];
+            }
+
+            // Setup the function used to (asynchronously) request the next page of a key-range
+            auto requestPage = [bucket, s3Client, listPrefix](ListingShard& shard)
+            {
+                Aws::S3::Model::ListObjectsV2Request listObjectsRequest;
+                listObjectsRequest.WithBucket(bucket).WithPrefix(listPrefix);
+                if (!shard.continuationToken.empty())
+                    listObjectsRequest.WithContinuationToken(shard.continuationToken);
+                else if (!shard.startAfter.empty())
+                    listObjectsRequest.WithStartAfter(shard.startAfter);
+                shard.pendingPage = s3Client->ListObjectsV2Callable(listObjectsRequest);
+            };
+
+            // Setup the function used to wait for the requested page of a key-range,
+            // buffer its keys and immediately request the following page (if any)
+            // unless the key-range already has as many pages buffered as allowed
+            bool listingFailed = false;
+            auto receivePage = [directory, &requestPage, &listingFailed](ListingShard& shard)
+            {
+
+                // Wait for the page, stopping the listing if the request failed
+                auto objectListing = shard.pendingPage.get();
+                if (!objectListing.IsSuccess())
+                {
+                    listingFailed = true;
+                    shard.isDone = true;
+                    return;
+                }
+
+                // Buffer the keys which are within the key-range
+                for (const auto& s3Object : objectListing.GetResult().GetContents())
+                {
+                    if (!shard.lastKey.empty() && (s3Object.GetKey() > shard.lastKey))
+                    {
+                        shard.isDone = true;
+                        break;
+                    }
+                    Aws::String keyString = s3Object.GetKey();
+                    keyString.erase(0, directory.size() + 1);
+                    shard.keys.push_back(keyString.c_str());
+                }
+
+                // Request the following page (if needed) before the keys are yielded
+                shard.bufferedPages++;
+                if (!shard.isDone && objectListing.GetResult().GetIsTruncated())
+                {
+                    shard.continuationToken = objectListing.GetResult().GetNextContinuationToken();
+                    if (shard.bufferedPages < MAX_BUFFERED_LISTING_PAGES)
+                        requestPage(shard);
+                }
+                else
+                    shard.isDone = true;
+            };
+
+            // Start listing each of the key-ranges in parallel
+            for (auto& shard : shards)
+                requestPage(shard);
+
+            // Yield the keys of each key-range in order (to keep the keys sorted)
+            for (unsigned long ii = 0; (ii < shards.size()) && !listingFailed; ii++)
+            {
+
+                // Continuously yield the buffered keys and wait for the next page
+                auto& shard = shards[ii];
+                while (!listingFailed && !yielder->isTerminated())
+                {
+
+                    // Yield the buffered keys (only yielding items that don't start with a '.')
+                    for (const auto& keyString : shard.keys)
+                    {
+
+                        // Exit the loop early if the generator terminated
+                        if (yielder->isTerminated())
+                            break;
+
+                        // Only yield items that don't start with a '.'
+                        if (!keyString.empty() && (keyString[0] != '.'))
+                            yielder->yield(keyString);
+                    }
+                    shard.keys.clear();
+                    shard.bufferedPages = 0;
+
+                    // Move on to the next key-range once this one has been fully listed
+                    if (shard.isDone)
+                        break;
+
+                    // Keep the later key-ranges' listings going while they wait their turn
+                    for (auto jj = ii + 1; jj < shards.size(); jj++)
+                        if (shards[jj].pendingPage.valid() && (shards[jj].pendingPage.wait_for(
+                                std::chrono::seconds(0)) == std::future_status::ready))
+                            receivePage(shards[jj]);
+
+                    // Wait for the key-range's next page (requesting it first if the
+                    // key-range was paused for having too many pages buffered)
+                    if (!shard.pendingPage.valid())
+                        requestPage(shard);
+                    receivePage(shard);
+                }
+
+                // Exit the loop early if the generator terminated
+                if (yielder->isTerminated())
+                    break;
+            }
+
+            // Wait for any requests still in-flight (as they use the client)
+            for (auto& shard : shards)
+                if (shard.pendingPage.valid())
+                    shard.pendingPage.wait();
+
+            // Complete the yielder
+            yielder->complete();
+        });
+}
+
+/**
+ * Function used to get the S3-Data-Store size
+ * NOTE: This only accounts for object raw data
+ *
+ * @return Long representing the size in bytes
+ */
+long S3DataStore::getSize()
+{
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_sync->lock);
+
+    // Get and return the internally tracked size
+    return _internalMd.dataSize;
+}
+
+/**
+ * Function used to delete the given item from the key-value s3-data-store
+ *
+ * @param key String representing the key for the item to delete
+ * @return Boolean indicating whether the item was deleted or not
+ */
+bool S3DataStore::deleteItem(const std::string& key)
+{
+
+    // Delete the item (tracking its size) from the s3-bucket
+    bool wasDeleted = deleteItemAndTrackSize(key);
+
+    // If the operation was successful, record the updated internal metadata
+    // NOTE: Do not do this if the key deleted begins with a '.'
+    if (wasDeleted && (key[0] != '.'))
+        markMetaDataChanged();
+
+    // Return the return flag
+    return wasDeleted;
+}
+
+/**
+ * Function used to delete the entire s3-data-store bucket directory
+ *
+ * @param supportsMultiDelete Boolean indicating whether the back-end
+ *                            cloud provider supports multi-item S3 delete
+ * @return Boolean indicating if all of the items were deleted or no
+ */
+bool S3DataStore::deleteEntireDataStore(bool supportsMultiDelete)
+{
+
+    // Create a return flag
+    bool retFlag = true;
+
+    // Run in a loop to list/delete everything
+    bool keepListing = true;
+    bool wasTruncated = false;
+    Aws::String previousMarker;
+    while (keepListing)
+    {
+
+        // Construct the list-objects request
+        Aws::S3::Model::ListObjectsRequest listObjectsRequest;
+        listObjectsRequest.WithBucket(_bucket).WithPrefix(_directory);
+
+        // Add in the marker from the previous listing (if applicable)
+        if (wasTruncated)
+            listObjectsRequest.WithMarker(previousMarker);
+
+        // Actually perform the request
+        auto objectListing = _s3Client->ListObjects(listObjectsRequest);
+
+        // Only continue if the operation was successful
+        if (objectListing.IsSuccess())
+        {
+
+            // Loop through all of the results and extract all object keys
+            Aws::Vector<Aws::S3::Model::ObjectIdentifier> deleteVect;
+            auto objectList = objectListing.GetResult().GetContents();
+            for (const auto& s3Object : objectList)
+                deleteVect.push_back(Aws::S3::Model::ObjectIdentifier().WithKey(s3Object.GetKey()));
+
+            // If the backend supports multi-item deletion, delete all keys
+            // at the same time using a single request
+            if (supportsMultiDelete && !deleteVect.empty())
+            {
+
+                // Create the multi-item delete request
+                auto deleteItems = Aws::S3::Model::Delete().WithObjects(deleteVect);
+                Aws::S3::Model::DeleteObjectsRequest deleteObjectsRequest;
+                deleteObjectsRequest.WithBucket(_bucket).WithDelete(deleteItems);
+
+                // Actually perform the object deletion
+                retFlag &= _s3Client->DeleteObjects(deleteObjectsRequest).IsSuccess();
+            }
+
+            // If the backend does not support multi-item delete, then delete
+            // the listed object keys one-by-one
+            else
+            {
+
+                // Loop through all of the items and delete them individually
+                for (const auto& item : deleteVect)
+                {
+
+                    // Obtain the key from the object
+                    Aws::String keyString = item.GetKey();
+
+                    // Strip-off the directory and delete the object by key
+                    keyString.erase(0, _directory.size() + 1);
+                    retFlag &= deleteItem(keyString.c_str());
+                }
+            }
+
+            // Determine if we need to keep looping (i.e. if the response was truncated)
+            wasTruncated = objectListing.GetResult().GetIsTruncated();
+            keepListing = wasTruncated;
+        }
+
+        // Handle the case where the object listing failed (return false)
+        else
+        {
+
+            // Setup the return value and exit the loop
+            keepListing = false;
+            retFlag = false;
+        }
+    }
+
+    // Invalidate every cached object (even if only some of the objects were deleted)
+    auto objectCache = getObjectCache();
+    if (objectCache != nullptr)
+        objectCache->clear();
+    auto diskCache = getDiskCache();
+    if (diskCache != nullptr)
+        diskCache->clear();
+
+    // Handle any local and cloud metadata changes on success
+    if (retFlag)
+    {
+
+        // Lock the thread for safe operation
+        std::unique_lock<std::mutex> lock(_sync->lock);
+
+        // Make sure we also completely dump the memoization cache
+        // and the known object sizes
+        // NOTE: Objects are not assumed to be absent afterwards since
+        //       other processes may be writing to the same s3-data-store
+        _memoizationMap.clear();
+        _objectSizes.clear();
+
+        // Update the metadata accordingly
+        _internalMd.dataSize = 0;
+    }
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Function used to add a misc. metadata key-value pair to the S3-data-store
+ *
+ * @param key String representing the key for the metadata item
+ * @param value String representing the value for the metadata item
+ */
+void S3DataStore::setMiscMetadataValue(const std::string& key, const std::string& value)
+{
+
+    // Add-in the key-value pair/item for the metadata value
+    // Do this in a separate context to leverage RAII for the mutex/lock
+    {
+
+        // Lock the thread for safe operation
+        std::unique_lock<std::mutex> lock(_sync->lock);
+
+        // Set the metadata value
+        _internalMd.miscMetadata[key] = value;
+    }
+
+    // Sync/push the metadata back up to the cloud
+    markMetaDataChanged();
+    flushMetaData();
+}
+
+/**
+ * Function used to get a misc. metadata value for the given key in the S3-data-store
+ *
+ * @param key String representing the key for the metadata item
+ * @param defaultVal String representing the default value if the item doesn't exist
+ * @return String representing the value for the metadata item
+ */
+std::string S3DataStore::getMiscMetadataValue(const std::string& key, const std::string& defaultVal)
+{
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_sync->lock);
+
+    // Create a return string
+    std::string retString = defaultVal;
+
+    // Get the metadata value if it exists locally
+    auto mdIterator = _internalMd.miscMetadata.find(key);
+    if (mdIterator != _internalMd.miscMetadata.end())
+        retString = mdIterator->second;
+
+    // Return the return string
+    return retString;
+}
+
+/**
+ * Function used to set when the (coalesced) metadata is pushed out
+ * NOTE: Metadata is pushed out once the given number of changes have
+ *       been made or the given interval passes with changes pending
+ *
+ * @param changeThreshold Unsigned Long representing the changes to push out at
+ * @param intervalMs Long representing the push interval in milliseconds
+ *                   (or zero/negative to only push out at the threshold)
+ */
+void S3DataStore::setMetadataFlushPolicy(unsigned long changeThreshold, long intervalMs)
+{
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_sync->lock);
+
+    // Update the policy (ensuring the threshold is at least one change)
+    _sync->metadataFlushThreshold = (changeThreshold == 0 ? 1 : changeThreshold);
+    _sync->metadataFlushIntervalMs = intervalMs;
+
+    // Wake-up the flusher so that it picks-up the new policy
+    _sync->metadataChanged.notify_all();
+}
+
+/**
+ * Function used to set how written objects are reconciled with the
+ * (eventually consistent) s3-data-store in the background
+ * NOTE: Objects are re-checked with an exponentially growing delay
+ *
+ * @param maxConcurrency Unsigned Long representing the maximum look-ups in-flight
+ * @param initialDelayMs Long representing the delay before the first check
+ * @param maxDelayMs Long representing the maximum delay between checks
+ * @param shutdownDeadlineMs Long representing how long the instance waits
+ *                           for objects to be reconciled when released
+ */
+void S3DataStore::setReconcilePolicy(unsigned long maxConcurrency, long initialDelayMs,
+        long maxDelayMs, long shutdownDeadlineMs)
+{
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_sync->lock);
+
+    // Update the policy (ensuring at least one look-up in-flight and sane delays)
+    _sync->reconcileConcurrency = (maxConcurrency == 0 ? 1 : maxConcurrency);
+    _sync->reconcileInitialDelayMs = std::max(initialDelayMs, 1L);
+    _sync->reconcileMaxDelayMs = std::max(maxDelayMs, _sync->reconcileInitialDelayMs);
+    _sync->reconcileDeadlineMs = shutdownDeadlineMs;
+}
+
+/**
+ * Function used to set when (and how) large items are uploaded in parts
+ * NOTE: Items at or above the threshold are uploaded as a multipart
+ *       upload with the parts written in parallel
+ *
+ * @param thresholdBytes Unsigned Long Long representing the item size to upload in parts at
+ * @param partSizeBytes Unsigned Long Long representing the size of each part
+ *                      (at least 5 MiB as required by S3)
+ * @param maxConcurrency Unsigned Long representing the maximum parts in-flight
+ */
+void S3DataStore::setMultipartPolicy(unsigned long long thresholdBytes,
+        unsigned long long partSizeBytes, unsigned long maxConcurrency)
+{
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_sync->lock);
+
+    // Update the policy (ensuring non-empty items, valid parts and at least one part in-flight)
+    _sync->multipartThreshold = std::max(thresholdBytes, 1ULL);
+    _sync->multipartPartSize = std::max(partSizeBytes, (5ULL * 1024 * 1024));
+    _sync->multipartConcurrency = (maxConcurrency == 0 ? 1 : maxConcurrency);
+}
+
+/**
+ * Function used to enable (or disable) the in-process read-through cache
+ * of objects read with getItem
+ * NOTE: Cached objects are re-validated with a conditional read (which
+ *       only downloads the object if its ETag changed) once they are older
+ *       than the given age, and are invalidated by this instance's writes
+ *
+ * @param maxSize Unsigned Long Long representing the maximum bytes of
+ *                values to cache (or zero to disable the cache)
+ * @param revalidateAfterMs Long representing how long a cached object is
+ *                          served without being re-validated (or zero to
+ *                          re-validate the object on every read)
+ */
+void S3DataStore::enableObjectCache(unsigned long long maxSize, long revalidateAfterMs)
+{
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_sync->lock);
+
+    // Setup (or remove) the object cache and its policy
+    _objectCache = (maxSize > 0 ? std::make_shared<ObjectCache>(maxSize) : nullptr);
+    _sync->objectCacheRevalidateMs = revalidateAfterMs;
+}
+
+/**
+ * Function used to enable (or disable) the on-disk cache of objects read
+ * with getItem (consulted for objects which are not cached in-memory)
+ * NOTE: Objects cached on-disk survive restarts and are always re-validated
+ *       with a conditional read (which only downloads changed objects)
+ *
+ * @param directory String representing the directory to cache objects in
+ * @param maxSize Unsigned Long Long representing the maximum bytes of
+ *                objects to cache (or zero to disable the cache)
+ */
+void S3DataStore::enableDiskCache(const std::string& directory, unsigned long long maxSize)
+{
+
+    // Setup the disk cache (outside of the lock as it loads the cached objects)
+    auto diskCache = (maxSize > 0 ? std::make_shared<DiskCache>(directory, maxSize) : nullptr);
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_sync->lock);
+
+    // Setup (or remove) the disk cache
+    _diskCache = diskCache;
+}
+
+/**
+ * Function used to get the on-disk object cache (for its statistics)
+ *
+ * @return Disk Cache for the instance (or null if the cache is disabled)
+ */
+std::shared_ptr<DiskCache> S3DataStore::getDiskCache()
+{
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_sync->lock);
+
+    // Return the disk cache
+    return _diskCache;
+}
+
+/**
+ * Function used to get the in-process object cache (for its statistics)
+ *
+ * @return Object Cache for the instance (or null if the cache is disabled)
+ */
+std::shared_ptr<ObjectCache> S3DataStore::getObjectCache()
+{
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_sync->lock);
+
+    // Return the object cache
+    return _objectCache;
+}
+
+/**
+ * Function used to get the number of written objects which have not yet
+ * been reconciled with the (eventually consistent) s3-data-store
+ *
+ * @return Unsigned Long representing the number of unreconciled objects
+ */
+unsigned long S3DataStore::getUnreconciledCount()
+{
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_sync->lock);
+
+    // Return the number of unreconciled objects
+    return _memoizationMap.size();
+}
+
+/**
+ * Function used to immediately push out any pending metadata changes
+ *
+ * @return Boolean indicating whether the metadata was pushed out or not
+ */
+bool S3DataStore::flushMetaData()
+{
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Only allow one metadata push at a time so that the latest
+    // snapshot of the metadata is always the last one written
+    // Do this in a separate context to leverage RAII for the mutex/lock
+    {
+
+        // Lock the thread for safe operation
+        std::unique_lock<std::mutex> metadataLock(_sync->metadataLock);
+
+        // Take a snapshot of the current metadata (and its pending changes)
+        S3MetaData s3MetaData;
+        unsigned long metadataChanges = 0;
+        {
+
+            // Lock the thread for safe operation
+            std::unique_lock<std::mutex> lock(_sync->lock);
+
+            // Copy the metadata
+            s3MetaData = _internalMd;
+            metadataChanges = _sync->metadataChanges;
+            _sync->metadataChanges = 0;
+        }
+
+        // Build-up the packed-vector for the metadata
+        std::vector<std::string> packedVect;
+        packedVect.push_back(std::to_string(s3MetaData.dataSize));
+
+        // Add the misc. metadata values to the packed-vector
+        std::vector<std::string> miscMd;
+        for (const auto& miscMdItem : s3MetaData.miscMetadata)
+        {
+            miscMd.push_back(miscMdItem.first);
+            miscMd.push_back(miscMdItem.second);
+        }
+        packedVect.push_back(StandardModel::Utils::getFileString(miscMd));
+
+        // Get the file-string for the packed vector
+        auto kviMetaDataString = StandardModel::Utils::getFileString(packedVect);
+
+        // Replace the metadata to the KVI instance directly
+        retFlag = addItemHelper(".s3datastore/metadata", kviMetaDataString);
+
+        // Keep the changes pending if they could not be pushed out
+        if (!retFlag)
+        {
+
+            // Lock the thread for safe operation
+            std::unique_lock<std::mutex> lock(_sync->lock);
+
+            // Restore the pending changes
+            _sync->metadataChanges += metadataChanges;
+        }
+    }
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Function used to load the sizes of the objects in the s3-data-store
+ * so that writes of the listed objects need not look-up the size of
+ * the object they replace
+ * NOTE: This will effectively translate to S3-list operation(s)
+ * NOTE: Only a bounded number of sizes are kept and objects which
+ *       were not listed are still looked-up (since other processes
+ *       may be writing to the same s3-data-store)
+ *
+ * @return Boolean indicating whether the object sizes were loaded or not
+ */
+bool S3DataStore::loadObjectSizes()
+{
+
+    // Create a return flag
+    bool retFlag = true;
+
+    // Run in a loop to list everything
+    bool keepListing = true;
+    bool wasTruncated = false;
+    Aws::String previousMarker;
+    std::unordered_map<std::string, long long int> objectSizes;
+    while (keepListing)
+    {
+
+        // Construct the list-objects request
+        Aws::S3::Model::ListObjectsRequest listObjectsRequest;
+        listObjectsRequest.WithBucket(_bucket).WithPrefix(_directory + "/");
+
+        // Add in the marker from the previous listing (if applicable)
+        if (wasTruncated)
+            listObjectsRequest.WithMarker(previousMarker);
+
+        // Actually perform the request
+        auto objectListing = _s3Client->ListObjects(listObjectsRequest);
+
+        // Only continue if the operation was successful
+        if (objectListing.IsSuccess())
+        {
+
+            // Loop through all of the results and record each object's size
+            // (up until as many sizes are known as will be kept)
+            for (const auto& s3Object : objectListing.GetResult().GetContents())
+            {
+                if (objectSizes.size() >= MAX_KNOWN_OBJECT_SIZES)
+                    break;
+                Aws::String keyString = s3Object.GetKey();
+                keyString.erase(0, _directory.size() + 1);
+                objectSizes[keyString.c_str()] = s3Object.GetSize();
+            }
+
+            // Determine if we need to keep looping (i.e. if the response was truncated)
+            wasTruncated = objectListing.GetResult().GetIsTruncated();
+            previousMarker = objectListing.GetResult().GetNextMarker();
+            keepListing = (wasTruncated && (objectSizes.size() < MAX_KNOWN_OBJECT_SIZES));
+        }
+
+        // Handle the case where the object listing failed (return false)
+        else
+        {
+
+            // Setup the return value and exit the loop
+            keepListing = false;
+            retFlag = false;
+        }
+    }
+
+    // Replace the known object sizes with the listing on success
+    if (retFlag)
+    {
+
+        // Lock the thread for safe operation
+        std::unique_lock<std::mutex> lock(_sync->lock);
+
+        // Replace the known object sizes, keeping the sizes of any
+        // writes which the listing may not yet reflect
+        _objectSizes = std::move(objectSizes);
+        for (const auto& memoItem : _memoizationMap)
+            recordObjectSizeUnlocked(memoItem.first, memoItem.second.size);
+    }
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Internal helper function used to add an item to the s3-data-store
+ *
+ * @param key String representing the key for the item to add
+ * @param item String item to add to the data store
+ * @param ifMatch String representing the ETag the existing item must have (if any)
+ * @param ifNoneMatch String representing the ETag the existing item must not
+ *                    have (or "*" for the item to not exist at all, if any)
+ * @return Boolean indicating whether the item was added or not
+ */
+bool S3DataStore::addItemHelper(const std::string& key, const std::string& item,
+        const std::string& ifMatch, const std::string& ifNoneMatch)
+{
+
+    // Create a return flag
+    bool wasAdded = false;
+
+    // Get the item size at which items are uploaded in parts
+    // Do this in a separate context to leverage RAII for the mutex/lock
+    unsigned long long multipartThreshold = 0;
+    {
+
+        // Lock the thread for safe operation
+        std::unique_lock<std::mutex> lock(_sync->lock);
+
+        // Get the multipart threshold
+        multipartThreshold = _sync->multipartThreshold;
+    }
+
+    // Upload large (unconditional) items in parts (in parallel) instead
+    bool isConditional = (!ifMatch.empty() || !ifNoneMatch.empty());
+    if (!key.empty() && !isConditional && (item.size() >= multipartThreshold))
+        wasAdded = multipartUpload(key, item);
+
+    // Only process if the key isn't empty
+    else if (!key.empty())
+    {
+
+        // Create the Put Object Request (with any conditions on the existing item)
+        ConditionalPutObjectRequest putObjectRequest(ifMatch.c_str(), ifNoneMatch.c_str());
+        putObjectRequest.WithBucket(_bucket).WithKey(_directory + "/" + Aws::String(key));
+
+        // Create the input stream (IOStream) from the input string item
+        typedef boost::iostreams::basic_array_source<char> StringStream;
+        boost::iostreams::stream_buffer<StringStream> inputDataRaw(item.c_str(), item.size());
+        auto inputData = std::make_shared<std::iostream>(&inputDataRaw);
+        putObjectRequest.SetBody(std::shared_ptr<Aws::IOStream>(inputData));
+        putObjectRequest.SetContentLength(item.size());
+
+        // Put the object in the bucket and verify the results
+        // NOTE: Will succeed if the item already exists
+        wasAdded = _s3Client->PutObject(putObjectRequest).IsSuccess();
+    }
+
+    // Invalidate any cached version of the object (after the write so
+    // that reads which started before the write are not cached)
+    invalidateCachedItem(key);
+
+    // Return the return flag
+    return wasAdded;
+}
+
+/**
+ * Internal function used to add an item to the s3-data-store as a multipart
+ * upload (with the parts uploaded in parallel from the item's memory)
+ *
+ * @param key String representing the key for the item to add
+ * @param item String item to add to the data store
+ * @return Boolean indicating whether the item was added or not
+ */
+bool S3DataStore::multipartUpload(const std::string& key, const std::string& item)
+{
+
+    // Create a return flag
+    bool wasAdded = false;
+
+    // Get the part size and the maximum parts in-flight for the upload
+    // Do this in a separate context to leverage RAII for the mutex/lock
+    unsigned long long partSize = 0;
+    unsigned long maxConcurrency = 0;
+    {
+
+        // Lock the thread for safe operation
+        std::unique_lock<std::mutex> lock(_sync->lock);
+
+        // Get the multipart policy
+        partSize = _sync->multipartPartSize;
+        maxConcurrency = _sync->multipartConcurrency;
+    }
+
+    // Grow the parts (if needed) so the item fits in the maximum of 10000 parts
+    unsigned long long itemSize = item.size();
+    partSize = std::max(partSize, ((itemSize + 9999) / 10000));
+    auto partCount = (unsigned long) ((itemSize + partSize - 1) / partSize);
+
+    // Create the Create Multipart Upload Request
+    Aws::String objectKey = _directory + "/" + Aws::String(key);
+    Aws::S3::Model::CreateMultipartUploadRequest createMultipartUploadRequest;
+    createMultipartUploadRequest.WithBucket(_bucket).WithKey(objectKey);
+
+    // Start the multipart upload and only continue if it was started
+    auto createMultipartUploadOutcome = _s3Client->CreateMultipartUpload(createMultipartUploadRequest);
+    if (createMultipartUploadOutcome.IsSuccess())
+    {
+
+        // Upload each of the parts in parallel, directly from the item's memory
+        auto uploadId = createMultipartUploadOutcome.GetResult().GetUploadId();
+        std::vector<Aws::String> partETags(partCount);
+        std::atomic<bool> allPartsUploaded(true);
+        runBatch(partCount, maxConcurrency, [&](unsigned long partIndex)
+        {
+
+            // Skip the part if another part has already failed
+            if (!allPartsUploaded)
+                return;
+
+            // Create the Upload Part Request
+            // NOTE: Part numbers start at one
+            auto partOffset = (partIndex * partSize);
+            auto partLength = std::min(partSize, (itemSize - partOffset));
+            Aws::S3::Model::UploadPartRequest uploadPartRequest;
+            uploadPartRequest.WithBucket(_bucket).WithKey(objectKey)
+                    .WithUploadId(uploadId).WithPartNumber((int) (partIndex + 1));
+
+            // Create the input stream (IOStream) from the part of the input string item
+            typedef boost::iostreams::basic_array_source<char> StringStream;
+            boost::iostreams::stream_buffer<StringStream> inputDataRaw(item.c_str() + partOffset, partLength);
+            auto inputData = std::make_shared<std::iostream>(&inputDataRaw);
+            uploadPartRequest.SetBody(std::shared_ptr<Aws::IOStream>(inputData));
+            uploadPartRequest.SetContentLength(partLength);
+
+            // Upload the part and record its ETag (for completing the upload)
+            auto uploadPartOutcome = _s3Client->UploadPart(uploadPartRequest);
+            if (uploadPartOutcome.IsSuccess())
+                partETags[partIndex] = uploadPartOutcome.GetResult().GetETag();
+            else
+                allPartsUploaded = false;
+        });
+
+        // If all of the parts were uploaded, complete the upload (with the parts in order)
+        if (allPartsUploaded)
+        {
+
+            // Setup the completed parts of the upload
+            Aws::S3::Model::CompletedMultipartUpload completedMultipartUpload;
+            for (unsigned long ii = 0; ii < partCount; ii++)
+                completedMultipartUpload.AddParts(Aws::S3::Model::CompletedPart()
+                        .WithETag(partETags[ii]).WithPartNumber((int) (ii + 1)));
+
+            // Create the Complete Multipart Upload Request
+            Aws::S3::Model::CompleteMultipartUploadRequest completeMultipartUploadRequest;
+            completeMultipartUploadRequest.WithBucket(_bucket).WithKey(objectKey)
+                    .WithUploadId(uploadId).WithMultipartUpload(completedMultipartUpload);
+
+            // Complete the upload and verify the results
+            wasAdded = _s3Client->CompleteMultipartUpload(completeMultipartUploadRequest).IsSuccess();
+        }
+
+        // If the upload failed, abort it so that the uploaded parts are released
+        if (!wasAdded)
+        {
+            Aws::S3::Model::AbortMultipartUploadRequest abortMultipartUploadRequest;
+            abortMultipartUploadRequest.WithBucket(_bucket).WithKey(objectKey).WithUploadId(uploadId);
+            _s3Client->AbortMultipartUpload(abortMultipartUploadRequest);
+        }
+    }
+
+    // Return the return flag
+    return wasAdded;
+}
+
+/**
+ * Internal function used to add an item to the s3-data-store tracking its
+ * size in the internal metadata (without pushing the metadata out)
+ *
+ * @param key String representing the key for the item to add
+ * @param item String item to add to the data store
+ * @param ifMatch String representing the ETag the existing item must have (if any)
+ * @param ifNoneMatch String representing the ETag the existing item must not
+ *                    have (or "*" for the item to not exist at all, if any)
+ * @return Boolean indicating whether the item was added or not
+ */
+bool S3DataStore::addItemAndTrackSize(const std::string& key, const std::string& item,
+        const std::string& ifMatch, const std::string& ifNoneMatch)
+{
+
+    // Create a return flag
+    bool wasAdded = false;
+
+    // Only process if the key isn't empty
+    // and doesn't start with a '.'
+    if (!key.empty() && (key[0] != '.'))
+    {
+
+        // Take write access to the key so concurrent writes are sized in order
+        acquireKey(key);
+
+        // Start by getting the size of the size of the object
+        // NOTE: A write only made if the object is absent (If-None-Match: *)
+        //       can only succeed if there was no previous object, so its size
+        //       is known to be zero without having to look it up
+        long long int currSize = 0;
+        if (ifNoneMatch != "*")
+            currSize = getObjectSize(key);
+
+        // Next, add the item to the s3-bucket
+        wasAdded = addItemHelper(key, item, ifMatch, ifNoneMatch);
+
+        // If the operation was successful, update the metadata
+        // Do this in a separate context to leverage RAII for the mutex/lock
+        if (wasAdded)
+        {
+
+            // Lock the thread for safe operation
+            std::unique_lock<std::mutex> lock(_sync->lock);
+
+            // Update the total size in the metadata
+            auto newSize = item.size() - currSize;
+            _internalMd.dataSize += newSize;
+
+            // Add the current object's size to the memoization map
+            // to be reconciled with the cloud in the background
+            auto nextCheck = (std::chrono::steady_clock::now()
+                    + std::chrono::milliseconds(_sync->reconcileInitialDelayMs));
+            _memoizationMap[key] = MemoizedSize{(long long int) item.size(), 0, nextCheck};
+            recordObjectSizeUnlocked(key, (long long int) item.size());
+
+            // Wake-up the reconciler if it isn't already due before the object
+            if (nextCheck < _sync->nextReconcile)
+                _sync->reconcileChanged.notify_all();
+        }
+
+        // Release write access to the key
+        releaseKey(key);
+    }
+
+    // Return the return flag
+    return wasAdded;
+}
+
+/**
+ * Internal function used to delete an item from the s3-data-store tracking
+ * its size in the internal metadata (without pushing the metadata out)
  *
  * @param key String representing the key for the item to delete
  * @return Boolean indicating whether the item was deleted or not
  */
-bool S3DataStore::deleteItem(const std::string& key)
+bool S3DataStore::deleteItemAndTrackSize(const std::string& key)
 {
 
     // Create a return flag
@@ -316,6 +2124,9 @@ bool S3DataStore::deleteItem(const std::string& key)
     if (!key.empty())
     {
 
+        // Take write access to the key so concurrent writes are sized in order
+        acquireKey(key);
+
         // Get the object's original size (in the bucket)
         auto origSize = getObjectSize(key);
 
@@ -328,18 +2139,30 @@ bool S3DataStore::deleteItem(const std::string& key)
 
         // If the operation was successful, update the metadata
         // NOTE: Do not do this if the key deleted begins with a '.'
-        if (wasDeleted && (key[0] != '.'))
+        // Do this in a separate context to leverage RAII for the mutex/lock
+        if (wasDeleted)
         {
 
-            // Update the total size in the metadata
-            _internalMd.dataSize -= origSize;
+            // Lock the thread for safe operation
+            std::unique_lock<std::mutex> lock(_sync->lock);
 
-            // Remove the current object's size from the memoization map
-            _memoizationMap.erase(key);
+            // Record that the object no longer exists
+            recordObjectSizeUnlocked(key, 0);
 
-            // Push out the updated internal metadata
-            setMetaData(_internalMd);
+            // Update the total size in the metadata and remove the
+            // current object's size from the memoization map
+            if (key[0] != '.')
+            {
+                _internalMd.dataSize -= origSize;
+                _memoizationMap.erase(key);
+            }
         }
+
+        // Invalidate any cached version of the object
+        invalidateCachedItem(key);
+
+        // Release write access to the key
+        releaseKey(key);
     }
 
     // Return the return flag
@@ -347,211 +2170,459 @@ bool S3DataStore::deleteItem(const std::string& key)
 }
 
 /**
- * Function used to delete the entire s3-data-store bucket directory
+ * Internal function used to run the given operation for every index in a batch
+ * NOTE: The calling thread works on the batch alongside the thread-pool so
+ *       that the batch always makes progress
  *
- * @param supportsMultiDelete Boolean indicating whether the back-end
- *                            cloud provider supports multi-item S3 delete
- * @return Boolean indicating if all of the items were deleted or no
+ * @param itemCount Unsigned Long representing the number of items in the batch
+ * @param maxConcurrency Unsigned Long representing the maximum operations in-flight
+ * @param operation Function representing the operation to run for each index
  */
-bool S3DataStore::deleteEntireDataStore(bool supportsMultiDelete)
+void S3DataStore::runBatch(unsigned long itemCount, unsigned long maxConcurrency,
+        const std::function<void(unsigned long)>& operation)
 {
 
-    // Create a return flag
-    bool retFlag = true;
+    // Setup the state shared between the workers on the batch
+    struct BatchState
+    {
+        std::mutex lock;
+        unsigned long nextIndex;
+        unsigned long completedCount;
+        std::condition_variable completed;
+    };
+    auto batchState = std::make_shared<BatchState>();
+    batchState->nextIndex = 0;
+    batchState->completedCount = 0;
+
+    // Setup the worker which runs the operation for the
+    // next unclaimed index until there are none left
+    auto batchOperation = std::make_shared<std::function<void(unsigned long)>>(operation);
+    std::function<void()> batchWorker = [batchState, batchOperation, itemCount]()
+    {
 
-    // Run in a loop to list/delete everything
-    bool keepListing = true;
-    bool wasTruncated = false;
-    Aws::String previousMarker;
-    while (keepListing)
+        // Continuously run the operation until there are no indexes left
+        while (true)
+        {
+
+            // Claim the next index in the batch
+            // Do this in a separate context to leverage RAII for the mutex/lock
+            unsigned long index = 0;
+            {
+
+                // Lock the thread for safe operation
+                std::unique_lock<std::mutex> lock(batchState->lock);
+
+                // Exit the worker if there are no indexes left
+                if (batchState->nextIndex >= itemCount)
+                    break;
+                index = batchState->nextIndex++;
+            }
+
+            // Actually run the operation for the index
+            (*batchOperation)(index);
+
+            // Lock the thread for safe operation
+            std::unique_lock<std::mutex> lock(batchState->lock);
+
+            // Indicate that the index was completed
+            if (++batchState->completedCount == itemCount)
+                batchState->completed.notify_all();
+        }
+    };
+
+    // Start the additional workers on the thread-pool and work on the batch directly
+    auto workerCount = std::min(std::max(maxConcurrency, 1UL), itemCount);
+    for (unsigned long ii = 1; ii < workerCount; ii++)
+        runAsync(batchWorker);
+    batchWorker();
+
+    // Wait for every index in the batch to be completed
+    std::unique_lock<std::mutex> lock(batchState->lock);
+    batchState->completed.wait(lock, [batchState, itemCount]()
     {
+        return (batchState->completedCount == itemCount);
+    });
+}
 
-        // Construct the list-objects request
-        Aws::S3::Model::ListObjectsRequest listObjectsRequest;
-        listObjectsRequest.WithBucket(_bucket).WithPrefix(_directory);
+/**
+ * Internal function used to run the given operation on the asynchronous thread-pool
+ *
+ * @param operation Function representing the operation to run
+ */
+void S3DataStore::runAsync(std::function<void()> operation)
+{
 
-        // Add in the marker from the previous listing (if applicable)
-        if (wasTruncated)
-            listObjectsRequest.WithMarker(previousMarker);
+    // Track the operation so that the destructor can wait for it
+    // Do this in a separate context to leverage RAII for the mutex/lock
+    {
 
-        // Actually perform the request
-        auto objectListing = _s3Client->ListObjects(listObjectsRequest);
+        // Lock the thread for safe operation
+        std::unique_lock<std::mutex> lock(_sync->lock);
 
-        // Only continue if the operation was successful
-        if (objectListing.IsSuccess())
+        // Count the operation as pending
+        _sync->asyncPending++;
+    }
+
+    // Wrap the operation so that it is no longer tracked once it completes
+    auto sync = _sync;
+    auto trackedOperation = std::make_shared<std::function<void()>>(
+        [sync, operation]()
         {
 
-            // Loop through all of the results and extract all object keys
-            Aws::Vector<Aws::S3::Model::ObjectIdentifier> deleteVect;
-            auto objectList = objectListing.GetResult().GetContents();
-            for (const auto& s3Object : objectList)
-                deleteVect.push_back(Aws::S3::Model::ObjectIdentifier().WithKey(s3Object.GetKey()));
+            // Actually run the operation
+            operation();
 
-            // If the backend supports multi-item deletion, delete all keys
-            // at the same time using a single request
-            if (supportsMultiDelete && !deleteVect.empty())
-            {
+            // Lock the thread for safe operation
+            std::unique_lock<std::mutex> lock(sync->lock);
 
-                // Create the multi-item delete request
-                auto deleteItems = Aws::S3::Model::Delete().WithObjects(deleteVect);
-                Aws::S3::Model::DeleteObjectsRequest deleteObjectsRequest;
-                deleteObjectsRequest.WithBucket(_bucket).WithDelete(deleteItems);
+            // Indicate that the operation is no longer pending
+            sync->asyncPending--;
+            sync->asyncDrained.notify_all();
+        });
 
-                // Actually perform the object deletion
-                retFlag &= _s3Client->DeleteObjects(deleteObjectsRequest).IsSuccess();
-            }
+    // Run the operation on the thread-pool (or in-line if it could not be queued)
+    if (!_asyncPool->enqueue(trackedOperation))
+        (*trackedOperation)();
+}
 
-            // If the backend does not support multi-item delete, then delete
-            // the listed object keys one-by-one
-            else
-            {
+/**
+ * Internal function used to wait for (and take) exclusive write access to the
+ * given key so that concurrent writes to the same key are sized in order
+ *
+ * @param key String representing the key to take write access to
+ */
+void S3DataStore::acquireKey(const std::string& key)
+{
 
-                // Loop through all of the items and delete them individually
-                for (const auto& item : deleteVect)
-                {
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_sync->lock);
 
-                    // Obtain the key from the object
-                    Aws::String keyString = item.GetKey();
+    // Wait until no other write is in-flight for the key and then take it
+    auto sync = _sync;
+    sync->keyReleased.wait(lock, [sync, &key]()
+    {
+        return (sync->keysInFlight.find(key) == sync->keysInFlight.end());
+    });
+    sync->keysInFlight.insert(key);
+}
 
-                    // Strip-off the directory and delete the object by key
-                    keyString.erase(0, _directory.size() + 1);
-                    retFlag &= deleteItem(keyString.c_str());
-                }
-            }
+/**
+ * Internal function used to release write access to the given key
+ *
+ * @param key String representing the key to release write access to
+ */
+void S3DataStore::releaseKey(const std::string& key)
+{
 
-            // Determine if we need to keep looping (i.e. if the response was truncated)
-            wasTruncated = objectListing.GetResult().GetIsTruncated();
-            keepListing = wasTruncated;
-        }
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_sync->lock);
 
-        // Handle the case where the object listing failed (return false)
-        else
-        {
+    // Release the key and wake-up any writes waiting on it
+    _sync->keysInFlight.erase(key);
+    _sync->keyReleased.notify_all();
+}
 
-            // Setup the return value and exit the loop
-            keepListing = false;
-            retFlag = false;
+/**
+ * Internal function used to record that the metadata has changed
+ *
+ * @param changes Unsigned Long representing the number of changes made
+ */
+void S3DataStore::markMetaDataChanged(unsigned long changes)
+{
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_sync->lock);
+
+    // Record the changes and wake-up the flusher once enough have been made
+    _sync->metadataChanges += changes;
+    if (_sync->metadataChanges >= _sync->metadataFlushThreshold)
+        _sync->metadataChanged.notify_all();
+}
+
+/**
+ * Internal function used to start the metadata flusher and reconciler threads
+ */
+void S3DataStore::startBackgroundThreads()
+{
+
+    // Start the flusher and reconciler threads for the instance
+    _metadataFlusher = std::thread(&S3DataStore::runMetadataFlusher, this);
+    _reconciler = std::thread(&S3DataStore::runReconciler, this);
+
+    // Lock the thread for safe operation
+    auto& instanceRegistry = getInstanceRegistry();
+    std::unique_lock<std::mutex> lock(instanceRegistry.lock);
+
+    // Register the instance so that siblings can flush its metadata
+    instanceRegistry.instances[getRegistryKey()].insert(this);
+}
+
+/**
+ * Internal function used to stop the metadata flusher and reconciler threads
+ */
+void S3DataStore::stopBackgroundThreads()
+{
+
+    // Unregister the instance so that siblings no longer flush its metadata
+    // Do this in a separate context to leverage RAII for the mutex/lock
+    {
+
+        // Lock the thread for safe operation
+        auto& instanceRegistry = getInstanceRegistry();
+        std::unique_lock<std::mutex> lock(instanceRegistry.lock);
+
+        // Remove the instance (and its directory once it has no instances)
+        auto registryIter = instanceRegistry.instances.find(getRegistryKey());
+        if (registryIter != instanceRegistry.instances.end())
+        {
+            registryIter->second.erase(this);
+            if (registryIter->second.empty())
+                instanceRegistry.instances.erase(registryIter);
         }
     }
 
-    // Handle any local and cloud metadata changes on success
-    if (retFlag)
+    // Signal the flusher and reconciler threads to stop
+    // Do this in a separate context to leverage RAII for the mutex/lock
     {
 
-        // Make sure we also completely dump the memoization cache
-        _memoizationMap.clear();
+        // Lock the thread for safe operation
+        std::unique_lock<std::mutex> lock(_sync->lock);
 
-        // Update the metadata accordingly
-        _internalMd.dataSize = 0;
+        // Indicate that the threads should stop
+        _sync->isStopping = true;
+        _sync->metadataChanged.notify_all();
+        _sync->reconcileChanged.notify_all();
     }
 
-    // Return the return flag
-    return retFlag;
+    // Wait for the flusher and reconciler threads to finish
+    if (_metadataFlusher.joinable())
+        _metadataFlusher.join();
+    if (_reconciler.joinable())
+        _reconciler.join();
+
+    // Lock the thread for safe operation
+    std::unique_lock<std::mutex> lock(_sync->lock);
+
+    // Reset the stop flag so that the threads can be restarted
+    _sync->isStopping = false;
 }
 
 /**
- * Function used to add a misc. metadata key-value pair to the S3-data-store
- *
- * @param key String representing the key for the metadata item
- * @param value String representing the value for the metadata item
+ * Internal function used to run the metadata flusher thread
  */
-void S3DataStore::setMiscMetadataValue(const std::string& key, const std::string& value)
+void S3DataStore::runMetadataFlusher()
 {
 
-    // Add-in the key-value pair/item for the metadata value
-    _internalMd.miscMetadata[key] = value;
+    // Continuously push out the metadata until the flusher is stopped
+    auto sync = _sync;
+    while (true)
+    {
 
-    // Sync/push the metadata back up to the cloud
-    setMetaData(_internalMd);
+        // Wait until enough changes have been made, the interval
+        // has passed or the flusher has been stopped
+        // Do this in a separate context to leverage RAII for the mutex/lock
+        bool hasChanges = false;
+        {
+
+            // Lock the thread for safe operation
+            std::unique_lock<std::mutex> lock(sync->lock);
+
+            // Wait for the next push (on the interval if there is one)
+            auto isFlushReady = [sync]()
+            {
+                return (sync->isStopping || (sync->metadataChanges >= sync->metadataFlushThreshold));
+            };
+            if (sync->metadataFlushIntervalMs > 0)
+                sync->metadataChanged.wait_for(lock,
+                        std::chrono::milliseconds(sync->metadataFlushIntervalMs), isFlushReady);
+            else
+                sync->metadataChanged.wait(lock, isFlushReady);
+
+            // Exit the flusher if it is stopping
+            if (sync->isStopping)
+                break;
+            hasChanges = (sync->metadataChanges > 0);
+        }
+
+        // Push out the metadata
+        if (hasChanges)
+            flushMetaData();
+    }
 }
 
 /**
- * Function used to get a misc. metadata value for the given key in the S3-data-store
- *
- * @param key String representing the key for the metadata item
- * @param defaultVal String representing the default value if the item doesn't exist
- * @return String representing the value for the metadata item
+ * Internal function used to run the reconciler thread
  */
-std::string S3DataStore::getMiscMetadataValue(const std::string& key, const std::string& defaultVal)
+void S3DataStore::runReconciler()
 {
 
-    // Create a return string
-    std::string retString = defaultVal;
+    // Continuously reconcile the written objects until the reconciler is stopped
+    auto sync = _sync;
+    while (true)
+    {
 
-    // Get the metadata value if it exists locally
-    auto mdIterator = _internalMd.miscMetadata.find(key);
-    if (mdIterator != _internalMd.miscMetadata.end())
-        retString = mdIterator->second;
+        // Wait until the next object is due to be checked (or the reconciler is stopped)
+        // Do this in a separate context to leverage RAII for the mutex/lock
+        {
 
-    // Return the return string
-    return retString;
+            // Lock the thread for safe operation
+            std::unique_lock<std::mutex> lock(sync->lock);
+
+            // Determine when the next object is due to be checked
+            sync->nextReconcile = std::chrono::steady_clock::time_point::max();
+            for (const auto& memoItem : _memoizationMap)
+                sync->nextReconcile = std::min(sync->nextReconcile, memoItem.second.nextCheck);
+
+            // Wait until then (being woken-up by any earlier objects being written)
+            if (!sync->isStopping && (sync->nextReconcile > std::chrono::steady_clock::now()))
+            {
+                if (sync->nextReconcile == std::chrono::steady_clock::time_point::max())
+                    sync->reconcileChanged.wait(lock);
+                else
+                    sync->reconcileChanged.wait_until(lock, sync->nextReconcile);
+            }
+
+            // Exit the reconciler if it is stopping
+            if (sync->isStopping)
+                break;
+        }
+
+        // Check any of the objects which are now due
+        flushCacheIfPossible(true);
+    }
 }
 
 /**
- * Internal helper function used to add an item to the s3-data-store
+ * Internal static function used to get the process-wide registry of
+ * running instances (used to flush sibling instances' metadata)
  *
- * @param key String representing the key for the item to add
- * @param item String item to add to the data store
- * @return Boolean indicating whether the item was added or not
+ * @return Instance Registry reference for the process
  */
-bool S3DataStore::addItemHelper(const std::string& key, const std::string& item)
+S3DataStore::InstanceRegistry& S3DataStore::getInstanceRegistry()
 {
 
-    // Create a return flag
-    bool wasAdded = false;
+    // Setup the registry instance
+    static InstanceRegistry instanceRegistry;
 
-    // Only process if the key isn't empty
-    if (!key.empty())
+    // Return the registry instance
+    return instanceRegistry;
+}
+
+/**
+ * Internal function used to get the instance's registry key
+ *
+ * @return String representing the bucket and directory of the instance
+ */
+std::string S3DataStore::getRegistryKey() const
+{
+
+    // Return the bucket and directory of the instance
+    return std::string(_bucket.c_str()) + "/" + std::string(_directory.c_str());
+}
+
+/**
+ * Internal function used to wait for outstanding operations and
+ * push out any pending state before the instance is released
+ */
+void S3DataStore::shutdown()
+{
+
+    // Only cleanup if the instance was not moved-from
+    if (_sync != nullptr)
     {
 
-        // Create the Put Object Request
-        Aws::S3::Model::PutObjectRequest putObjectRequest;
-        putObjectRequest.WithBucket(_bucket).WithKey(_directory + "/" + Aws::String(key));
+        // Stop pushing out the metadata and reconciling in the background
+        stopBackgroundThreads();
 
-        // Create the input stream (IOStream) from the input string item
-        typedef boost::iostreams::basic_array_source<char> StringStream;
-        boost::iostreams::stream_buffer<StringStream> inputDataRaw(item.c_str(), item.size());
-        auto inputData = std::make_shared<std::iostream>(&inputDataRaw);
-        putObjectRequest.SetBody(std::shared_ptr<Aws::IOStream>(inputData));
-        putObjectRequest.SetContentLength(item.size());
+        // Wait for any outstanding asynchronous operations to finish
+        // Do this in a separate context to leverage RAII for the mutex/lock
+        {
 
-        // Put the object in the bucket and verify the results
-        // NOTE: Will succeed if the item already exists
-        wasAdded = _s3Client->PutObject(putObjectRequest).IsSuccess();
+            // Lock the thread for safe operation
+            std::unique_lock<std::mutex> lock(_sync->lock);
+
+            // Wait until the asynchronous operations have drained
+            auto sync = _sync;
+            sync->asyncDrained.wait(lock, [sync]() { return (sync->asyncPending == 0); });
+        }
+
+        // Push out any remaining metadata changes
+        // Do this in a separate context to leverage RAII for the mutex/lock
+        bool hasChanges = false;
+        long deadlineMs = 0;
+        long recheckDelayMs = 0;
+        long maxDelayMs = 0;
+        {
+
+            // Lock the thread for safe operation
+            std::unique_lock<std::mutex> lock(_sync->lock);
+
+            // Determine if there are any changes remaining
+            hasChanges = (_sync->metadataChanges > 0);
+            deadlineMs = _sync->reconcileDeadlineMs;
+            recheckDelayMs = _sync->reconcileInitialDelayMs;
+            maxDelayMs = _sync->reconcileMaxDelayMs;
+        }
+        if (hasChanges)
+            flushMetaData();
+
+        // Wait until all cloud items are consistent (or the deadline passes)
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(deadlineMs);
+        while (true)
+        {
+
+            // Check all of the remaining objects
+            flushCacheIfPossible(false);
+
+            // Stop once everything is consistent or the deadline has passed
+            auto currentTime = std::chrono::steady_clock::now();
+            if ((getUnreconciledCount() == 0) || (currentTime >= deadline))
+                break;
+
+            // Back-off exponentially (but not past the deadline) before re-checking
+            std::this_thread::sleep_for(std::min(std::chrono::duration_cast<std::chrono::milliseconds>(
+                    deadline - currentTime), std::chrono::milliseconds(recheckDelayMs)));
+            recheckDelayMs = std::min((recheckDelayMs * 2), maxDelayMs);
+        }
     }
 
-    // Return the return flag
-    return wasAdded;
+    // Actually clear any internal variables
+    _memoizationMap.clear();
 }
 
 /**
  * Function used to flush (or remove) no-longer needed cache values
+ * NOTE: The objects are looked-up with bounded concurrency
  *
- * @param ensureConsistent Boolean indicating to ensure the local
- *                         state is consistent with the cloud state
+ * @param onlyDue Boolean indicating to only check the objects
+ *                which are due to be re-checked
  */
-void S3DataStore::flushCacheIfPossible(bool ensureConsistent)
+void S3DataStore::flushCacheIfPossible(bool onlyDue)
 {
 
-    // Continuously call the cache-flush process until we
-    // have met any specified consistency requirements
-    // Ensure it is done at least once regardless
-    do
+    // Extract the keys to check from the memoization map
+    // Do this in a separate context to leverage RAII for the mutex/lock
+    unsigned long maxConcurrency = 1;
+    std::vector<std::string> memoizedKeys;
     {
 
-        // Extract all of the keys from the memoization map
-        std::vector<std::string> memoizedKeys;
-        for (const auto& cacheItem : _memoizationMap)
-            memoizedKeys.push_back(cacheItem.first);
+        // Lock the thread for safe operation
+        std::unique_lock<std::mutex> lock(_sync->lock);
 
-        // Loop through every item in the memoization map
-        // performing a "getObjectSize" operation, which
-        // will also handle flushing the cache out
-        for (const auto& cacheKey : memoizedKeys)
-            getObjectSize(cacheKey);
+        // Copy-out the keys so no lock is held during the requests
+        auto currentTime = std::chrono::steady_clock::now();
+        for (const auto& cacheItem : _memoizationMap)
+            if (!onlyDue || (cacheItem.second.nextCheck <= currentTime))
+                memoizedKeys.push_back(cacheItem.first);
+        maxConcurrency = _sync->reconcileConcurrency;
+    }
 
-    // Ensure we retry if required
-    } while (ensureConsistent && !_memoizationMap.empty());
+    // Look-up every key's size in the cloud (in parallel), which
+    // will also handle flushing the cache out
+    runBatch(memoizedKeys.size(), maxConcurrency, [this, &memoizedKeys](unsigned long index)
+        {
+            reconcileObjectSize(memoizedKeys[index]);
+        });
 }
 
 /**
@@ -592,43 +2663,6 @@ S3DataStore::S3MetaData S3DataStore::getMetaData()
     return retStruct;
 }
 
-/**
- * Function used to set the metadata structure for the instance
- *
- * @param s3MetaData S3-Meta-Data structure representing the instance's metadata
- * @return Boolean indicating whether the metadata was updated/set or not
- */
-bool S3DataStore::setMetaData(S3MetaData s3MetaData)
-{
-
-    // Create a return flag
-    bool retFlag = false;
-
-    // Build-up the packed-vector for the metadata
-    std::vector<std::string> packedVect;
-    packedVect.push_back(std::to_string(s3MetaData.dataSize));
-
-    // Add the misc. metadata values to the packed-vector
-    std::vector<std::string> miscMd;
-    for (const auto& miscMdItem : s3MetaData.miscMetadata)
-    {
-        miscMd.push_back(miscMdItem.first);
-        miscMd.push_back(miscMdItem.second);
-    }
-    packedVect.push_back(StandardModel::Utils::getFileString(miscMd));
-
-    // Get the file-string for the packed vector
-    auto kviMetaDataString = StandardModel::Utils::getFileString(packedVect);
-
-    // Replace the metadata to the KVI instance directly
-    retFlag = addItemHelper(".s3datastore/metadata", kviMetaDataString);
-
-    // Try to keep the cache flushed
-    flushCacheIfPossible();
-
-    // Return the return flag
-    return retFlag;
-}
 
 /**
  * Destructor used to cleanup and sync the S3 instance
@@ -636,9 +2670,6 @@ bool S3DataStore::setMetaData(S3MetaData s3MetaData)
 S3DataStore::~S3DataStore()
 {
 
-    // Wait until all cloud items are consistent
-    flushCacheIfPossible(true);
-
-    // Actually clear any internal variables
-    _memoizationMap.clear();
+    // Wait for outstanding operations and push out any pending state
+    shutdown();
 }
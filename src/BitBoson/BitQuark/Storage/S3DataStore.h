@@ -23,16 +23,28 @@
 #define BITQUARK_S3DATASTORE_H
 
 #include <mutex>
+#include <chrono>
+#include <future>
+#include <thread>
 #include <iostream>
 #include <istream>
 #include <streambuf>
 #include <string>
 #include <memory>
+#include <functional>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include <condition_variable>
 #include <aws/core/Aws.h>
 #include <aws/s3/S3Client.h>
+#include <aws/s3/model/PutObjectRequest.h>
 #include <BitBoson/StandardModel/Primitives/Generator.hpp>
+#include <BitBoson/StandardModel/Threading/ThreadPool.hpp>
+#include <BitBoson/BitQuark/Storage/DiskCache.h>
+#include <BitBoson/BitQuark/Storage/ObjectCache.h>
 #include <BitBoson/BitQuark/Storage/S3Credentials.h>
+#include <BitBoson/BitQuark/Storage/S3ClientOptions.h>
 
 using namespace BitBoson;
 namespace BitBoson::BitQuark
@@ -48,6 +60,41 @@ namespace BitBoson::BitQuark
                 long long int dataSize;
                 std::unordered_map<std::string, std::string> miscMetadata;
             };
+            struct MemoizedSize
+            {
+                long long int size;
+                unsigned long rechecks;
+                std::chrono::steady_clock::time_point nextCheck;
+            };
+            struct S3Sync
+            {
+                std::mutex lock;
+                std::mutex metadataLock;
+                unsigned long asyncPending;
+                std::condition_variable asyncDrained;
+                std::condition_variable keyReleased;
+                std::unordered_set<std::string> keysInFlight;
+                bool isStopping;
+                unsigned long metadataChanges;
+                unsigned long metadataFlushThreshold;
+                long metadataFlushIntervalMs;
+                std::condition_variable metadataChanged;
+                unsigned long reconcileConcurrency;
+                long reconcileInitialDelayMs;
+                long reconcileMaxDelayMs;
+                long reconcileDeadlineMs;
+                std::chrono::steady_clock::time_point nextReconcile;
+                std::condition_variable reconcileChanged;
+                unsigned long long multipartThreshold;
+                unsigned long long multipartPartSize;
+                unsigned long multipartConcurrency;
+                long objectCacheRevalidateMs;
+            };
+            struct InstanceRegistry
+            {
+                std::mutex lock;
+                std::unordered_map<std::string, std::unordered_set<S3DataStore*>> instances;
+            };
 
         // Private internal class
         private:
@@ -118,6 +165,61 @@ namespace BitBoson::BitQuark
                     }
             };
 
+        // Private internal class
+        private:
+            class ConditionalPutObjectRequest : public Aws::S3::Model::PutObjectRequest
+            {
+
+                // Private member variables
+                private:
+                    Aws::String _ifMatch;
+                    Aws::String _ifNoneMatch;
+
+                // Public member functions
+                public:
+
+                    /**
+                     * Constructor used to setup the put-object request with the
+                     * conditions the existing object must meet for it to succeed
+                     *
+                     * @param ifMatch String representing the ETag the existing object
+                     *                must have (or empty for no condition)
+                     * @param ifNoneMatch String representing the ETag the existing object must
+                     *                    not have (or "*" for the object to not exist at all)
+                     */
+                    ConditionalPutObjectRequest(const Aws::String& ifMatch, const Aws::String& ifNoneMatch)
+                    {
+
+                        // Setup the conditions
+                        _ifMatch = ifMatch;
+                        _ifNoneMatch = ifNoneMatch;
+                    }
+
+                    /**
+                     * Function used to get the request's headers (including
+                     * the conditional headers, which the SDK does not model)
+                     *
+                     * @return Header Value Collection representing the request's headers
+                     */
+                    Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override
+                    {
+
+                        // Add the conditional headers to the request's headers
+                        auto headers = Aws::S3::Model::PutObjectRequest::GetRequestSpecificHeaders();
+                        if (!_ifMatch.empty())
+                            headers.emplace("if-match", _ifMatch);
+                        if (!_ifNoneMatch.empty())
+                            headers.emplace("if-none-match", _ifNoneMatch);
+                        return headers;
+                    }
+            };
+
+        // Private constants
+        private:
+            static const unsigned long MAX_KNOWN_OBJECT_SIZES = 65536;
+            static const long long int INITIAL_STREAM_READ_SIZE = 64 * 1024;
+            static const unsigned long MAX_BUFFERED_LISTING_PAGES = 2;
+
         // Private member variables
         private:
             Aws::String _bucket;
@@ -125,7 +227,14 @@ namespace BitBoson::BitQuark
             S3MetaData _internalMd;
             Aws::SDKOptions _awsOptions;
             std::shared_ptr<Aws::S3::S3Client> _s3Client;
-            std::unordered_map<std::string, long> _memoizationMap;
+            std::unordered_map<std::string, MemoizedSize> _memoizationMap;
+            std::unordered_map<std::string, long long int> _objectSizes;
+            std::shared_ptr<S3Sync> _sync;
+            std::shared_ptr<StandardModel::ThreadPool<std::function<void()>>> _asyncPool;
+            std::shared_ptr<ObjectCache> _objectCache;
+            std::shared_ptr<DiskCache> _diskCache;
+            std::thread _metadataFlusher;
+            std::thread _reconciler;
 
         // Public member functions
         public:
@@ -134,8 +243,135 @@ namespace BitBoson::BitQuark
              * Constructor used to setup the s3-data-store instance
              *
              * @param s3Credentials S3 Credentials used to setup the S3 connection with
+             * @param s3ClientOptions S3 Client Options used to setup the S3 connection
+             *                        pool and timeouts with (or null for the defaults)
+             */
+            explicit S3DataStore(std::shared_ptr<S3Credentials> s3Credentials,
+                    std::shared_ptr<S3ClientOptions> s3ClientOptions=nullptr);
+
+            /**
+             * Move constructor used to take over another s3-data-store instance
+             * NOTE: The other instance must not have asynchronous operations outstanding
+             *
+             * @param other S3-Data-Store instance to take over
+             */
+            S3DataStore(S3DataStore&& other) noexcept;
+
+            /**
+             * Move assignment operator used to take over another s3-data-store instance
+             * NOTE: Neither instance may have asynchronous operations outstanding
+             *
+             * @param other S3-Data-Store instance to take over
+             * @return S3-Data-Store reference to this instance
+             */
+            S3DataStore& operator=(S3DataStore&& other) noexcept;
+
+            /**
+             * Function used to set when the (coalesced) metadata is pushed out
+             * NOTE: Metadata is pushed out once the given number of changes have
+             *       been made or the given interval passes with changes pending
+             *
+             * @param changeThreshold Unsigned Long representing the changes to push out at
+             * @param intervalMs Long representing the push interval in milliseconds
+             *                   (or zero/negative to only push out at the threshold)
              */
-            explicit S3DataStore(std::shared_ptr<S3Credentials> s3Credentials);
+            void setMetadataFlushPolicy(unsigned long changeThreshold, long intervalMs);
+
+            /**
+             * Function used to set how written objects are reconciled with the
+             * (eventually consistent) s3-data-store in the background
+             * NOTE: Objects are re-checked with an exponentially growing delay
+             *
+             * @param maxConcurrency Unsigned Long representing the maximum look-ups in-flight
+             * @param initialDelayMs Long representing the delay before the first check
+             * @param maxDelayMs Long representing the maximum delay between checks
+             * @param shutdownDeadlineMs Long representing how long the instance waits
+             *                           for objects to be reconciled when released
+             */
+            void setReconcilePolicy(unsigned long maxConcurrency, long initialDelayMs,
+                    long maxDelayMs, long shutdownDeadlineMs);
+
+            /**
+             * Function used to set when (and how) large items are uploaded in parts
+             * NOTE: Items at or above the threshold are uploaded as a multipart
+             *       upload with the parts written in parallel
+             *
+             * @param thresholdBytes Unsigned Long Long representing the item size to upload in parts at
+             * @param partSizeBytes Unsigned Long Long representing the size of each part
+             *                      (at least 5 MiB as required by S3)
+             * @param maxConcurrency Unsigned Long representing the maximum parts in-flight
+             */
+            void setMultipartPolicy(unsigned long long thresholdBytes,
+                    unsigned long long partSizeBytes, unsigned long maxConcurrency);
+
+            /**
+             * Function used to enable (or disable) the in-process read-through cache
+             * of objects read with getItem
+             * NOTE: Cached objects are re-validated with a conditional read (which
+             *       only downloads the object if its ETag changed) once they are older
+             *       than the given age, and are invalidated by this instance's writes
+             *
+             * @param maxSize Unsigned Long Long representing the maximum bytes of
+             *                values to cache (or zero to disable the cache)
+             * @param revalidateAfterMs Long representing how long a cached object is
+             *                          served without being re-validated (or zero to
+             *                          re-validate the object on every read)
+             */
+            void enableObjectCache(unsigned long long maxSize, long revalidateAfterMs=0);
+
+            /**
+             * Function used to get the in-process object cache (for its statistics)
+             *
+             * @return Object Cache for the instance (or null if the cache is disabled)
+             */
+            std::shared_ptr<ObjectCache> getObjectCache();
+
+            /**
+             * Function used to enable (or disable) the on-disk cache of objects read
+             * with getItem (consulted for objects which are not cached in-memory)
+             * NOTE: Objects cached on-disk survive restarts and are always re-validated
+             *       with a conditional read (which only downloads changed objects)
+             *
+             * @param directory String representing the directory to cache objects in
+             * @param maxSize Unsigned Long Long representing the maximum bytes of
+             *                objects to cache (or zero to disable the cache)
+             */
+            void enableDiskCache(const std::string& directory, unsigned long long maxSize);
+
+            /**
+             * Function used to get the on-disk object cache (for its statistics)
+             *
+             * @return Disk Cache for the instance (or null if the cache is disabled)
+             */
+            std::shared_ptr<DiskCache> getDiskCache();
+
+            /**
+             * Function used to get the number of written objects which have not yet
+             * been reconciled with the (eventually consistent) s3-data-store
+             *
+             * @return Unsigned Long representing the number of unreconciled objects
+             */
+            unsigned long getUnreconciledCount();
+
+            /**
+             * Function used to immediately push out any pending metadata changes
+             *
+             * @return Boolean indicating whether the metadata was pushed out or not
+             */
+            bool flushMetaData();
+
+            /**
+             * Function used to load the sizes of the objects in the s3-data-store
+             * so that writes of the listed objects need not look-up the size of
+             * the object they replace
+             * NOTE: This will effectively translate to S3-list operation(s)
+             * NOTE: Only a bounded number of sizes are kept and objects which
+             *       were not listed are still looked-up (since other processes
+             *       may be writing to the same s3-data-store)
+             *
+             * @return Boolean indicating whether the object sizes were loaded or not
+             */
+            bool loadObjectSizes();
 
             /**
              * Function used to add an item to the s3-data-store
@@ -154,8 +390,148 @@ namespace BitBoson::BitQuark
              */
             std::string getItem(const std::string& key);
 
+            /**
+             * Function used to get the value for the given key along with its ETag
+             * (for use with conditional writes such as compare-and-set)
+             *
+             * @param key String representing the key for the item to get
+             * @param eTag String to populate with the value's ETag (empty if missing)
+             * @return String representing the value for the given key
+             */
+            std::string getItemWithETag(const std::string& key, std::string& eTag);
+
+            /**
+             * Function used to replace the value for the given key only if the value
+             * has not changed since it was read (i.e. it still has the expected ETag)
+             * NOTE: This is a single (atomic) conditional write
+             *
+             * @param key String representing the key for the item to replace
+             * @param expectedETag String representing the ETag the value must still have
+             * @param item String item to replace the value with
+             * @return Boolean indicating whether the value was replaced or not
+             */
+            bool compareAndSet(const std::string& key, const std::string& expectedETag,
+                    const std::string& item);
+
+            /**
+             * Function used to add an item to the s3-data-store only if no
+             * value already exists for the given key
+             * NOTE: This is a single (atomic) conditional write
+             *
+             * @param key String representing the key for the item to add
+             * @param item String item to add to the data store
+             * @return Boolean indicating whether the item was added or not
+             */
+            bool putIfAbsent(const std::string& key, const std::string& item);
+
+            /**
+             * Function used to stream the value for the given key into the given sink
+             * NOTE: The value is read in part-sized ranges so that only a single part
+             *       is ever held in memory at once
+             * NOTE: Every part is read from the same version of the value, so the
+             *       read fails (part-way through) if the value is replaced during it
+             *
+             * @param key String representing the key for the item to get
+             * @param sink Output Stream to write the value for the given key to
+             * @return Boolean indicating whether the entire value was written or not
+             */
+            bool getItem(const std::string& key, std::ostream& sink);
+
+            /**
+             * Function used to get the given range of the value for the given key
+             * NOTE: The range is shortened if it extends past the end of the value
+             *
+             * @param key String representing the key for the item to get
+             * @param offset Long Long Integer representing the offset to start reading at
+             * @param length Long Long Integer representing the number of bytes to read
+             * @return String representing the range of the value for the given key
+             */
+            std::string getItemRange(const std::string& key, long long int offset,
+                    long long int length);
+
+            /**
+             * Function used to read the given range of the value for the given key
+             * directly into the given (caller-owned) buffer
+             * NOTE: The buffer contents are undefined if the read fails
+             *
+             * @param key String representing the key for the item to get
+             * @param offset Long Long Integer representing the offset to start reading at
+             * @param buffer Character Pointer representing the buffer to read into
+             * @param bufferSize Long Long Integer representing the number of bytes to read
+             * @return Long Long Integer representing the bytes read (zero if the offset
+             *         is past the end of the value) or -1 if the read failed
+             */
+            long long int getItemRange(const std::string& key, long long int offset,
+                    char* buffer, long long int bufferSize);
+
+            /**
+             * Function used to get the values for the given keys in a single batch
+             * NOTE: Values are read in parallel, up to the given concurrency
+             *
+             * @param keys Vector of Strings representing the keys for the items to get
+             * @param maxConcurrency Unsigned Long representing the maximum requests in-flight
+             * @return Unordered String-String map of each key to its value (empty if missing)
+             */
+            std::unordered_map<std::string, std::string> getItems(
+                    const std::vector<std::string>& keys, unsigned long maxConcurrency=16);
+
+            /**
+             * Function used to add the given items to the s3-data-store in a single batch
+             * NOTE: Items are written in parallel, up to the given concurrency, and the
+             *       metadata is only pushed once for the entire batch
+             *
+             * @param items Unordered String-String map representing the key-value items to add
+             * @param maxConcurrency Unsigned Long representing the maximum requests in-flight
+             * @return Boolean indicating whether all of the items were added or not
+             */
+            bool addItems(const std::unordered_map<std::string, std::string>& items,
+                    unsigned long maxConcurrency=16);
+
+            /**
+             * Function used to delete the given items from the s3-data-store in a single batch
+             * NOTE: The metadata is only pushed once for the entire batch
+             *
+             * @param keys Vector of Strings representing the keys for the items to delete
+             * @param supportsMultiDelete Boolean indicating whether the back-end
+             *                            cloud provider supports multi-item S3 delete
+             * @param maxConcurrency Unsigned Long representing the maximum requests in-flight
+             * @return Boolean indicating whether all of the items were deleted or not
+             */
+            bool deleteItems(const std::vector<std::string>& keys,
+                    bool supportsMultiDelete=true, unsigned long maxConcurrency=16);
+
+            /**
+             * Function used to add an item to the s3-data-store asynchronously
+             * NOTE: The instance must outlive the returned future
+             *
+             * @param key String representing the key for the item to add
+             * @param item String item to add to the data store
+             * @return Future of the Boolean indicating whether the item was added or not
+             */
+            std::future<bool> addItemAsync(const std::string& key, std::string item);
+
+            /**
+             * Function used to get the value for the given key asynchronously
+             * NOTE: The instance must outlive the returned future
+             *
+             * @param key String representing the key for the item to get
+             * @return Future of the String representing the value for the given key
+             */
+            std::future<std::string> getItemAsync(const std::string& key);
+
+            /**
+             * Function used to delete the given item from the s3-data-store asynchronously
+             * NOTE: The instance must outlive the returned future
+             *
+             * @param key String representing the key for the item to delete
+             * @return Future of the Boolean indicating whether the item was deleted or not
+             */
+            std::future<bool> deleteItemAsync(const std::string& key);
+
             /**
              * Function used to get the given object's size
+             * NOTE: The object is only looked-up in the s3-data-store if its size
+             *       is not already known from a previous read, write or listing
              *
              * @param key String representing the key for the item to get
              * @return Long Long Integer representing the object's size in bytes
@@ -164,12 +540,17 @@ namespace BitBoson::BitQuark
 
             /**
              * Function used to list all of the items in the S3 Data-store
-             * NOTE: This will effectively translate to S3-list operation(s)
+             * NOTE: This will effectively translate to S3-list operation(s) where the
+             *       next page is always requested before the current page is yielded
              *
              * @param prefix String representing the object-key prefix to use (if any)
+             * @param maxConcurrency Unsigned Long representing the number of key-ranges to
+             *                       list in parallel (keys are still yielded in order),
+             *                       which are split based on a sample of the stored keys
              * @return Generator of Strings representing the keys in the S3 data-store
              */
-            std::shared_ptr<StandardModel::Generator<std::string>> listItems(const std::string& prefix="");
+            std::shared_ptr<StandardModel::Generator<std::string>> listItems(const std::string& prefix="",
+                    unsigned long maxConcurrency=1);
 
             /**
              * Function used to get the S3-Data-Store size
@@ -226,32 +607,203 @@ namespace BitBoson::BitQuark
              *
              * @param key String representing the key for the item to add
              * @param item String item to add to the data store
+             * @param ifMatch String representing the ETag the existing item must have (if any)
+             * @param ifNoneMatch String representing the ETag the existing item must not
+             *                    have (or "*" for the item to not exist at all, if any)
              * @return Boolean indicating whether the item was added or not
              */
-            bool addItemHelper(const std::string& key, const std::string& item);
+            bool addItemHelper(const std::string& key, const std::string& item,
+                    const std::string& ifMatch="", const std::string& ifNoneMatch="");
 
             /**
-             * Function used to flush (or remove) no-longer needed cache values
+             * Internal function used to add an item to the s3-data-store as a multipart
+             * upload (with the parts uploaded in parallel from the item's memory)
              *
-             * @param ensureConsistent Boolean indicating to ensure the local
-             *                         stat is consistent with the cloud state
+             * @param key String representing the key for the item to add
+             * @param item String item to add to the data store
+             * @return Boolean indicating whether the item was added or not
              */
-            void flushCacheIfPossible(bool ensureConsistent = false);
+            bool multipartUpload(const std::string& key, const std::string& item);
 
             /**
-             * Function used to get the metadata structure for the instance
+             * Internal function used to add an item to the s3-data-store tracking its
+             * size in the internal metadata (without pushing the metadata out)
              *
-             * @return S3-Meta-Data structure representing the instance's metadata
+             * @param key String representing the key for the item to add
+             * @param item String item to add to the data store
+             * @param ifMatch String representing the ETag the existing item must have (if any)
+             * @param ifNoneMatch String representing the ETag the existing item must not
+             *                    have (or "*" for the item to not exist at all, if any)
+             * @return Boolean indicating whether the item was added or not
              */
-            S3MetaData getMetaData();
+            bool addItemAndTrackSize(const std::string& key, const std::string& item,
+                    const std::string& ifMatch="", const std::string& ifNoneMatch="");
 
             /**
-             * Function used to set the metadata structure for the instance
+             * Internal function used to delete an item from the s3-data-store tracking
+             * its size in the internal metadata (without pushing the metadata out)
              *
-             * @param s3MetaData S3-Meta-Data structure representing the instance's metadata
-             * @return Boolean indicating whether the metadata was updated/set or not
+             * @param key String representing the key for the item to delete
+             * @return Boolean indicating whether the item was deleted or not
              */
-            bool setMetaData(S3MetaData s3MetaData);
+            bool deleteItemAndTrackSize(const std::string& key);
+
+            /**
+             * Internal function used to run the given operation for every index in a batch
+             * NOTE: The calling thread works on the batch alongside the thread-pool so
+             *       that the batch always makes progress
+             *
+             * @param itemCount Unsigned Long representing the number of items in the batch
+             * @param maxConcurrency Unsigned Long representing the maximum operations in-flight
+             * @param operation Function representing the operation to run for each index
+             */
+            void runBatch(unsigned long itemCount, unsigned long maxConcurrency,
+                    const std::function<void(unsigned long)>& operation);
+
+            /**
+             * Internal function used to run the given operation on the asynchronous thread-pool
+             *
+             * @param operation Function representing the operation to run
+             */
+            void runAsync(std::function<void()> operation);
+
+            /**
+             * Internal function used to wait for (and take) exclusive write access to the
+             * given key so that concurrent writes to the same key are sized in order
+             *
+             * @param key String representing the key to take write access to
+             */
+            void acquireKey(const std::string& key);
+
+            /**
+             * Internal function used to release write access to the given key
+             *
+             * @param key String representing the key to release write access to
+             */
+            void releaseKey(const std::string& key);
+
+            /**
+             * Internal function used to invalidate (remove) any cached versions
+             * of the given object from the in-memory and on-disk caches
+             *
+             * @param key String representing the key for the object
+             */
+            void invalidateCachedItem(const std::string& key);
+
+            /**
+             * Internal function used to get the on-disk cache key for the given key
+             * NOTE: This includes the bucket and directory so that on-disk caches can
+             *       be safely re-used across s3-data-stores
+             *
+             * @param key String representing the key for the object
+             * @return String representing the object's on-disk cache key
+             */
+            std::string getDiskCacheKey(const std::string& key) const;
+
+            /**
+             * Internal function used to look-up the given object's size in the
+             * s3-data-store, removing it from the memoization map if it matches
+             *
+             * @param key String representing the key for the object
+             * @return Long Long Integer representing the object's size in bytes
+             */
+            long long int reconcileObjectSize(const std::string& key);
+
+            /**
+             * Internal function used to read the given range of the value for the
+             * given key directly into the given (caller-owned) buffer, only reading
+             * from the version of the value with the given ETag (if one is given)
+             *
+             * @param key String representing the key for the item to get
+             * @param offset Long Long Integer representing the offset to start reading at
+             * @param buffer Character Pointer representing the buffer to read into
+             * @param bufferSize Long Long Integer representing the number of bytes to read
+             * @param eTag String representing the ETag the value must have (or empty for
+             *             any version) which is set to the ETag of the value read
+             * @param wasReplaced Boolean set to indicate the value no longer has the ETag
+             * @param objectSize Long Long Integer set to the value's total size (if the
+             *                   read reported it) or left unchanged otherwise
+             * @return Long Long Integer representing the bytes read (zero if the offset
+             *         is past the end of the value) or -1 if the read failed
+             */
+            long long int readItemRange(const std::string& key, long long int offset,
+                    char* buffer, long long int bufferSize, std::string& eTag, bool& wasReplaced,
+                    long long int& objectSize);
+
+            /**
+             * Internal function used to record the given object's (known) size,
+             * evicting another object's size if too many sizes are known
+             * NOTE: The instance's lock must be held when calling this function
+             *
+             * @param key String representing the key for the object
+             * @param size Long Long Integer representing the object's size in bytes
+             * @param replace Boolean indicating whether to replace an existing size
+             */
+            void recordObjectSizeUnlocked(const std::string& key, long long int size, bool replace=true);
+
+            /**
+             * Internal function used to record that the metadata has changed
+             *
+             * @param changes Unsigned Long representing the number of changes made
+             */
+            void markMetaDataChanged(unsigned long changes=1);
+
+            /**
+             * Internal function used to start the metadata flusher and reconciler threads
+             */
+            void startBackgroundThreads();
+
+            /**
+             * Internal function used to stop the metadata flusher and reconciler threads
+             */
+            void stopBackgroundThreads();
+
+            /**
+             * Internal function used to run the metadata flusher thread
+             */
+            void runMetadataFlusher();
+
+            /**
+             * Internal function used to run the reconciler thread
+             */
+            void runReconciler();
+
+            /**
+             * Internal static function used to get the process-wide registry of
+             * running instances (used to flush sibling instances' metadata)
+             *
+             * @return Instance Registry reference for the process
+             */
+            static InstanceRegistry& getInstanceRegistry();
+
+            /**
+             * Internal function used to get the instance's registry key
+             *
+             * @return String representing the bucket and directory of the instance
+             */
+            std::string getRegistryKey() const;
+
+            /**
+             * Internal function used to wait for outstanding operations and
+             * push out any pending state before the instance is released
+             */
+            void shutdown();
+
+            /**
+             * Function used to flush (or remove) no-longer needed cache values
+             * NOTE: The objects are looked-up with bounded concurrency
+             *
+             * @param onlyDue Boolean indicating to only check the objects
+             *                which are due to be re-checked
+             */
+            void flushCacheIfPossible(bool onlyDue);
+
+            /**
+             * Function used to get the metadata structure for the instance
+             *
+             * @return S3-Meta-Data structure representing the instance's metadata
+             */
+            S3MetaData getMetaData();
     };
 }
 
@@ -51,6 +51,11 @@ TEST_CASE("Single Random Master-Node Cluster Test", "[MasterNodeTest]")
     REQUIRE(response.body["QuorumMet"] == "True");
     REQUIRE(response.body["ClusterSize"] == "1/1");
 
+    // Validate that the typed cluster details match
+    REQUIRE(response.data.get("Cluster").get("ConnectedNodes").getInt() == 1);
+    REQUIRE(response.data.get("Cluster").get("TotalNodes").getInt() == 1);
+    REQUIRE(response.data.get("Cluster").get("QuorumMet").getBool());
+
     // Validate that the internal status checks-out
     response = Requests::makeRequest(
             Servable::HttpMethod::GET, "http://localhost:9996/internal/master/status", {});
@@ -58,6 +63,8 @@ TEST_CASE("Single Random Master-Node Cluster Test", "[MasterNodeTest]")
     REQUIRE(response.body.size() == 3);
     REQUIRE(response.body["QuorumMet"] == "True");
     REQUIRE(response.body["ClusterSize"] == "1/1");
+    REQUIRE(response.data.get("Members").getType() == Payload::Type::ARRAY);
+    REQUIRE(response.data.get("Members").size() == 0);
 }
 
 TEST_CASE("Single Named Master-Node Cluster Test", "[MasterNodeTest]")
@@ -494,6 +501,126 @@ TEST_CASE("Multiple Master-Nodes Cluster Test", "[MasterNodeTest]")
     REQUIRE(response.body["ClusterSize"] == "2/2");
 }
 
+TEST_CASE("In-Process Multiple Master-Nodes Cluster Test", "[MasterNodeTest]")
+{
+
+    // Create three master nodes served in-process (without any ports)
+    auto masterNode1 = std::make_shared<MasterNode>("inproc://master1", 0, "SpecifiedId1");
+    masterNode1->start();
+    auto masterNode2 = std::make_shared<MasterNode>("inproc://master2", 0, "SpecifiedId2");
+    masterNode2->start();
+    auto masterNode3 = std::make_shared<MasterNode>("inproc://master3", 0, "SpecifiedId3");
+    masterNode3->start();
+
+    // Validate that each individual server has quorum status
+    auto response = Requests::makeRequest(
+            Servable::HttpMethod::GET, "inproc://master1/cluster/status", {});
+    REQUIRE(response.code == 200);
+    REQUIRE(response.body.size() == 3);
+    REQUIRE(response.body["SpecifiedId1"] == "SelfInstance");
+    REQUIRE(response.body["QuorumMet"] == "True");
+
+    // Add the second two nodes to the first node
+    response = Requests::makeRequest(
+            Servable::HttpMethod::POST, "inproc://master1/internal/master/join",
+            {{"NodeId", "SpecifiedId2"}, {"NodeUrl", "inproc://master2"}});
+    REQUIRE(response.code == 201);
+    REQUIRE(response.body["AddedNode"] == "True");
+    response = Requests::makeRequest(
+            Servable::HttpMethod::POST, "inproc://master1/internal/master/join",
+            {{"NodeId", "SpecifiedId3"}, {"NodeUrl", "inproc://master3"}});
+    REQUIRE(response.code == 201);
+    REQUIRE(response.body["AddedNode"] == "True");
+
+    // Ensure the server has a chance to connect to each other
+    std::this_thread::sleep_for(std::chrono::seconds(20));
+
+    // Verify that the master nodes are connected to each other in-process
+    REQUIRE (masterNode1->isInQuorum());
+    REQUIRE (masterNode1->getConnectedMasters().size() == 2);
+    REQUIRE (masterNode2->isInQuorum());
+    REQUIRE (masterNode2->getConnectedMasters().size() == 2);
+    REQUIRE (masterNode3->isInQuorum());
+    REQUIRE (masterNode3->getConnectedMasters().size() == 2);
+    REQUIRE (masterNode1->getUrlForConnectedMasterNode("SpecifiedId2") == "inproc://master2");
+    REQUIRE (masterNode2->getUrlForConnectedMasterNode("SpecifiedId3") == "inproc://master3");
+    REQUIRE (masterNode3->getUrlForConnectedMasterNode("SpecifiedId1") == "inproc://master1");
+}
+
+TEST_CASE("Binary Transport Multiple Master-Nodes Cluster Test", "[MasterNodeTest]")
+{
+
+    // Create three master nodes serving their internal routes over the binary transport
+    auto masterNode1 = std::make_shared<MasterNode>("localhost", 9996, "SpecifiedId1", 19996);
+    REQUIRE (masterNode1->start());
+    auto masterNode2 = std::make_shared<MasterNode>("localhost", 9997, "SpecifiedId2", 19997);
+    REQUIRE (masterNode2->start());
+    auto masterNode3 = std::make_shared<MasterNode>("localhost", 9998, "SpecifiedId3", 19998);
+    REQUIRE (masterNode3->start());
+
+    // Validate that a node whose binary port is already in use reports the
+    // failure (and so does not advertise it) while still serving over HTTP
+    auto conflictingNode = std::make_shared<MasterNode>("localhost", 9995, "SpecifiedId4", 19996);
+    REQUIRE (!conflictingNode->start());
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+    auto conflictingResponse = Requests::makeRequest(
+            Servable::HttpMethod::GET, "http://localhost:9995/internal/master/status", {});
+    REQUIRE(conflictingResponse.code == 200);
+    conflictingNode = nullptr;
+
+    // Validate that the internal routes are served over the binary transport
+    // while the external routes are still only served over HTTP
+    auto response = Requests::makeRequest(
+            Servable::HttpMethod::GET, "bq://localhost:19996/internal/master/status", {});
+    REQUIRE(response.code == 200);
+    response = Requests::makeRequest(
+            Servable::HttpMethod::GET, "bq://localhost:19996/cluster/status", {});
+    REQUIRE(response.code == 404);
+
+    // Add the second two nodes to the first node using their binary URLs
+    response = Requests::makeRequest(
+            Servable::HttpMethod::POST, "http://localhost:9996/internal/master/join",
+            {{"NodeId", "SpecifiedId2"}, {"NodeUrl", "bq://localhost:19997"}});
+    REQUIRE(response.code == 201);
+    REQUIRE(response.body["AddedNode"] == "True");
+    response = Requests::makeRequest(
+            Servable::HttpMethod::POST, "http://localhost:9996/internal/master/join",
+            {{"NodeId", "SpecifiedId3"}, {"NodeUrl", "bq://localhost:19998"}});
+    REQUIRE(response.code == 201);
+    REQUIRE(response.body["AddedNode"] == "True");
+
+    // Ensure the server has a chance to connect to each other
+    std::this_thread::sleep_for(std::chrono::seconds(20));
+
+    // Verify that the master nodes are connected (and heartbeating) over the
+    // binary transport using the URLs they advertise to each other
+    REQUIRE (masterNode1->isInQuorum());
+    REQUIRE (masterNode1->getConnectedMasters().size() == 2);
+    REQUIRE (masterNode2->isInQuorum());
+    REQUIRE (masterNode2->getConnectedMasters().size() == 2);
+    REQUIRE (masterNode3->isInQuorum());
+    REQUIRE (masterNode3->getConnectedMasters().size() == 2);
+    REQUIRE (masterNode1->getUrlForConnectedMasterNode("SpecifiedId2") == "bq://localhost:19997");
+    REQUIRE (masterNode2->getUrlForConnectedMasterNode("SpecifiedId3") == "bq://localhost:19998");
+    REQUIRE (masterNode3->getUrlForConnectedMasterNode("SpecifiedId1") == "bq://localhost:19996");
+
+    // Have a worker node join the second master node over the binary transport
+    auto workerNode = std::make_shared<WorkerNode>("localhost", 9986, "WorkerId1", 19986);
+    REQUIRE (workerNode->start());
+    response = Requests::makeRequest(
+            Servable::HttpMethod::POST, "bq://localhost:19986/internal/worker/join",
+            {{"NodeId", "SpecifiedId2"}, {"NodeUrl", "bq://localhost:19997"}});
+    REQUIRE(response.code == 201);
+    REQUIRE(response.body["AddedNode"] == "True");
+
+    // Ensure the worker has a chance to heartbeat with the master node
+    std::this_thread::sleep_for(std::chrono::seconds(20));
+
+    // Verify that the worker and master nodes are connected over the binary transport
+    REQUIRE (workerNode->getConnectedMaster() == "SpecifiedId2");
+    REQUIRE (masterNode2->getConnectedWorkers().size() == 1);
+}
+
 TEST_CASE("Post a Bad Master Join Cluster Test", "[MasterNodeTest]")
 {
 
@@ -22,6 +22,10 @@
 #ifndef BITQUARK_GLOBALSTATE_TEST_HPP
 #define BITQUARK_GLOBALSTATE_TEST_HPP
 
+#include <chrono>
+#include <future>
+#include <thread>
+#include <BitBoson/StandardModel/Utils/Utils.h>
 #include <BitBoson/BitQuark/Cluster/State/GlobalState.h>
 
 using namespace BitBoson::BitQuark;
@@ -636,4 +640,111 @@ TEST_CASE ("Assign and Un-Assign Resource Groups Global State Test", "[GlobalSta
     REQUIRE (globalState->clearEntireState());
 }
 
+TEST_CASE ("Competing Claims on a Resource Group Global State Test", "[GlobalStateTest]")
+{
+
+    // Create two global state objects (for competing managers) to use for testing
+    auto credentials = getTestGlobalStateCredentials("GlobalStateTest");
+    auto globalState = std::make_shared<GlobalState>(credentials, GlobalState::Mode::READ_WRITE);
+    auto otherGlobalState = std::make_shared<GlobalState>(credentials, GlobalState::Mode::READ_WRITE);
+
+    // Ensure that the global state is empty
+    REQUIRE (globalState->clearEntireState());
+
+    // Validate that a resource group can only be added once
+    REQUIRE (globalState->addResourceGroup("abc123"));
+    REQUIRE (!otherGlobalState->addResourceGroup("abc123"));
+
+    // Have both managers claim the resource group at the same time
+    auto claimFuture = std::async(std::launch::async, [globalState]() {
+        return globalState->claimManagedResourceGroup("ResourceId1", "abc123"); });
+    auto otherClaimFuture = std::async(std::launch::async, [otherGlobalState]() {
+        return otherGlobalState->claimManagedResourceGroup("ResourceId2", "abc123"); });
+    bool wasClaimed = claimFuture.get();
+    bool wasOtherClaimed = otherClaimFuture.get();
+
+    // Validate that exactly one of the managers claimed the resource group
+    REQUIRE (wasClaimed != wasOtherClaimed);
+    auto assignedResourceGroups = globalState->listManagedResourceGroups(
+            wasClaimed ? "ResourceId1" : "ResourceId2");
+    REQUIRE (assignedResourceGroups->hasMoreItems());
+    REQUIRE (assignedResourceGroups->getNextItem() == "abc123");
+    REQUIRE (!assignedResourceGroups->hasMoreItems());
+    assignedResourceGroups = globalState->listManagedResourceGroups(
+            wasClaimed ? "ResourceId2" : "ResourceId1");
+    REQUIRE (!assignedResourceGroups->hasMoreItems());
+    REQUIRE (!globalState->listUnmanagedResourceGroups()->hasMoreItems());
+
+    // Cleanup the global-state when we are finished
+    REQUIRE (globalState->clearEntireState());
+}
+
+TEST_CASE ("Abandoned Claims on Resource Groups Global State Test", "[GlobalStateTest]")
+{
+
+    // Create a global state object and a raw data-store (for crashed managers) to use for testing
+    auto credentials = getTestGlobalStateCredentials("GlobalStateTest");
+    auto globalState = std::make_shared<GlobalState>(credentials, GlobalState::Mode::READ_WRITE);
+    auto dataStore = std::make_shared<S3DataStore>(credentials);
+
+    // Ensure that the global state is empty
+    REQUIRE (globalState->clearEntireState());
+
+    // Add the resource groups to use for testing
+    REQUIRE (globalState->addResourceGroup("abc123"));
+    REQUIRE (globalState->addResourceGroup("def456"));
+    REQUIRE (globalState->addResourceGroup("ghi789"));
+
+    // Simulate a manager crashing right after claiming a resource group,
+    // another crashing after assigning one but before completing the claim
+    // and a third that has only just claimed a resource group
+    REQUIRE (dataStore->addItem("Assignments/Unassigned/abc123",
+            StandardModel::Utils::getFileString({"CLAIMED", "ResourceId1", "0"})));
+    REQUIRE (dataStore->addItem("Assignments/Unassigned/def456",
+            StandardModel::Utils::getFileString({"CLAIMED", "ResourceId1", "0"})));
+    REQUIRE (dataStore->addItem("Assignments/Assigned/ResourceId1/def456", "ASSIGNED"));
+    auto claimTime = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+    REQUIRE (dataStore->addItem("Assignments/Unassigned/ghi789",
+            StandardModel::Utils::getFileString({"CLAIMED", "ResourceId3", std::to_string(claimTime)})));
+
+    // Validate that only the abandoned claim is released by a sweep
+    REQUIRE (globalState->sweepStaleClaims() == 1);
+    REQUIRE (dataStore->getItem("Assignments/Unassigned/abc123") == "UNASSIGNED");
+    REQUIRE (!globalState->claimManagedResourceGroup("ResourceId2", "ghi789"));
+
+    // Validate that the assigned resource group had its claim completed
+    auto assignedResourceGroups = globalState->listManagedResourceGroups("ResourceId1");
+    REQUIRE (assignedResourceGroups->hasMoreItems());
+    REQUIRE (assignedResourceGroups->getNextItem() == "def456");
+    REQUIRE (!assignedResourceGroups->hasMoreItems());
+    auto unassignedResourceGroups = globalState->listUnmanagedResourceGroups();
+    REQUIRE (unassignedResourceGroups->hasMoreItems());
+    REQUIRE (unassignedResourceGroups->getNextItem() == "abc123");
+    REQUIRE (unassignedResourceGroups->hasMoreItems());
+    REQUIRE (unassignedResourceGroups->getNextItem() == "ghi789");
+    REQUIRE (!unassignedResourceGroups->hasMoreItems());
+
+    // Validate that the released resource group can now be claimed
+    REQUIRE (globalState->claimManagedResourceGroup("ResourceId2", "abc123"));
+
+    // Validate that an expired claim can be taken-over directly when claiming
+    globalState->setClaimTimeout(10);
+    REQUIRE (globalState->getClaimTimeout() == 10);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    REQUIRE (globalState->claimManagedResourceGroup("ResourceId2", "ghi789"));
+
+    // Verify that the resource groups are assigned accordingly
+    assignedResourceGroups = globalState->listManagedResourceGroups("ResourceId2");
+    REQUIRE (assignedResourceGroups->hasMoreItems());
+    REQUIRE (assignedResourceGroups->getNextItem() == "abc123");
+    REQUIRE (assignedResourceGroups->hasMoreItems());
+    REQUIRE (assignedResourceGroups->getNextItem() == "ghi789");
+    REQUIRE (!assignedResourceGroups->hasMoreItems());
+    REQUIRE (!globalState->listUnmanagedResourceGroups()->hasMoreItems());
+
+    // Cleanup the global-state when we are finished
+    REQUIRE (globalState->clearEntireState());
+}
+
 #endif //BITQUARK_GLOBALSTATE_TEST_HPP
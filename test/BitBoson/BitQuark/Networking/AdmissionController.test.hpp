@@ -0,0 +1,272 @@
+/* This file is part of bit-quark.
+ *
+ * Copyright (c) BitBoson
+ *
+ * bit-quark is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bit-quark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bit-quark.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#ifndef BITQUARK_ADMISSIONCONTROLLER_TEST_HPP
+#define BITQUARK_ADMISSIONCONTROLLER_TEST_HPP
+
+#include <catch.hpp>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <string>
+#include <thread>
+#include <vector>
+#include <stdexcept>
+#include <BitBoson/BitQuark/Networking/AdmissionController.h>
+
+using namespace BitBoson;
+using namespace BitBoson::BitQuark;
+
+TEST_CASE ("Unlimited Admission Controller Test", "[AdmissionControllerTest]")
+{
+
+    // Validate that everything is admitted without any limits
+    AdmissionController admissionController;
+    for (auto ii = 0; ii < 100; ii++)
+        REQUIRE(admissionController.admit(AdmissionController::RouteClass::EXTERNAL));
+    REQUIRE(admissionController.getActiveCount(AdmissionController::RouteClass::EXTERNAL) == 100);
+    REQUIRE(admissionController.getShedCount(AdmissionController::RouteClass::EXTERNAL) == 0);
+
+    // Validate that the routes are classified by their prefix
+    REQUIRE(AdmissionController::classify("/internal/master/status")
+            == AdmissionController::RouteClass::INTERNAL);
+    REQUIRE(AdmissionController::classify("/cluster/status")
+            == AdmissionController::RouteClass::EXTERNAL);
+}
+
+TEST_CASE ("Shedding Admission Controller Test", "[AdmissionControllerTest]")
+{
+
+    // Create an admission controller which allows a single request without queueing
+    AdmissionController admissionController(1, 50);
+
+    // Validate that the excess request is shed (quickly) and counted
+    REQUIRE(admissionController.admit(AdmissionController::RouteClass::EXTERNAL));
+    auto startTime = std::chrono::steady_clock::now();
+    REQUIRE(!admissionController.admit(AdmissionController::RouteClass::EXTERNAL));
+    REQUIRE((std::chrono::steady_clock::now() - startTime) < std::chrono::milliseconds(50));
+    REQUIRE(admissionController.getShedCount(AdmissionController::RouteClass::EXTERNAL) == 1);
+
+    // Validate that a queued request is shed once it has waited too long
+    admissionController.setClassLimits(AdmissionController::RouteClass::EXTERNAL, 0, 1);
+    REQUIRE(!admissionController.admit(AdmissionController::RouteClass::EXTERNAL));
+    REQUIRE(admissionController.getShedCount(AdmissionController::RouteClass::EXTERNAL) == 2);
+
+    // Validate that capacity is available again once released
+    admissionController.release(AdmissionController::RouteClass::EXTERNAL);
+    REQUIRE(admissionController.admit(AdmissionController::RouteClass::EXTERNAL));
+    REQUIRE(admissionController.getAdmittedCount(AdmissionController::RouteClass::EXTERNAL) == 2);
+}
+
+TEST_CASE ("Priority Admission Controller Test", "[AdmissionControllerTest]")
+{
+
+    // Create an admission controller which allows a single request at a time
+    AdmissionController admissionController(1, 5000);
+    admissionController.setClassLimits(AdmissionController::RouteClass::INTERNAL, 0, 4);
+    admissionController.setClassLimits(AdmissionController::RouteClass::EXTERNAL, 0, 4);
+    REQUIRE(admissionController.admit(AdmissionController::RouteClass::EXTERNAL));
+
+    // Queue an external request followed by an internal one
+    std::atomic<int> admittedOrder(0);
+    std::atomic<int> externalOrder(0);
+    std::atomic<int> internalOrder(0);
+    auto externalFuture = std::async(std::launch::async, [&]()
+    {
+        admissionController.admit(AdmissionController::RouteClass::EXTERNAL);
+        externalOrder = ++admittedOrder;
+        admissionController.release(AdmissionController::RouteClass::EXTERNAL);
+    });
+    while (admissionController.getQueuedCount(AdmissionController::RouteClass::EXTERNAL) == 0)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    auto internalFuture = std::async(std::launch::async, [&]()
+    {
+        admissionController.admit(AdmissionController::RouteClass::INTERNAL);
+        internalOrder = ++admittedOrder;
+        admissionController.release(AdmissionController::RouteClass::INTERNAL);
+    });
+    while (admissionController.getQueuedCount(AdmissionController::RouteClass::INTERNAL) == 0)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    // Validate that the internal request is admitted first once capacity frees-up
+    admissionController.release(AdmissionController::RouteClass::EXTERNAL);
+    externalFuture.wait();
+    internalFuture.wait();
+    REQUIRE(internalOrder == 1);
+    REQUIRE(externalOrder == 2);
+    REQUIRE(admissionController.getShedCount(AdmissionController::RouteClass::INTERNAL) == 0);
+    REQUIRE(admissionController.getShedCount(AdmissionController::RouteClass::EXTERNAL) == 0);
+}
+
+TEST_CASE ("Parked Admission Controller Test", "[AdmissionControllerTest]")
+{
+
+    // Create an admission controller which allows a single request at a time
+    AdmissionController admissionController(1, 5000);
+    admissionController.setClassLimits(AdmissionController::RouteClass::INTERNAL, 0, 4);
+    admissionController.setClassLimits(AdmissionController::RouteClass::EXTERNAL, 0, 1);
+
+    // Validate that a request with capacity is resumed right away
+    std::vector<std::string> resumedOrder;
+    admissionController.admit(AdmissionController::RouteClass::EXTERNAL,
+        [&resumedOrder](bool admitted)
+        {
+            resumedOrder.push_back(admitted ? "first" : "first-shed");
+        });
+    REQUIRE(resumedOrder.size() == 1);
+    REQUIRE(resumedOrder[0] == "first");
+
+    // Validate that requests without capacity are parked without blocking
+    // and that those beyond the queue limit are shed right away
+    admissionController.admit(AdmissionController::RouteClass::EXTERNAL,
+        [&resumedOrder, &admissionController](bool admitted)
+        {
+            resumedOrder.push_back(admitted ? "external" : "external-shed");
+            if (admitted)
+                admissionController.release(AdmissionController::RouteClass::EXTERNAL);
+        });
+    admissionController.admit(AdmissionController::RouteClass::EXTERNAL,
+        [&resumedOrder](bool admitted)
+        {
+            resumedOrder.push_back(admitted ? "overflow" : "overflow-shed");
+        });
+    admissionController.admit(AdmissionController::RouteClass::INTERNAL,
+        [&resumedOrder, &admissionController](bool admitted)
+        {
+            resumedOrder.push_back(admitted ? "internal" : "internal-shed");
+            if (admitted)
+                admissionController.release(AdmissionController::RouteClass::INTERNAL);
+        });
+    REQUIRE(resumedOrder.size() == 2);
+    REQUIRE(resumedOrder[1] == "overflow-shed");
+    REQUIRE(admissionController.getQueuedCount(AdmissionController::RouteClass::INTERNAL) == 1);
+    REQUIRE(admissionController.getQueuedCount(AdmissionController::RouteClass::EXTERNAL) == 1);
+
+    // Validate that releasing resumes the parked requests in priority order
+    admissionController.release(AdmissionController::RouteClass::EXTERNAL);
+    REQUIRE(resumedOrder.size() == 4);
+    REQUIRE(resumedOrder[2] == "internal");
+    REQUIRE(resumedOrder[3] == "external");
+    REQUIRE(admissionController.getActiveCount(AdmissionController::RouteClass::INTERNAL) == 0);
+    REQUIRE(admissionController.getActiveCount(AdmissionController::RouteClass::EXTERNAL) == 0);
+    REQUIRE(admissionController.getQueuedCount(AdmissionController::RouteClass::EXTERNAL) == 0);
+
+    // Validate that parked requests are shed when asked to (such as when stopping)
+    REQUIRE(admissionController.admit(AdmissionController::RouteClass::EXTERNAL));
+    admissionController.admit(AdmissionController::RouteClass::INTERNAL,
+        [&resumedOrder](bool admitted)
+        {
+            resumedOrder.push_back(admitted ? "stopped" : "stopped-shed");
+        });
+    admissionController.shedParkedRequests();
+    REQUIRE(resumedOrder.size() == 5);
+    REQUIRE(resumedOrder[4] == "stopped-shed");
+    REQUIRE(admissionController.getQueuedCount(AdmissionController::RouteClass::INTERNAL) == 0);
+}
+
+TEST_CASE ("Guarded Admission Controller Test", "[AdmissionControllerTest]")
+{
+
+    // Create an admission controller which allows a single request without queueing
+    AdmissionController admissionController(1, 50);
+
+    // Validate that the guard releases the request even if its handler throws
+    REQUIRE(admissionController.admit(AdmissionController::RouteClass::EXTERNAL));
+    try
+    {
+        AdmissionController::Guard admissionGuard(admissionController,
+                AdmissionController::RouteClass::EXTERNAL);
+        throw std::runtime_error("Handler Failed");
+    }
+    catch (const std::runtime_error&)
+    {
+    }
+    REQUIRE(admissionController.getActiveCount(AdmissionController::RouteClass::EXTERNAL) == 0);
+    REQUIRE(admissionController.admit(AdmissionController::RouteClass::EXTERNAL));
+}
+
+TEST_CASE ("Failing Resumption Admission Controller Test", "[AdmissionControllerTest]")
+{
+
+    // Create an admission controller which allows a single request at a time
+    AdmissionController admissionController(1, 5000);
+    admissionController.setClassLimits(AdmissionController::RouteClass::EXTERNAL, 0, 2);
+
+    // Park a request which fails once resumed followed by one which succeeds
+    REQUIRE(admissionController.admit(AdmissionController::RouteClass::EXTERNAL));
+    std::vector<std::string> resumedOrder;
+    admissionController.admit(AdmissionController::RouteClass::EXTERNAL,
+        [&resumedOrder, &admissionController](bool admitted)
+        {
+            AdmissionController::Guard admissionGuard(admissionController,
+                    AdmissionController::RouteClass::EXTERNAL);
+            resumedOrder.push_back("failing");
+            throw std::runtime_error("Handler Failed");
+        });
+    admissionController.admit(AdmissionController::RouteClass::EXTERNAL,
+        [&resumedOrder, &admissionController](bool admitted)
+        {
+            AdmissionController::Guard admissionGuard(admissionController,
+                    AdmissionController::RouteClass::EXTERNAL);
+            resumedOrder.push_back("succeeding");
+        });
+
+    // Validate that a release (from a guard) resumes both without propagating the error
+    {
+        AdmissionController::Guard admissionGuard(admissionController,
+                AdmissionController::RouteClass::EXTERNAL);
+    }
+    REQUIRE(resumedOrder.size() == 2);
+    REQUIRE(resumedOrder[0] == "failing");
+    REQUIRE(resumedOrder[1] == "succeeding");
+    REQUIRE(admissionController.getActiveCount(AdmissionController::RouteClass::EXTERNAL) == 0);
+    REQUIRE(admissionController.getQueuedCount(AdmissionController::RouteClass::EXTERNAL) == 0);
+}
+
+TEST_CASE ("Expiring Parked Admission Controller Test", "[AdmissionControllerTest]")
+{
+
+    // Create an admission controller which allows a single request at a time
+    AdmissionController admissionController(1, 50);
+    admissionController.setClassLimits(AdmissionController::RouteClass::EXTERNAL, 0, 1);
+
+    // Park a request behind one which is never released
+    REQUIRE(admissionController.admit(AdmissionController::RouteClass::EXTERNAL));
+    std::promise<bool> resumedPromise;
+    auto resumedFuture = resumedPromise.get_future();
+    auto startTime = std::chrono::steady_clock::now();
+    admissionController.admit(AdmissionController::RouteClass::EXTERNAL,
+        [&resumedPromise](bool admitted)
+        {
+            resumedPromise.set_value(admitted);
+        });
+
+    // Validate that the request is shed once its queue timeout passes
+    // even though nothing else is admitted or released in the meantime
+    REQUIRE(resumedFuture.wait_for(std::chrono::seconds(2)) == std::future_status::ready);
+    REQUIRE(!resumedFuture.get());
+    REQUIRE((std::chrono::steady_clock::now() - startTime) >= std::chrono::milliseconds(50));
+    REQUIRE(admissionController.getQueuedCount(AdmissionController::RouteClass::EXTERNAL) == 0);
+    REQUIRE(admissionController.getShedCount(AdmissionController::RouteClass::EXTERNAL) == 1);
+}
+
+#endif //BITQUARK_ADMISSIONCONTROLLER_TEST_HPP
@@ -0,0 +1,261 @@
+/* This file is part of bit-quark.
+ *
+ * Copyright (c) BitBoson
+ *
+ * bit-quark is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bit-quark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bit-quark.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#ifndef BITQUARK_BINARYTRANSPORT_TEST_HPP
+#define BITQUARK_BINARYTRANSPORT_TEST_HPP
+
+#include <catch.hpp>
+#include <chrono>
+#include <string>
+#include <iostream>
+#include <unordered_map>
+#include <BitBoson/BitQuark/Networking/Payload.h>
+#include <BitBoson/BitQuark/Networking/Servable.h>
+#include <BitBoson/BitQuark/Networking/Requests.h>
+#include <BitBoson/BitQuark/Networking/BinaryCodec.h>
+#include <BitBoson/BitQuark/Networking/BinaryClient.h>
+
+using namespace BitBoson;
+using namespace BitBoson::BitQuark;
+
+class InternalServable : public Servable
+{
+    public:
+        InternalServable(int port, int binaryPort) : Servable(port)
+        {
+
+            // Serve the internal routes over the binary transport as well
+            enableBinaryTransport(binaryPort);
+
+            // Setup the internal GET listener
+            addListener(HttpMethod::GET, "/internal/hello", "",
+                [](std::unordered_map<std::string, std::string>& headers,
+                    std::unordered_map<std::string, std::string>& body,
+                    const std::string& routeArg) -> ResponseObj
+                {
+                    return ResponseObj{200, {{"message", "world"}}};
+                });
+
+            // Setup the internal GET listener with a route-argument
+            addListener(HttpMethod::GET, "/internal/hello", "name",
+                [](std::unordered_map<std::string, std::string>& headers,
+                    std::unordered_map<std::string, std::string>& body,
+                    const std::string& routeArg) -> ResponseObj
+                {
+                    return ResponseObj{200, {{"message", routeArg}}};
+                });
+
+            // Setup the internal (typed) POST listener
+            addTypedListener(HttpMethod::POST, "/internal/hellotyped", "",
+                [](std::unordered_map<std::string, std::string>& headers,
+                    Payload& body, const std::string& routeArg) -> ResponseObj
+                {
+                    ResponseObj response{201, {{"name", body.get("name").getString()}}};
+                    response.data["count"] = (body.get("count").getInt() + 1);
+                    return response;
+                });
+
+            // Setup the external GET listener
+            addListener(HttpMethod::GET, "/cluster/hello", "",
+                [](std::unordered_map<std::string, std::string>& headers,
+                    std::unordered_map<std::string, std::string>& body,
+                    const std::string& routeArg) -> ResponseObj
+                {
+                    return ResponseObj{200, {{"message", "world"}}};
+                });
+        }
+
+        /**
+         * Destructor used to cleanup the instance
+         */
+        virtual ~InternalServable()
+        {
+            stop();
+        }
+};
+
+TEST_CASE ("Binary Codec Round-Trip Test", "[BinaryTransportTest]")
+{
+
+    // Encode a request with string and typed values
+    Payload data;
+    data["count"] = -42;
+    data["ratio"] = 0.25;
+    data["items"].push("one");
+    data["items"].push(false);
+    auto frame = BinaryCodec::encodeRequest(Servable::HttpMethod::POST,
+            "/internal/master/join", {{"NodeId", "node1"}}, data);
+
+    // Validate that the request decodes to the same values
+    int method = 0;
+    std::string path;
+    Payload decodedData;
+    std::unordered_map<std::string, std::string> decodedValues;
+    REQUIRE(BinaryCodec::decodeRequest((frame.data() + BinaryCodec::FRAME_HEADER_SIZE),
+            (frame.size() - BinaryCodec::FRAME_HEADER_SIZE), method, path, decodedValues, decodedData));
+    REQUIRE(method == Servable::HttpMethod::POST);
+    REQUIRE(path == "/internal/master/join");
+    REQUIRE(decodedValues.size() == 1);
+    REQUIRE(decodedValues["NodeId"] == "node1");
+    REQUIRE(decodedData == data);
+
+    // Validate that truncated requests are rejected
+    REQUIRE(!BinaryCodec::decodeRequest((frame.data() + BinaryCodec::FRAME_HEADER_SIZE),
+            (frame.size() - BinaryCodec::FRAME_HEADER_SIZE - 1), method, path, decodedValues, decodedData));
+
+    // Validate that a response decodes to the same values
+    int code = 0;
+    frame = BinaryCodec::encodeResponse(201, {{"Status", "Joined"}}, Payload());
+    REQUIRE(BinaryCodec::decodeResponse((frame.data() + BinaryCodec::FRAME_HEADER_SIZE),
+            (frame.size() - BinaryCodec::FRAME_HEADER_SIZE), code, decodedValues, decodedData));
+    REQUIRE(code == 201);
+    REQUIRE(decodedValues["Status"] == "Joined");
+    REQUIRE(decodedData.isNull());
+}
+
+TEST_CASE ("Binary Transport Servable Test", "[BinaryTransportTest]")
+{
+
+    // Create a servable instance with the binary transport enabled
+    InternalServable internalServer(12370, 12371);
+    internalServer.start();
+
+    // Make a GET request over the binary transport
+    auto response = Requests::makeRequest(
+            Servable::HttpMethod::GET, "bq://localhost:12371/internal/hello", {});
+    REQUIRE(response.code == 200);
+    REQUIRE(response.body.size() == 1);
+    REQUIRE(response.body["message"] == "world");
+    REQUIRE(BinaryClient::getDefaultClient().getIdleConnectionCount("bq://localhost:12371") == 1);
+
+    // Make a GET request with a route-argument over the binary transport
+    response = Requests::makeRequest(
+            Servable::HttpMethod::GET, "bq://localhost:12371/internal/hello/tyler", {});
+    REQUIRE(response.code == 200);
+    REQUIRE(response.body["message"] == "tyler");
+
+    // Make a typed POST request over the binary transport
+    Payload body;
+    body["name"] = "tyler";
+    body["count"] = 41;
+    response = Requests::makeTypedRequest(
+            Servable::HttpMethod::POST, "bq://localhost:12371/internal/hellotyped", body);
+    REQUIRE(response.code == 201);
+    REQUIRE(response.body["name"] == "tyler");
+    REQUIRE(response.data.get("count").getInt() == 42);
+
+    // Validate that the persistent connection was re-used throughout
+    REQUIRE(BinaryClient::getDefaultClient().getIdleConnectionCount("bq://localhost:12371") == 1);
+
+    // Validate that external routes are only served over HTTP
+    response = Requests::makeRequest(
+            Servable::HttpMethod::GET, "bq://localhost:12371/cluster/hello", {});
+    REQUIRE(response.code == 404);
+    response = Requests::makeRequest(
+            Servable::HttpMethod::GET, "http://localhost:12370/cluster/hello", {});
+    REQUIRE(response.code == 200);
+    REQUIRE(response.body["message"] == "world");
+
+    // Validate that internal routes are still served over HTTP
+    response = Requests::makeRequest(
+            Servable::HttpMethod::GET, "http://localhost:12370/internal/hello", {});
+    REQUIRE(response.code == 200);
+    REQUIRE(response.body["message"] == "world");
+}
+
+TEST_CASE ("Unreachable Binary Transport Test", "[BinaryTransportTest]")
+{
+
+    // Validate that an unreachable endpoint fails without hanging
+    auto response = Requests::makeRequest(
+            Servable::HttpMethod::GET, "bq://localhost:12372/internal/hello", {}, 1000);
+    REQUIRE(response.code == 400);
+    REQUIRE(response.body["Status"] == "Error");
+}
+
+TEST_CASE ("Local Transports Servable Test", "[BinaryTransportTest]")
+{
+
+    // Create a servable instance only served over the local transports
+    InternalServable localServer(0, 0);
+    localServer.enableUnixTransport("/tmp/bitquark-local-test.sock");
+    localServer.enableInProcessTransport("local-test");
+    localServer.start();
+
+    // Validate that the routes are served over the Unix domain socket
+    std::string unixUrl = "unix://%2Ftmp%2Fbitquark-local-test.sock";
+    auto response = Requests::makeRequest(Servable::HttpMethod::GET, unixUrl + "/internal/hello/tyler", {});
+    REQUIRE(response.code == 200);
+    REQUIRE(response.body["message"] == "tyler");
+    response = Requests::makeRequest(Servable::HttpMethod::GET, unixUrl + "/cluster/hello", {});
+    REQUIRE(response.code == 200);
+    REQUIRE(response.body["message"] == "world");
+
+    // Validate that the routes are served in-process (including typed bodies)
+    Payload body;
+    body["name"] = "tyler";
+    body["count"] = 41;
+    response = Requests::makeTypedRequest(Servable::HttpMethod::POST, "inproc://local-test/internal/hellotyped", body);
+    REQUIRE(response.code == 201);
+    REQUIRE(response.body["name"] == "tyler");
+    REQUIRE(response.data.get("count").getInt() == 42);
+    response = Requests::makeRequest(Servable::HttpMethod::GET, "inproc://local-test/missing", {});
+    REQUIRE(response.code == 404);
+
+    // Validate that the in-process requests were recorded in the metrics
+    REQUIRE(localServer.getRouteMetrics()->getRequestCount("POST", "/internal/hellotyped") == 1);
+
+    // Validate that the local transports are no longer served once stopped
+    localServer.stop();
+    response = Requests::makeRequest(Servable::HttpMethod::GET, "inproc://local-test/cluster/hello", {}, 1000, 1);
+    REQUIRE(response.code == 400);
+    response = Requests::makeRequest(Servable::HttpMethod::GET, unixUrl + "/cluster/hello", {}, 1000, 1);
+    REQUIRE(response.code == 400);
+}
+
+TEST_CASE ("Benchmark Binary Transport Test", "[BinaryTransportTest][.][benchmark]")
+{
+
+    // Create a servable instance with the binary transport enabled
+    InternalServable internalServer(12373, 12374);
+    internalServer.start();
+
+    // Time sequential heartbeat-sized requests over HTTP
+    const int iterations = 5000;
+    auto startTime = std::chrono::steady_clock::now();
+    for (auto ii = 0; ii < iterations; ii++)
+        Requests::makeRequest(Servable::HttpMethod::GET, "http://localhost:12373/internal/hello", {});
+    auto httpTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+    // Time the same requests over the binary transport
+    startTime = std::chrono::steady_clock::now();
+    for (auto ii = 0; ii < iterations; ii++)
+        Requests::makeRequest(Servable::HttpMethod::GET, "bq://localhost:12374/internal/hello", {});
+    auto binaryTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+    // Report the results
+    std::cout << "Internal messages/s (JSON over HTTP): " << (iterations / httpTime) << std::endl;
+    std::cout << "Internal messages/s (binary transport): " << (iterations / binaryTime) << std::endl;
+    REQUIRE(binaryTime > 0);
+}
+
+#endif //BITQUARK_BINARYTRANSPORT_TEST_HPP
@@ -0,0 +1,86 @@
+/* This file is part of bit-quark.
+ *
+ * Copyright (c) BitBoson
+ *
+ * bit-quark is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bit-quark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bit-quark.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+
+#ifndef BITQUARK_COMPRESSION_TEST_HPP
+#define BITQUARK_COMPRESSION_TEST_HPP
+
+#include <catch.hpp>
+#include <string>
+#include <BitBoson/BitQuark/Networking/Compression.h>
+
+using namespace BitBoson::BitQuark;
+
+TEST_CASE ("Compress and Decompress Compression Test", "[CompressionTest]")
+{
+
+    // Create some (repetitive) data to compress
+    std::string data;
+    for (auto ii = 0; ii < 1000; ii++)
+        data += ("\"URL-" + std::to_string(ii % 10) + "\":\"http://localhost:9996\",");
+
+    // Validate that the data round-trips using each of the encodings
+    for (auto encoding : {Compression::Encoding::GZIP, Compression::Encoding::DEFLATE})
+    {
+        std::string compressed;
+        std::string decompressed;
+        REQUIRE(Compression::compress(data, encoding, compressed));
+        REQUIRE(compressed.size() < data.size());
+        REQUIRE(Compression::decompress(compressed.c_str(), compressed.size(), encoding, decompressed));
+        REQUIRE(decompressed == data);
+
+        // Validate that truncated data and data over the limit are rejected
+        REQUIRE(!Compression::decompress(compressed.c_str(), (compressed.size() / 2), encoding, decompressed));
+        REQUIRE(!Compression::decompress(compressed.c_str(), compressed.size(), encoding, decompressed, 100));
+    }
+
+    // Validate that the identity encoding is never compressed
+    std::string compressed;
+    REQUIRE(!Compression::compress(data, Compression::Encoding::IDENTITY, compressed));
+}
+
+TEST_CASE ("Negotiate Encoding Compression Test", "[CompressionTest]")
+{
+
+    // Validate that gzip is preferred over deflate when both are accepted
+    REQUIRE(Compression::negotiate("gzip, deflate") == Compression::Encoding::GZIP);
+    REQUIRE(Compression::negotiate("deflate, GZIP;q=0.5") == Compression::Encoding::GZIP);
+    REQUIRE(Compression::negotiate("*") == Compression::Encoding::GZIP);
+
+    // Validate that rejected and unknown encodings are not chosen
+    REQUIRE(Compression::negotiate("deflate, gzip;q=0") == Compression::Encoding::DEFLATE);
+    REQUIRE(Compression::negotiate("br, identity") == Compression::Encoding::IDENTITY);
+
+    // Validate that the wildcard never accepts an encoding which was refused
+    REQUIRE(Compression::negotiate("gzip;q=0, *") == Compression::Encoding::DEFLATE);
+    REQUIRE(Compression::negotiate("*, gzip;q=0, deflate;q=0") == Compression::Encoding::IDENTITY);
+    REQUIRE(Compression::negotiate("deflate;q=0, *;q=0.5") == Compression::Encoding::GZIP);
+    REQUIRE(Compression::negotiate("") == Compression::Encoding::IDENTITY);
+
+    // Validate that the encodings map to and from their header values
+    REQUIRE(Compression::getEncoding(Compression::getName(Compression::Encoding::GZIP))
+            == Compression::Encoding::GZIP);
+    REQUIRE(Compression::getEncoding(" Deflate ") == Compression::Encoding::DEFLATE);
+    REQUIRE(Compression::getName(Compression::Encoding::IDENTITY).empty());
+}
+
+#endif //BITQUARK_COMPRESSION_TEST_HPP
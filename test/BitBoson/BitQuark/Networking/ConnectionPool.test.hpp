@@ -0,0 +1,148 @@
+/* This file is part of bit-quark.
+ *
+ * Copyright (c) BitBoson
+ *
+ * bit-quark is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bit-quark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bit-quark.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+#ifndef BITQUARK_CONNECTIONPOOL_TEST_HPP
+#define BITQUARK_CONNECTIONPOOL_TEST_HPP
+
+#include <catch.hpp>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <BitBoson/BitQuark/Networking/ConnectionPool.h>
+
+using namespace BitBoson;
+using namespace BitBoson::BitQuark;
+
+TEST_CASE ("Get Destination Connection Pool Test", "[ConnectionPoolTest]")
+{
+
+    // Validate that URLs are pooled by their scheme, host and port
+    REQUIRE(ConnectionPool::getDestination("http://localhost:12345/hello") == "http://localhost:12345");
+    REQUIRE(ConnectionPool::getDestination("http://localhost:12345/hello/world") == "http://localhost:12345");
+    REQUIRE(ConnectionPool::getDestination("http://localhost:12345") == "http://localhost:12345");
+    REQUIRE(ConnectionPool::getDestination("localhost:12345/hello") == "localhost:12345");
+}
+
+TEST_CASE ("Re-Use Released Session Connection Pool Test", "[ConnectionPoolTest]")
+{
+
+    // Create a connection pool
+    ConnectionPool pool(2);
+
+    // Acquire a session and validate it is tracked as in-use
+    auto session = pool.acquire("http://localhost:12345/hello");
+    REQUIRE(session != nullptr);
+    REQUIRE(pool.getActiveSessionCount("http://localhost:12345") == 1);
+    REQUIRE(pool.getIdleSessionCount("http://localhost:12345") == 0);
+
+    // Release the session and validate it is kept idle
+    pool.release("http://localhost:12345/hello", session);
+    REQUIRE(pool.getActiveSessionCount("http://localhost:12345") == 0);
+    REQUIRE(pool.getIdleSessionCount("http://localhost:12345") == 1);
+
+    // Validate that the same session is re-used for the same host
+    auto session2 = pool.acquire("http://localhost:12345/world");
+    REQUIRE(session2 == session);
+    REQUIRE(pool.getIdleSessionCount("http://localhost:12345") == 0);
+
+    // Validate that a different host gets a different session
+    auto session3 = pool.acquire("http://localhost:12346/hello");
+    REQUIRE(session3 != session2);
+
+    // Release the sessions and validate an unhealthy one is dropped
+    pool.release("http://localhost:12345/world", session2, false);
+    pool.release("http://localhost:12346/hello", session3);
+    REQUIRE(pool.getIdleSessionCount("http://localhost:12345") == 0);
+    REQUIRE(pool.getIdleSessionCount("http://localhost:12346") == 1);
+}
+
+TEST_CASE ("Per-Host Limit Connection Pool Test", "[ConnectionPoolTest]")
+{
+
+    // Create a connection pool with only a single connection per host
+    ConnectionPool pool(1);
+
+    // Acquire the only pooled session for the host
+    auto session = pool.acquire("http://localhost:12345/hello");
+    REQUIRE(pool.getActiveSessionCount("http://localhost:12345") == 1);
+
+    // Validate that another acquire times-out into an un-pooled session
+    auto session2 = pool.acquire("http://localhost:12345/hello", 50);
+    REQUIRE(session2 != nullptr);
+    REQUIRE(session2 != session);
+    REQUIRE(pool.getActiveSessionCount("http://localhost:12345") == 1);
+
+    // Releasing the un-pooled session should not affect the pool
+    pool.release("http://localhost:12345/hello", session2);
+    REQUIRE(pool.getActiveSessionCount("http://localhost:12345") == 1);
+    REQUIRE(pool.getIdleSessionCount("http://localhost:12345") == 0);
+
+    // Validate that a waiting acquire gets the session once it is released
+    std::thread releaseThread([&pool, session]()
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        pool.release("http://localhost:12345/hello", session);
+    });
+    auto session3 = pool.acquire("http://localhost:12345/hello", 5000);
+    releaseThread.join();
+    REQUIRE(session3 == session);
+    REQUIRE(pool.getActiveSessionCount("http://localhost:12345") == 1);
+}
+
+TEST_CASE ("Bounded Acquire Wait Connection Pool Test", "[ConnectionPoolTest]")
+{
+
+    // Create a connection pool with a single connection and a short acquire timeout
+    ConnectionPool pool(1, 15000, 50);
+    REQUIRE(pool.getAcquireTimeout() == 50);
+
+    // Acquire the only pooled session for the host
+    auto session = pool.acquire("http://localhost:12345/hello");
+
+    // Validate that a long request timeout only waits for the acquire timeout
+    auto startTime = std::chrono::steady_clock::now();
+    auto session2 = pool.acquire("http://localhost:12345/hello", 10000);
+    auto waitedMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - startTime).count();
+    REQUIRE(session2 != nullptr);
+    REQUIRE(session2 != session);
+    REQUIRE(waitedMs < 5000);
+    REQUIRE(pool.getActiveSessionCount("http://localhost:12345") == 1);
+}
+
+TEST_CASE ("Evict Idle Sessions Connection Pool Test", "[ConnectionPoolTest]")
+{
+
+    // Create a connection pool with a short idle-timeout
+    ConnectionPool pool(2, 50);
+
+    // Acquire and release a session so that it is idle
+    auto session = pool.acquire("http://localhost:12345/hello");
+    pool.release("http://localhost:12345/hello", session);
+    REQUIRE(pool.getIdleSessionCount("http://localhost:12345") == 1);
+
+    // Validate that the idle session is evicted after the timeout
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    pool.evictIdleSessions();
+    REQUIRE(pool.getIdleSessionCount("http://localhost:12345") == 0);
+}
+
+#endif //BITQUARK_CONNECTIONPOOL_TEST_HPP
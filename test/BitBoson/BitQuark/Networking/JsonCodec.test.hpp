@@ -0,0 +1,194 @@
+/* This file is part of bit-quark.
+ *
+ * Copyright (c) BitBoson
+ *
+ * bit-quark is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bit-quark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bit-quark.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#ifndef BITQUARK_JSONCODEC_TEST_HPP
+#define BITQUARK_JSONCODEC_TEST_HPP
+
+#include <catch.hpp>
+#include <chrono>
+#include <string>
+#include <iostream>
+#include <unordered_map>
+#include <rapidjson/document.h>
+#include <BitBoson/StandardModel/Crypto/Crypto.h>
+#include <BitBoson/BitQuark/Networking/Payload.h>
+#include <BitBoson/BitQuark/Networking/JsonCodec.h>
+
+using namespace BitBoson;
+using namespace BitBoson::BitQuark;
+
+TEST_CASE ("Encode and Decode JSON Codec Test", "[JsonCodecTest]")
+{
+
+    // Create some values to encode
+    std::unordered_map<std::string, std::string> values;
+    values["message"] = "world";
+    values["name"] = "tyler";
+    values["empty"] = "";
+
+    // Encode and then decode the values
+    auto jsonString = JsonCodec::encode(values);
+    std::unordered_map<std::string, std::string> decodedValues;
+    REQUIRE(JsonCodec::decode(jsonString, decodedValues));
+    REQUIRE(decodedValues == values);
+
+    // Validate that an empty map is encoded as an empty string
+    REQUIRE(JsonCodec::encode({}).empty());
+}
+
+TEST_CASE ("Escaped Values JSON Codec Test", "[JsonCodecTest]")
+{
+
+    // Create some values which need to be escaped
+    std::unordered_map<std::string, std::string> values;
+    values["quote\"key"] = "a \"quoted\" value";
+    values["slashes"] = "back\\slash and /forward";
+    values["control"] = "new\nline\ttab";
+
+    // Validate that the encoded string is valid JSON which round-trips
+    auto jsonString = JsonCodec::encode(values);
+    REQUIRE(jsonString.find('\n') == std::string::npos);
+    std::unordered_map<std::string, std::string> decodedValues;
+    REQUIRE(JsonCodec::decode(jsonString, decodedValues));
+    REQUIRE(decodedValues == values);
+}
+
+TEST_CASE ("Skip Non-String Members JSON Codec Test", "[JsonCodecTest]")
+{
+
+    // Decode an object with non-string and nested members
+    std::unordered_map<std::string, std::string> values;
+    REQUIRE(JsonCodec::decode("{\"a\":\"1\",\"b\":2,\"c\":[\"x\",{\"y\":\"z\"}],"
+            "\"d\":{\"e\":\"f\"},\"g\":null,\"h\":true,\"i\":\"2\"}", values));
+
+    // Validate that only the top-level string members were kept
+    REQUIRE(values.size() == 2);
+    REQUIRE(values["a"] == "1");
+    REQUIRE(values["i"] == "2");
+}
+
+TEST_CASE ("Invalid JSON Codec Test", "[JsonCodecTest]")
+{
+
+    // Validate that invalid or non-object JSON is rejected
+    std::unordered_map<std::string, std::string> values;
+    REQUIRE(!JsonCodec::decode("", values));
+    REQUIRE(!JsonCodec::decode("ThisIsAnInvalidJsonBodyString", values));
+    REQUIRE(!JsonCodec::decode("{\"a\":\"1\"", values));
+    REQUIRE(!JsonCodec::decode("[\"a\",\"b\"]", values));
+    REQUIRE(!JsonCodec::decode("\"a\"", values));
+    REQUIRE(!JsonCodec::decode("{\"a\":\"1\"} trailing", values));
+}
+
+TEST_CASE ("Typed Payload JSON Codec Test", "[JsonCodecTest]")
+{
+
+    // Create a typed payload with nested values
+    Payload payload;
+    payload["name"] = "tyler";
+    payload["count"] = 42;
+    payload["ratio"] = 0.5;
+    payload["enabled"] = true;
+    payload["nothing"] = Payload();
+    payload["list"].push(1);
+    payload["list"].push("two");
+    payload["nested"]["inner"] = -7;
+
+    // Validate that the payload round-trips
+    auto jsonString = JsonCodec::encodePayload(payload);
+    Payload decodedPayload;
+    REQUIRE(JsonCodec::decode(jsonString.c_str(), jsonString.size(), decodedPayload));
+    REQUIRE(decodedPayload == payload);
+    REQUIRE(decodedPayload.get("count").getInt() == 42);
+    REQUIRE(decodedPayload.get("list").at(1).getString() == "two");
+    REQUIRE(decodedPayload.get("nested").get("inner").getInt() == -7);
+}
+
+TEST_CASE ("Split Strings and Typed Members JSON Codec Test", "[JsonCodecTest]")
+{
+
+    // Encode string values alongside typed members
+    Payload data;
+    data["count"] = 3;
+    data["members"].push("a");
+    auto jsonString = JsonCodec::encode(
+            std::unordered_map<std::string, std::string>{{"message", "world"}}, data);
+
+    // Validate that the strings and typed members are split when decoding
+    std::unordered_map<std::string, std::string> values;
+    Payload typedValues;
+    REQUIRE(JsonCodec::decode(jsonString.c_str(), jsonString.size(), values, typedValues));
+    REQUIRE(values.size() == 1);
+    REQUIRE(values["message"] == "world");
+    REQUIRE(typedValues.size() == 2);
+    REQUIRE(typedValues.get("count").getInt() == 3);
+    REQUIRE(typedValues.get("members").at(0).getString() == "a");
+
+    // Validate that non-object JSON is rejected when splitting
+    REQUIRE(!JsonCodec::decode("[1,2]", 5, values, typedValues));
+}
+
+TEST_CASE ("Benchmark JSON Codec Test", "[JsonCodecTest][.][benchmark]")
+{
+
+    // Create a representative (status-like) body to encode and decode
+    std::unordered_map<std::string, std::string> values;
+    for (auto ii = 0; ii < 64; ii++)
+        values["URL-" + StandardModel::Crypto::sha256(std::to_string(ii))]
+                = "http://localhost:" + std::to_string(10000 + ii);
+
+    // Time the previous string-concatenation encoding and DOM decoding
+    const int iterations = 20000;
+    auto startTime = std::chrono::steady_clock::now();
+    for (auto ii = 0; ii < iterations; ii++)
+    {
+        std::string jsonString;
+        for (const auto& value : values)
+            jsonString += "\"" + value.first + "\":\"" + value.second + "\",";
+        jsonString = jsonString.substr(0, jsonString.size() - 1);
+        jsonString = "{" + jsonString + "}";
+        rapidjson::Document jsonDoc;
+        jsonDoc.Parse(jsonString.c_str());
+        std::unordered_map<std::string, std::string> decodedValues;
+        for (rapidjson::Value::ConstMemberIterator itr = jsonDoc.MemberBegin(); itr != jsonDoc.MemberEnd(); ++itr)
+            if (jsonDoc[itr->name.GetString()].IsString())
+                decodedValues[itr->name.GetString()] = jsonDoc[itr->name.GetString()].GetString();
+    }
+    auto legacyTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+    // Time the codec's encoding and SAX decoding
+    startTime = std::chrono::steady_clock::now();
+    for (auto ii = 0; ii < iterations; ii++)
+    {
+        auto jsonString = JsonCodec::encode(values);
+        std::unordered_map<std::string, std::string> decodedValues;
+        JsonCodec::decode(jsonString, decodedValues);
+    }
+    auto codecTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+    // Report the results
+    std::cout << "JSON round-trips/s (concatenation + DOM): " << (iterations / legacyTime) << std::endl;
+    std::cout << "JSON round-trips/s (JsonCodec): " << (iterations / codecTime) << std::endl;
+    REQUIRE(codecTime > 0);
+}
+
+#endif //BITQUARK_JSONCODEC_TEST_HPP
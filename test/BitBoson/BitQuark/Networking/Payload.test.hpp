@@ -0,0 +1,87 @@
+/* This file is part of bit-quark.
+ *
+ * Copyright (c) BitBoson
+ *
+ * bit-quark is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bit-quark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bit-quark.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#ifndef BITQUARK_PAYLOAD_TEST_HPP
+#define BITQUARK_PAYLOAD_TEST_HPP
+
+#include <catch.hpp>
+#include <string>
+#include <BitBoson/BitQuark/Networking/Payload.h>
+
+using namespace BitBoson;
+using namespace BitBoson::BitQuark;
+
+TEST_CASE ("Scalar Values Payload Test", "[PayloadTest]")
+{
+
+    // Validate each of the scalar types
+    REQUIRE(Payload().isNull());
+    REQUIRE(Payload(true).getBool());
+    REQUIRE(Payload(42).getInt() == 42);
+    REQUIRE(Payload(42).getDouble() == 42.0);
+    REQUIRE(Payload(1.5).getDouble() == 1.5);
+    REQUIRE(Payload(1.5).getInt() == 1);
+    REQUIRE(Payload("text").getString() == "text");
+    REQUIRE(Payload(std::string("text")).getType() == Payload::Type::STRING);
+
+    // Validate that mismatched types return the defaults
+    REQUIRE(Payload("text").getInt(-1) == -1);
+    REQUIRE(Payload(42).getString("default") == "default");
+    REQUIRE(!Payload(1).getBool());
+}
+
+TEST_CASE ("Array and Object Payload Test", "[PayloadTest]")
+{
+
+    // Build an array and validate its items
+    Payload items;
+    items.push(1);
+    items.push("two");
+    REQUIRE(items.getType() == Payload::Type::ARRAY);
+    REQUIRE(items.size() == 2);
+    REQUIRE(items.at(0).getInt() == 1);
+    REQUIRE(items.at(1).getString() == "two");
+    REQUIRE(items.at(5).isNull());
+
+    // Build an object and validate its members
+    Payload object;
+    object["a"] = 1;
+    object["b"]["c"] = "d";
+    object["a"] = 2;
+    REQUIRE(object.getType() == Payload::Type::OBJECT);
+    REQUIRE(object.size() == 2);
+    REQUIRE(object.has("a"));
+    REQUIRE(!object.has("z"));
+    REQUIRE(object.get("a").getInt() == 2);
+    REQUIRE(object.get("b").get("c").getString() == "d");
+    REQUIRE(object.get("z").isNull());
+
+    // Validate the equality of (nested) values
+    Payload otherObject;
+    otherObject["a"] = 2;
+    otherObject["b"]["c"] = "d";
+    REQUIRE(object == otherObject);
+    otherObject["b"]["c"] = "e";
+    REQUIRE(object != otherObject);
+}
+
+#endif //BITQUARK_PAYLOAD_TEST_HPP
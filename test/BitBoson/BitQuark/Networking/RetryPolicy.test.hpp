@@ -0,0 +1,107 @@
+/* This file is part of bit-quark.
+ *
+ * Copyright (c) BitBoson
+ *
+ * bit-quark is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bit-quark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bit-quark.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#ifndef BITQUARK_RETRYPOLICY_TEST_HPP
+#define BITQUARK_RETRYPOLICY_TEST_HPP
+
+#include <catch.hpp>
+#include <chrono>
+#include <BitBoson/BitQuark/Networking/Requests.h>
+#include <BitBoson/BitQuark/Networking/RetryPolicy.h>
+
+using namespace BitBoson;
+using namespace BitBoson::BitQuark;
+
+TEST_CASE ("Back-Off Bounds Retry Policy Test", "[RetryPolicyTest]")
+{
+
+    // Create a retry policy with a known back-off progression
+    RetryPolicy retryPolicy(5, 10000, 100, 400, 2.0);
+    REQUIRE(retryPolicy.getMaxAttempts() == 5);
+    REQUIRE(retryPolicy.getDeadline() == 10000);
+
+    // Validate that the jittered back-off stays within the exponential ceiling
+    for (auto ii = 0; ii < 100; ii++)
+    {
+        REQUIRE(retryPolicy.getBackoff(1) <= 100);
+        REQUIRE(retryPolicy.getBackoff(2) <= 200);
+        REQUIRE(retryPolicy.getBackoff(3) <= 400);
+        REQUIRE(retryPolicy.getBackoff(10) <= 400);
+        REQUIRE(retryPolicy.getBackoff(10) >= 0);
+    }
+
+    // Validate that invalid values are corrected
+    RetryPolicy badRetryPolicy(-1, -1);
+    REQUIRE(badRetryPolicy.getMaxAttempts() == 1);
+    REQUIRE(badRetryPolicy.getDeadline() == 1);
+}
+
+TEST_CASE ("Retryable Failures Retry Policy Test", "[RetryPolicyTest]")
+{
+
+    // Create a default retry policy
+    RetryPolicy retryPolicy;
+
+    // Validate that transient failures are retryable
+    REQUIRE(retryPolicy.isRetryable(0, true));
+    REQUIRE(retryPolicy.isRetryable(408, false));
+    REQUIRE(retryPolicy.isRetryable(429, false));
+    REQUIRE(retryPolicy.isRetryable(500, false));
+    REQUIRE(retryPolicy.isRetryable(503, false));
+
+    // Validate that other client errors are not retryable
+    REQUIRE(!retryPolicy.isRetryable(400, false));
+    REQUIRE(!retryPolicy.isRetryable(404, false));
+}
+
+TEST_CASE ("Retry Unreachable Endpoint Retry Policy Test", "[RetryPolicyTest]")
+{
+
+    // Make a request to an endpoint which is not running
+    auto retryCount = Requests::getRetryCount();
+    auto response = Requests::makeRequest(Servable::HttpMethod::GET,
+            "http://localhost:12360/hello", {}, RetryPolicy(3, 5000, 10, 20), 1000);
+
+    // Validate that the request failed after retrying twice
+    REQUIRE(response.code >= 300);
+    REQUIRE(Requests::getRetryCount() == (retryCount + 2));
+}
+
+TEST_CASE ("Retry Deadline Budget Retry Policy Test", "[RetryPolicyTest]")
+{
+
+    // Make a request to an endpoint which is not running with a
+    // large number of attempts but only a small deadline budget
+    auto deadlineCount = Requests::getDeadlineExceededCount();
+    auto startTime = std::chrono::steady_clock::now();
+    auto response = Requests::makeRequest(Servable::HttpMethod::GET,
+            "http://localhost:12360/hello", {}, RetryPolicy(1000, 200, 50, 50), 1000);
+    auto elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - startTime).count();
+
+    // Validate that the deadline stopped the retries
+    REQUIRE(response.code >= 300);
+    REQUIRE(elapsedMs < 1000);
+    REQUIRE(Requests::getDeadlineExceededCount() == (deadlineCount + 1));
+}
+
+#endif //BITQUARK_RETRYPOLICY_TEST_HPP
@@ -0,0 +1,157 @@
+/* This file is part of bit-quark.
+ *
+ * Copyright (c) BitBoson
+ *
+ * bit-quark is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bit-quark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bit-quark.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+
+#ifndef BITQUARK_ROUTETABLE_TEST_HPP
+#define BITQUARK_ROUTETABLE_TEST_HPP
+
+#include <catch.hpp>
+#include <regex>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <utility>
+#include <iostream>
+#include <string_view>
+#include <BitBoson/BitQuark/Networking/Servable.h>
+#include <BitBoson/BitQuark/Networking/RouteTable.h>
+
+using namespace BitBoson::BitQuark;
+
+TEST_CASE ("Exact and Argument Routes Route Table Test", "[RouteTableTest]")
+{
+
+    // Create a route table with the cluster's routes
+    RouteTable routeTable;
+    routeTable.addRoute(Servable::HttpMethod::GET, "/internal/master/status", false, 0);
+    routeTable.addRoute(Servable::HttpMethod::GET, "/internal/master/status", true, 1);
+    routeTable.addRoute(Servable::HttpMethod::POST, "/internal/master/join", false, 2);
+    routeTable.addRoute(Servable::HttpMethod::POST, "/internal/master/resources", true, 3);
+    routeTable.addRoute(Servable::HttpMethod::GET, "/cluster/status", false, 4);
+    routeTable.addRoute(Servable::HttpMethod::GET, "/", false, 5);
+    routeTable.compile();
+    REQUIRE(routeTable.getRouteCount() == 6);
+
+    // Validate that exact routes are preferred over argument routes
+    unsigned long handlerIndex = 0;
+    std::string_view argument;
+    REQUIRE(routeTable.find(Servable::HttpMethod::GET, "/internal/master/status", handlerIndex, argument));
+    REQUIRE(handlerIndex == 0);
+    REQUIRE(argument.empty());
+    REQUIRE(routeTable.find(Servable::HttpMethod::GET, "/", handlerIndex, argument));
+    REQUIRE(handlerIndex == 5);
+
+    // Validate that argument routes capture the rest of the path
+    REQUIRE(routeTable.find(Servable::HttpMethod::GET, "/internal/master/status/worker1", handlerIndex, argument));
+    REQUIRE(handlerIndex == 1);
+    REQUIRE(argument == "worker1");
+    REQUIRE(routeTable.find(Servable::HttpMethod::POST, "/internal/master/resources/a/b", handlerIndex, argument));
+    REQUIRE(handlerIndex == 3);
+    REQUIRE(argument == "a/b");
+
+    // Validate that routes only match their own method and full path
+    REQUIRE(!routeTable.find(Servable::HttpMethod::POST, "/cluster/status", handlerIndex, argument));
+    REQUIRE(!routeTable.find(Servable::HttpMethod::GET, "/cluster", handlerIndex, argument));
+    REQUIRE(!routeTable.find(Servable::HttpMethod::GET, "/cluster/status/extra", handlerIndex, argument));
+    REQUIRE(!routeTable.find(Servable::HttpMethod::POST, "/internal/master/resources", handlerIndex, argument));
+    REQUIRE(!routeTable.find(Servable::HttpMethod::GET, "cluster/status", handlerIndex, argument));
+    REQUIRE(!routeTable.find(-1, "/cluster/status", handlerIndex, argument));
+}
+
+TEST_CASE ("Uncompiled Routes Route Table Test", "[RouteTableTest]")
+{
+
+    // Validate that routes are only found once compiled
+    RouteTable routeTable;
+    unsigned long handlerIndex = 0;
+    std::string_view argument;
+    routeTable.addRoute(Servable::HttpMethod::GET, "/hello", false, 0);
+    REQUIRE(!routeTable.find(Servable::HttpMethod::GET, "/hello", handlerIndex, argument));
+    routeTable.compile();
+    REQUIRE(routeTable.find(Servable::HttpMethod::GET, "/hello", handlerIndex, argument));
+}
+
+TEST_CASE ("Benchmark Route Table Test", "[RouteTableTest][.][benchmark]")
+{
+
+    // Setup the routes added by the master, worker and resource manager nodes
+    std::vector<std::pair<std::string, bool>> routes = {
+            {"/internal/master/status", false}, {"/internal/master/status", true},
+            {"/internal/master/join", false}, {"/internal/master/leave", false},
+            {"/cluster/status", false}, {"/internal/worker/status", false},
+            {"/internal/worker/join", false}, {"/internal/master/resources", true}};
+    std::vector<std::string> paths = {"/internal/master/status", "/internal/master/status/worker1",
+            "/cluster/status", "/internal/master/resources/resource1", "/internal/worker/join"};
+
+    // Time the dispatch as more (application) routes are added
+    const int iterations = 200000;
+    for (auto extraRoutes : {0, 16, 64})
+    {
+
+        // Setup both the route table and the per-route regular expressions
+        // (as previously matched for each resource)
+        auto allRoutes = routes;
+        for (auto ii = 0; ii < extraRoutes; ii++)
+            allRoutes.emplace_back(("/app/route" + std::to_string(ii)), ((ii % 2) == 0));
+        RouteTable routeTable;
+        std::vector<std::regex> routeExpressions;
+        for (unsigned long ii = 0; ii < allRoutes.size(); ii++)
+        {
+            routeTable.addRoute(Servable::HttpMethod::GET, allRoutes[ii].first, allRoutes[ii].second, ii);
+            routeExpressions.emplace_back(allRoutes[ii].first + (allRoutes[ii].second ? "/(.*)" : ""));
+        }
+        routeTable.compile();
+
+        // Time the regular expression matching
+        unsigned long matches = 0;
+        auto startTime = std::chrono::steady_clock::now();
+        for (auto ii = 0; ii < (iterations / 100); ii++)
+            for (const auto& path : paths)
+                for (const auto& routeExpression : routeExpressions)
+                    if (std::regex_match(path, routeExpression))
+                    {
+                        matches++;
+                        break;
+                    }
+        auto regexTime = (std::chrono::duration<double>(
+                std::chrono::steady_clock::now() - startTime).count() * 100);
+
+        // Time the route table look-ups
+        unsigned long handlerIndex = 0;
+        std::string_view argument;
+        startTime = std::chrono::steady_clock::now();
+        for (auto ii = 0; ii < iterations; ii++)
+            for (const auto& path : paths)
+                matches += routeTable.find(Servable::HttpMethod::GET, path, handlerIndex, argument);
+        auto tableTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+        // Report the results
+        auto lookups = ((double) iterations * paths.size());
+        std::cout << "Dispatch ns/request with " << allRoutes.size() << " routes (regex): "
+                << ((regexTime / lookups) * 1e9) << std::endl;
+        std::cout << "Dispatch ns/request with " << allRoutes.size() << " routes (route table): "
+                << ((tableTime / lookups) * 1e9) << std::endl;
+        REQUIRE(matches > 0);
+    }
+}
+
+#endif //BITQUARK_ROUTETABLE_TEST_HPP
@@ -0,0 +1,190 @@
+/* This file is part of bit-quark.
+ *
+ * Copyright (c) BitBoson
+ *
+ * bit-quark is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bit-quark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bit-quark.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+
+#ifndef BITQUARK_SERVABLELOAD_TEST_HPP
+#define BITQUARK_SERVABLELOAD_TEST_HPP
+
+#include <catch.hpp>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+#include <iostream>
+#include <algorithm>
+#include <functional>
+#include <unordered_map>
+#include <BitBoson/BitQuark/Networking/Servable.h>
+#include <BitBoson/BitQuark/Networking/Requests.h>
+
+using namespace BitBoson;
+using namespace BitBoson::BitQuark;
+
+class LoadServable : public Servable
+{
+    public:
+        LoadServable(int port, std::function<ResponseObj(std::unordered_map<std::string,
+                std::string>&)> handlerFunction) : Servable(port)
+        {
+
+            // Setup the GET and POST load listeners using the given handler
+            for (auto method : {HttpMethod::GET, HttpMethod::POST})
+                addListener(method, "/load", "",
+                    [handlerFunction](std::unordered_map<std::string, std::string>& headers,
+                        std::unordered_map<std::string, std::string>& body,
+                        const std::string& routeArg) -> ResponseObj
+                    {
+                        return handlerFunction(body);
+                    });
+        }
+
+        /**
+         * Destructor used to cleanup the instance
+         */
+        virtual ~LoadServable()
+        {
+            stop();
+        }
+};
+
+struct ServableLoadResult
+{
+    unsigned long requests;
+    unsigned long failures;
+    double requestsPerSecond;
+    double p50Millis;
+    double p99Millis;
+    double p999Millis;
+};
+
+/**
+ * Function used to drive the given endpoint with concurrent (keep-alive) clients
+ * making back-to-back requests and to summarize the throughput and latencies
+ *
+ * @param method Servable HTTP Method indicating the method to use
+ * @param url String representing the URL/URI to make the requests on
+ * @param body Unordered String-String map representing the request body
+ * @param clients Integer representing the number of concurrent clients
+ * @param requestsPerClient Integer representing the number of requests per client
+ * @return Servable Load Result representing the throughput and latencies
+ */
+static ServableLoadResult runServableLoad(Servable::HttpMethod method, const std::string& url,
+        const std::unordered_map<std::string, std::string>& body, int clients, int requestsPerClient)
+{
+
+    // Have each client record the latency of each of its requests
+    std::atomic<unsigned long> failures(0);
+    std::vector<std::vector<double>> clientLatencies(clients);
+    std::vector<std::thread> clientThreads;
+    auto startTime = std::chrono::steady_clock::now();
+    for (auto ii = 0; ii < clients; ii++)
+        clientThreads.emplace_back(
+            [&, ii]()
+            {
+                clientLatencies[ii].reserve(requestsPerClient);
+                for (auto jj = 0; jj < requestsPerClient; jj++)
+                {
+                    auto requestStart = std::chrono::steady_clock::now();
+                    auto response = Requests::makeRequest(method, url, body, 10000, 1);
+                    clientLatencies[ii].push_back(std::chrono::duration<double, std::milli>(
+                            std::chrono::steady_clock::now() - requestStart).count());
+                    if ((response.code < 200) || (response.code >= 300))
+                        failures++;
+                }
+            });
+    for (auto& clientThread : clientThreads)
+        clientThread.join();
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+    // Summarize the (sorted) latencies of all of the requests
+    std::vector<double> latencies;
+    for (const auto& latenciesForClient : clientLatencies)
+        latencies.insert(latencies.end(), latenciesForClient.begin(), latenciesForClient.end());
+    std::sort(latencies.begin(), latencies.end());
+    auto percentile = [&latencies](double percent) -> double
+    {
+        if (latencies.empty())
+            return 0;
+        auto index = (unsigned long) ((percent / 100.0) * (latencies.size() - 1));
+        return latencies[index];
+    };
+    return ServableLoadResult{latencies.size(), failures.load(),
+            (elapsed > 0 ? (latencies.size() / elapsed) : 0),
+            percentile(50), percentile(99), percentile(99.9)};
+}
+
+TEST_CASE ("Load Harness Servable Test", "[ServableLoadTest]")
+{
+
+    // Create a servable echoing the request body
+    LoadServable loadServer(12380,
+        [](std::unordered_map<std::string, std::string>& body) -> Servable::ResponseObj
+        {
+            return Servable::ResponseObj{200, body};
+        });
+    loadServer.start();
+
+    // Validate that a small load is summarized in order
+    auto result = runServableLoad(Servable::HttpMethod::POST, "http://localhost:12380/load",
+            {{"payload", "hello"}}, 2, 10);
+    REQUIRE(result.requests == 20);
+    REQUIRE(result.failures == 0);
+    REQUIRE(result.requestsPerSecond > 0);
+    REQUIRE(result.p50Millis <= result.p99Millis);
+    REQUIRE(result.p99Millis <= result.p999Millis);
+}
+
+TEST_CASE ("Benchmark Servable Load Test", "[ServableLoadTest][.][benchmark]")
+{
+
+    // Drive the servable with various worker-thread counts, client
+    // counts and body sizes, reporting the throughput and latencies
+    const int requestsPerClient = 500;
+    for (auto workerThreads : {0, 1})
+    {
+
+        // Create a servable echoing the request body
+        LoadServable loadServer(12381,
+            [](std::unordered_map<std::string, std::string>& body) -> Servable::ResponseObj
+            {
+                return Servable::ResponseObj{200, body};
+            });
+        loadServer.start(workerThreads);
+
+        // Run the load for each of the configurations
+        for (auto clients : {1, 8, 32})
+            for (auto bodySize : {16, 1024, 16 * 1024})
+            {
+                auto result = runServableLoad(Servable::HttpMethod::POST, "http://localhost:12381/load",
+                        {{"payload", std::string(bodySize, 'a')}}, clients, requestsPerClient);
+                std::cout << "Servable load (workers=" << (workerThreads == 0 ? "default" : std::to_string(workerThreads))
+                        << ", clients=" << clients << ", body=" << bodySize << "B): "
+                        << result.requestsPerSecond << " req/s, p50=" << result.p50Millis
+                        << "ms, p99=" << result.p99Millis << "ms, p999=" << result.p999Millis
+                        << "ms, failures=" << result.failures << std::endl;
+                REQUIRE(result.requests == (unsigned long) (clients * requestsPerClient));
+            }
+    }
+}
+
+#endif //BITQUARK_SERVABLELOAD_TEST_HPP
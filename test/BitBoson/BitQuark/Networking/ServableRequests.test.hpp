@@ -23,12 +23,24 @@
 #define BITQUARK_SERVABLEREQUESTS_TEST_HPP
 
 #include <catch.hpp>
+#include <atomic>
+#include <chrono>
+#include <future>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include <stdexcept>
 #include <cpr/cpr.h>
 #include <unordered_map>
 #include <BitBoson/StandardModel/Crypto/Crypto.h>
 #include <BitBoson/BitQuark/Networking/Servable.h>
 #include <BitBoson/BitQuark/Networking/Requests.h>
+#include <BitBoson/BitQuark/Networking/Compression.h>
+#include <BitBoson/BitQuark/Networking/ConnectionPool.h>
+#include <BitBoson/BitQuark/Networking/RequestDispatcher.h>
+#include <BitBoson/BitQuark/Networking/RouteMetrics.h>
+#include <BitBoson/BitQuark/Networking/AdmissionController.h>
 
 using namespace BitBoson;
 using namespace BitBoson::BitQuark;
@@ -74,6 +86,50 @@ class HelloServable : public Servable
                 {
                     return this->handlePostHello(headers, body, routeArg);
                 });
+
+            // Setup the slow (simulated work) GET listener
+            addListener(HttpMethod::GET, "/helloslow", "",
+                [this](std::unordered_map<std::string, std::string>& headers,
+                    std::unordered_map<std::string, std::string>& body,
+                    const std::string& routeArg) -> ResponseObj
+                {
+                    return this->handleGetSlowHello(headers, body, routeArg);
+                });
+
+            // Setup the failing GET listener
+            addListener(HttpMethod::GET, "/hellothrow", "",
+                [this](std::unordered_map<std::string, std::string>& headers,
+                    std::unordered_map<std::string, std::string>& body,
+                    const std::string& routeArg) -> ResponseObj
+                {
+                    return this->handleGetThrowHello(headers, body, routeArg);
+                });
+
+            // Setup the streaming POST listener (with a 4 MiB limit)
+            addStreamingListener(HttpMethod::POST, "/hellostream", "",
+                [this](std::unordered_map<std::string, std::string>& headers,
+                    const std::string& routeArg) -> StreamObj
+                {
+                    return this->handleStreamHello(headers, routeArg);
+                }, (4 * 1024 * 1024));
+
+            // Setup the typed POST listener
+            addTypedListener(HttpMethod::POST, "/hellotyped", "",
+                [this](std::unordered_map<std::string, std::string>& headers,
+                    Payload& body, const std::string& routeArg) -> ResponseObj
+                {
+                    return this->handlePostTypedHello(headers, body, routeArg);
+                });
+        }
+
+        /**
+         * Function used to get the number of requests handled by the slow route
+         *
+         * @return Long representing the number of slow requests handled
+         */
+        long getSlowRequestCount() const
+        {
+            return _slowRequests.load();
         }
 
         /**
@@ -82,11 +138,20 @@ class HelloServable : public Servable
         virtual ~HelloServable() = default;
 
     private:
+        std::atomic<long> _slowRequests{0};
         ResponseObj handleGetHello(std::unordered_map<std::string, std::string>& headers,
             std::unordered_map<std::string, std::string>& body, const std::string& routeArg)
         {
             return ResponseObj{200, {{"message", "world"}}};
         }
+        ResponseObj handlePostTypedHello(std::unordered_map<std::string, std::string>& headers,
+            Payload& body, const std::string& routeArg)
+        {
+            ResponseObj response{200, {{"name", body.get("name").getString()}}};
+            response.data["total"] = (body.get("count").getInt() * (long) body.get("items").size());
+            response.data["nested"]["enabled"] = body.get("nested").get("enabled").getBool();
+            return response;
+        }
         ResponseObj handleGetHeadersHello(std::unordered_map<std::string, std::string>& headers,
             std::unordered_map<std::string, std::string>& body, const std::string& routeArg)
         {
@@ -102,8 +167,86 @@ class HelloServable : public Servable
         {
             return ResponseObj{201, {{"message", "world"}, {"name", body["name"]}}};
         }
+        ResponseObj handleGetSlowHello(std::unordered_map<std::string, std::string>& headers,
+            std::unordered_map<std::string, std::string>& body, const std::string& routeArg)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            _slowRequests++;
+            return ResponseObj{200, {{"message", "world"}}};
+        }
+        ResponseObj handleGetThrowHello(std::unordered_map<std::string, std::string>& headers,
+            std::unordered_map<std::string, std::string>& body, const std::string& routeArg)
+        {
+            throw std::runtime_error("Handler Failed");
+        }
+        StreamObj handleStreamHello(std::unordered_map<std::string, std::string>& headers,
+            const std::string& routeArg)
+        {
+            auto bytes = std::make_shared<long>(0);
+            auto chunks = std::make_shared<long>(0);
+            auto valid = std::make_shared<bool>(true);
+            return StreamObj{
+                [bytes, chunks, valid](std::string_view chunk) -> bool
+                {
+                    for (auto ii = 0UL; ii < chunk.size(); ii++)
+                        if (chunk[ii] != (char) ('a' + ((*bytes + ii) % 26)))
+                            *valid = false;
+                    *bytes += chunk.size();
+                    (*chunks)++;
+                    return true;
+                },
+                [bytes, chunks, valid]() -> ResponseObj
+                {
+                    return ResponseObj{200, {{"bytes", std::to_string(*bytes)},
+                            {"chunks", std::to_string(*chunks)},
+                            {"valid", (*valid ? "true" : "false")}}};
+                }};
+        }
 };
 
+/**
+ * Test function used to drive the slow route with concurrent clients
+ *
+ * @param workerThreads Integer representing the servable's worker threads
+ * @param clients Integer representing the number of concurrent clients
+ * @param requestsPerClient Integer representing the requests per client
+ * @return Double representing the measured throughput (requests per second)
+ */
+double runConcurrentSlowRequests(int workerThreads, int clients, int requestsPerClient)
+{
+
+    // Create a simple servable instance with the given worker threads
+    HelloServable helloServer(12345);
+    helloServer.start(workerThreads);
+
+    // Have every client hammer the slow route at the same time
+    std::atomic<int> failedRequests{0};
+    std::vector<std::thread> clientThreads;
+    auto startTime = std::chrono::steady_clock::now();
+    for (auto ii = 0; ii < clients; ii++)
+        clientThreads.emplace_back([&failedRequests, requestsPerClient]()
+        {
+            for (auto jj = 0; jj < requestsPerClient; jj++)
+            {
+                auto response = Requests::makeRequest(
+                        Servable::HttpMethod::GET, "http://localhost:12345/helloslow", {});
+                if ((response.code != 200) || (response.body["message"] != "world"))
+                    failedRequests++;
+            }
+        });
+    for (auto& clientThread : clientThreads)
+        clientThread.join();
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime);
+
+    // Every single request must have been served correctly
+    REQUIRE(failedRequests == 0);
+    REQUIRE(helloServer.getSlowRequestCount() == (clients * requestsPerClient));
+
+    // Return the measured throughput
+    return ((clients * requestsPerClient) / elapsed.count());
+}
+
+
 TEST_CASE ("Generic Servable Test", "[ServableRequestsTest]")
 {
 
@@ -194,6 +337,182 @@ TEST_CASE ("Specified Single-Threaded Servable Test", "[ServableRequestsTest]")
     REQUIRE(response.body["message"] == "world");
 }
 
+TEST_CASE ("Concurrent Load Multi-Threaded Servable Test", "[ServableRequestsTest]")
+{
+
+    // Drive the same concurrent load against a single worker thread
+    // and against a pool of worker threads
+    auto singleThroughput = runConcurrentSlowRequests(1, 8, 5);
+    auto multiThroughput = runConcurrentSlowRequests(8, 8, 5);
+
+    // The worker pool should serve the slow handlers in parallel so
+    // the throughput has to scale well beyond the single-threaded case
+    REQUIRE(multiThroughput > (2 * singleThroughput));
+}
+
+TEST_CASE ("Keep-Alive Connection Re-Use Servable Test", "[ServableRequestsTest]")
+{
+
+    // Create a simple servable instance
+    HelloServable helloServer(12346);
+    helloServer.start();
+
+    // Make a number of sequential requests to the simple server
+    for (auto ii = 0; ii < 10; ii++)
+    {
+        auto response = Requests::makeRequest(
+                Servable::HttpMethod::GET, "http://localhost:12346/hello", {});
+        REQUIRE(response.code == 200);
+        REQUIRE(response.body["message"] == "world");
+    }
+
+    // Validate that the requests shared a single kept-alive connection
+    auto& connectionPool = ConnectionPool::getDefaultPool();
+    REQUIRE(connectionPool.getActiveSessionCount("http://localhost:12346") == 0);
+    REQUIRE(connectionPool.getIdleSessionCount("http://localhost:12346") == 1);
+
+    // Validate that connections opting-out of keep-alive are still served
+    auto responseRaw = cpr::Get(cpr::Url{"http://localhost:12346/hello"},
+            cpr::Header{{"Connection", "close"}}, cpr::Timeout{1000});
+    REQUIRE(responseRaw.status_code == 200);
+    REQUIRE(responseRaw.header["Connection"] == "close");
+}
+
+TEST_CASE ("Keep-Alive Disabled Servable Test", "[ServableRequestsTest]")
+{
+
+    // Create a simple servable instance without keep-alive
+    HelloServable helloServer(12347);
+    helloServer.setKeepAlive(false);
+    helloServer.start();
+
+    // Validate that requests are still served (with closed connections)
+    for (auto ii = 0; ii < 3; ii++)
+    {
+        auto response = Requests::makeRequest(
+                Servable::HttpMethod::GET, "http://localhost:12347/hello", {});
+        REQUIRE(response.code == 200);
+        REQUIRE(response.body["message"] == "world");
+    }
+}
+
+TEST_CASE ("Asynchronous Requests Servable Test", "[ServableRequestsTest]")
+{
+
+    // Create a simple servable instance
+    HelloServable helloServer(12348);
+    helloServer.start(8);
+
+    // Make a number of slow requests at once and time how long they take
+    auto startTime = std::chrono::steady_clock::now();
+    std::vector<std::future<Servable::ResponseObj>> responses;
+    for (auto ii = 0; ii < 8; ii++)
+        responses.push_back(Requests::makeRequestAsync(
+                Servable::HttpMethod::GET, "http://localhost:12348/helloslow", {}));
+
+    // Validate that all of the responses were successful
+    for (auto& response : responses)
+    {
+        auto responseObj = response.get();
+        REQUIRE(responseObj.code == 200);
+        REQUIRE(responseObj.body["message"] == "world");
+    }
+
+    // Validate that the requests overlapped rather than running one-by-one
+    auto elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - startTime).count();
+    REQUIRE(elapsedMs < (8 * 50));
+    REQUIRE(helloServer.getSlowRequestCount() == 8);
+
+    // Make a POST request with a callback and validate the response
+    std::promise<Servable::ResponseObj> callbackPromise;
+    Requests::makeRequestAsync(Servable::HttpMethod::POST, "http://localhost:12348/hello2",
+            {{"name", "tyler"}}, [&callbackPromise](Servable::ResponseObj response)
+            {
+                callbackPromise.set_value(response);
+            });
+    auto response = callbackPromise.get_future().get();
+    REQUIRE(response.code == 201);
+    REQUIRE(response.body["name"] == "tyler");
+}
+
+TEST_CASE ("Bounded In-Flight Request Dispatcher Test", "[ServableRequestsTest]")
+{
+
+    // Create a simple servable instance
+    HelloServable helloServer(12349);
+    helloServer.start(8);
+
+    // Setup a dispatcher which only allows a single request in-flight
+    std::atomic<int> completedRequests(0);
+    auto startTime = std::chrono::steady_clock::now();
+    {
+        RequestDispatcher requestDispatcher(1);
+        for (auto ii = 0; ii < 4; ii++)
+            requestDispatcher.dispatch(Servable::HttpMethod::GET,
+                    "http://localhost:12349/helloslow", {}, 10000, 1,
+                    [&completedRequests](Servable::ResponseObj response)
+                    {
+                        if (response.code == 200)
+                            completedRequests++;
+                    });
+
+        // Wait for all of the requests to complete
+        while (completedRequests < 4)
+        {
+            REQUIRE(requestDispatcher.getInFlightCount() <= 1);
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+    }
+
+    // Validate that the requests were sent one at a time
+    auto elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - startTime).count();
+    REQUIRE(completedRequests == 4);
+    REQUIRE(elapsedMs >= (4 * 50));
+}
+
+TEST_CASE ("Broadcast Requests Servable Test", "[ServableRequestsTest]")
+{
+
+    // Create a few simple servable instances
+    HelloServable helloServer1(12350);
+    HelloServable helloServer2(12351);
+    HelloServable helloServer3(12352);
+    helloServer1.start();
+    helloServer2.start();
+    helloServer3.start();
+
+    // Broadcast a POST request to all of the servers and wait for all of them
+    auto broadcastResult = Requests::broadcast({"http://localhost:12350/hello2",
+            "http://localhost:12351/hello2", "http://localhost:12352/hello2"},
+            Servable::HttpMethod::POST, {{"name", "tyler"}});
+    REQUIRE(broadcastResult.quorumReached);
+    REQUIRE(broadcastResult.pendingUrls.empty());
+    REQUIRE(broadcastResult.responses.size() == 3);
+    for (auto& response : broadcastResult.responses)
+    {
+        REQUIRE(response.second.code == 201);
+        REQUIRE(response.second.body["name"] == "tyler");
+    }
+
+    // Broadcast to the servers (and one which is not running) only
+    // waiting for a quorum of two successful responses
+    broadcastResult = Requests::broadcast({"http://localhost:12350/hello",
+            "http://localhost:12351/hello", "http://localhost:12352/helloslow",
+            "http://localhost:12353/hello"}, Servable::HttpMethod::GET, {}, 2);
+    REQUIRE(broadcastResult.quorumReached);
+    REQUIRE(broadcastResult.responses.size() >= 2);
+    REQUIRE((broadcastResult.responses.size() + broadcastResult.pendingUrls.size()) == 4);
+
+    // Broadcast requiring every server (including the one which is not
+    // running) to succeed and validate that quorum cannot be reached
+    broadcastResult = Requests::broadcast({"http://localhost:12350/hello",
+            "http://localhost:12353/hello"}, Servable::HttpMethod::GET, {}, 2, 1000);
+    REQUIRE(!broadcastResult.quorumReached);
+    REQUIRE(broadcastResult.responses["http://localhost:12350/hello"].code == 200);
+}
+
 TEST_CASE ("Too Large Body Size for Servable", "[ServableRequestsTest]")
 {
 
@@ -215,6 +534,253 @@ TEST_CASE ("Too Large Body Size for Servable", "[ServableRequestsTest]")
     REQUIRE(response.body["Message"] == "Failed to read HTTP Request: Request Body Too Long");
 }
 
+TEST_CASE ("Configurable Body Size for Servable", "[ServableRequestsTest]")
+{
+
+    // Create a simple servable instance which accepts larger bodies
+    HelloServable helloServer(12345);
+    helloServer.setMaxBodySize(2 * 1024 * 1024);
+    helloServer.start();
+
+    // Create a very unordered-map (10K hashes) to send as the body
+    std::unordered_map<std::string, std::string> veryLongBody;
+    for (auto ii = 0; ii < 10000; ii++)
+        veryLongBody[std::to_string(ii)] = StandardModel::Crypto::sha256(std::to_string(ii));
+    veryLongBody["name"] = "tyler";
+
+    // Make a POST request to the simple server
+    auto response = Requests::makeRequest(
+            Servable::HttpMethod::POST, "http://localhost:12345/hello2", veryLongBody);
+    REQUIRE(response.code == 201);
+    REQUIRE(response.body["name"] == "tyler");
+}
+
+TEST_CASE ("Streaming Body Supplied to Servable", "[ServableRequestsTest]")
+{
+
+    // Create a simple servable instance
+    HelloServable helloServer(12345);
+    helloServer.start();
+
+    // Create a (3 MiB) body well beyond the default body limit
+    std::string bodyString;
+    bodyString.reserve(3 * 1024 * 1024);
+    for (auto ii = 0; ii < (3 * 1024 * 1024); ii++)
+        bodyString += (char) ('a' + (ii % 26));
+
+    // Validate that the body was streamed to the handler in multiple chunks
+    auto responseRaw = cpr::Post(cpr::Url{"http://localhost:12345/hellostream"},
+            cpr::Body{bodyString}, cpr::Timeout{10000});
+    REQUIRE(responseRaw.status_code == 200);
+    REQUIRE(responseRaw.text.find("\"bytes\":\"3145728\"") != std::string::npos);
+    REQUIRE(responseRaw.text.find("\"valid\":\"true\"") != std::string::npos);
+    REQUIRE(responseRaw.text.find("\"chunks\":\"1\"") == std::string::npos);
+
+    // Validate that a body beyond the streaming listener's limit is rejected
+    bodyString += bodyString;
+    responseRaw = cpr::Post(cpr::Url{"http://localhost:12345/hellostream"},
+            cpr::Body{bodyString}, cpr::Timeout{10000});
+    REQUIRE(responseRaw.status_code == 413);
+    REQUIRE(responseRaw.text == "Failed to read HTTP Request: Request Body Too Long");
+}
+
+TEST_CASE ("Chunked Body without Length Supplied to Servable", "[ServableRequestsTest]")
+{
+
+    // Create a simple servable instance
+    HelloServable helloServer(12345);
+    helloServer.start();
+
+    // Validate that a chunked body is rejected rather than read as being empty
+    auto responseRaw = cpr::Post(cpr::Url{"http://localhost:12345/hello2"},
+            cpr::Body{"{\"name\":\"tyler\"}"},
+            cpr::Header{{"Transfer-Encoding", "chunked"}}, cpr::Timeout{1000});
+    REQUIRE(responseRaw.status_code == 411);
+    REQUIRE(responseRaw.text == "Failed to read HTTP Request: Content-Length Required");
+
+    // Validate that streaming routes reject chunked bodies as well
+    responseRaw = cpr::Post(cpr::Url{"http://localhost:12345/hellostream"},
+            cpr::Body{"abcdefghijklmnopqrstuvwxyz"},
+            cpr::Header{{"Transfer-Encoding", "chunked"}}, cpr::Timeout{1000});
+    REQUIRE(responseRaw.status_code == 411);
+}
+
+TEST_CASE ("Typed Body Supplied to Servable", "[ServableRequestsTest]")
+{
+
+    // Create a simple servable instance
+    HelloServable helloServer(12345);
+    helloServer.start();
+
+    // Make a typed POST request to the simple server
+    Payload body;
+    body["name"] = "tyler";
+    body["count"] = 3;
+    body["items"].push(1);
+    body["items"].push(2.5);
+    body["nested"]["enabled"] = true;
+    auto response = Requests::makeTypedRequest(
+            Servable::HttpMethod::POST, "http://localhost:12345/hellotyped", body);
+
+    // Validate that the string and typed response members were returned
+    REQUIRE(response.code == 200);
+    REQUIRE(response.body.size() == 1);
+    REQUIRE(response.body["name"] == "tyler");
+    REQUIRE(response.data.get("total").getInt() == 6);
+    REQUIRE(response.data.get("nested").get("enabled").getBool());
+
+    // Validate that existing string-only routes ignore typed members
+    response = Requests::makeTypedRequest(
+            Servable::HttpMethod::POST, "http://localhost:12345/hello2", body);
+    REQUIRE(response.code == 201);
+    REQUIRE(response.body["name"] == "tyler");
+}
+
+TEST_CASE ("Compressed Responses from Servable", "[ServableRequestsTest]")
+{
+
+    // Create a simple servable instance
+    HelloServable helloServer(12345);
+    helloServer.start();
+
+    // Validate that large responses are decompressed by the requests
+    std::string message(4096, 'a');
+    auto response = Requests::makeRequest(Servable::HttpMethod::GET,
+            "http://localhost:12345/helloecho/" + message, {});
+    REQUIRE(response.code == 200);
+    REQUIRE(response.body["message"] == message);
+
+    // Validate that large responses are compressed for accepting clients
+    auto responseRaw = cpr::Get(cpr::Url{"http://localhost:12345/helloecho/" + message},
+            cpr::Header{{"Accept-Encoding", "gzip"}}, cpr::Timeout{1000});
+    REQUIRE(responseRaw.status_code == 200);
+    REQUIRE(responseRaw.header["Content-Encoding"] == "gzip");
+    REQUIRE(responseRaw.text.size() < message.size());
+    std::string responseString;
+    REQUIRE(Compression::decompress(responseRaw.text.c_str(), responseRaw.text.size(),
+            Compression::Encoding::GZIP, responseString));
+    REQUIRE(responseString == ("{\"message\":\"" + message + "\"}"));
+
+    // Validate that small responses (and clients not accepting it) are not compressed
+    responseRaw = cpr::Get(cpr::Url{"http://localhost:12345/hello"},
+            cpr::Header{{"Accept-Encoding", "gzip"}}, cpr::Timeout{1000});
+    REQUIRE(responseRaw.header["Content-Encoding"].empty());
+    responseRaw = cpr::Get(cpr::Url{"http://localhost:12345/helloecho/" + message}, cpr::Timeout{1000});
+    REQUIRE(responseRaw.header["Content-Encoding"].empty());
+
+    // Validate that compression can be disabled
+    helloServer.setCompressionThreshold(-1);
+    responseRaw = cpr::Get(cpr::Url{"http://localhost:12345/helloecho/" + message},
+            cpr::Header{{"Accept-Encoding", "gzip, deflate"}}, cpr::Timeout{1000});
+    REQUIRE(responseRaw.header["Content-Encoding"].empty());
+}
+
+TEST_CASE ("Route Metrics Servable Test", "[ServableRequestsTest]")
+{
+
+    // Create a simple servable instance
+    HelloServable helloServer(12345);
+    helloServer.start();
+
+    // Make a few requests on the simple server
+    for (auto ii = 0; ii < 3; ii++)
+        Requests::makeRequest(Servable::HttpMethod::GET, "http://localhost:12345/hello", {});
+    Requests::makeRequest(Servable::HttpMethod::GET, "http://localhost:12345/helloecho/world", {});
+    cpr::Post(cpr::Url{"http://localhost:12345/hello2"}, cpr::Body{"NotJson"}, cpr::Timeout{1000});
+
+    // Validate that the requests were counted by route and response code
+    auto routeMetrics = helloServer.getRouteMetrics();
+    REQUIRE(routeMetrics->getRequestCount("GET", "/hello") == 3);
+    REQUIRE(routeMetrics->getResponseCount("GET", "/hello", 200) == 3);
+    REQUIRE(routeMetrics->getRequestCount("GET", "/helloecho/{echo}") == 1);
+    REQUIRE(routeMetrics->getResponseCount("POST", "/hello2", 400) == 1);
+    REQUIRE(routeMetrics->getInFlightCount("GET", "/hello") == 0);
+    REQUIRE(routeMetrics->getLatencyPercentile("GET", "/hello", 99) > 0);
+
+    // Validate that the metrics are served in the Prometheus text format
+    auto responseRaw = cpr::Get(cpr::Url{"http://localhost:12345/metrics"}, cpr::Timeout{1000});
+    REQUIRE(responseRaw.status_code == 200);
+    REQUIRE(responseRaw.text.find(
+            "bitquark_requests_total{method=\"GET\",route=\"/hello\",code=\"200\"} 3") != std::string::npos);
+    REQUIRE(responseRaw.text.find(
+            "bitquark_request_duration_seconds_count{method=\"GET\",route=\"/hello\"} 3") != std::string::npos);
+}
+
+TEST_CASE ("Route Metrics Histogram Buckets", "[ServableRequestsTest]")
+{
+
+    // Validate that the buckets are contiguous and cover their latencies
+    for (long latency = 0; latency < 100000; latency++)
+    {
+        auto bucket = RouteMetrics::getLatencyBucket(latency);
+        REQUIRE(latency < RouteMetrics::getLatencyBucketBound(bucket));
+        if (bucket > 0)
+            REQUIRE(latency >= RouteMetrics::getLatencyBucketBound(bucket - 1));
+    }
+    REQUIRE(RouteMetrics::getLatencyBucket(-1) == 0);
+    REQUIRE(RouteMetrics::getLatencyBucket(1L << 40) == (RouteMetrics::LATENCY_BUCKETS - 1));
+}
+
+TEST_CASE ("Admission Control Sheds Excess Servable Requests", "[ServableRequestsTest]")
+{
+
+    // Create a simple servable instance which only handles a single request at a time
+    HelloServable helloServer(12345);
+    helloServer.getAdmissionController()->setMaxConcurrent(1);
+    helloServer.start(4);
+
+    // Make several (slow) requests at once on the simple server
+    std::vector<std::future<cpr::Response>> responseFutures;
+    for (auto ii = 0; ii < 4; ii++)
+        responseFutures.push_back(std::async(std::launch::async, []()
+        {
+            return cpr::Get(cpr::Url{"http://localhost:12345/helloslow"}, cpr::Timeout{5000});
+        }));
+
+    // Validate that the excess requests were shed with a retry-after time
+    long successCount = 0;
+    long shedCount = 0;
+    for (auto& responseFuture : responseFutures)
+    {
+        auto responseRaw = responseFuture.get();
+        if (responseRaw.status_code == 200)
+            successCount++;
+        if (responseRaw.status_code == 503)
+        {
+            shedCount++;
+            REQUIRE(responseRaw.header["Retry-After"] == "1");
+        }
+    }
+    REQUIRE(successCount >= 1);
+    REQUIRE((successCount + shedCount) == 4);
+    REQUIRE(helloServer.getAdmissionController()->getShedCount(
+            AdmissionController::RouteClass::EXTERNAL) == (unsigned long) shedCount);
+    REQUIRE(helloServer.getRouteMetrics()->getResponseCount(
+            "GET", "/helloslow", 503) == (unsigned long) shedCount);
+}
+
+TEST_CASE ("Failing Handler on a Keep-Alive Connection Servable Test", "[ServableRequestsTest]")
+{
+
+    // Create a simple servable instance (which keeps connections alive)
+    HelloServable helloServer(12345);
+    helloServer.start();
+
+    // Validate that a failing handler is promptly responded to with an error
+    auto startTime = std::chrono::steady_clock::now();
+    auto responseRaw = cpr::Get(cpr::Url{"http://localhost:12345/hellothrow"},
+            cpr::Header{{"Connection", "keep-alive"}}, cpr::Timeout{5000});
+    REQUIRE(responseRaw.status_code == 500);
+    REQUIRE(responseRaw.text == "Invalid HTTP Request: Internal Error");
+    REQUIRE((std::chrono::steady_clock::now() - startTime) < std::chrono::seconds(1));
+    REQUIRE(helloServer.getRouteMetrics()->getResponseCount("GET", "/hellothrow", 500) == 1);
+
+    // Validate that the server continues to handle requests afterwards
+    auto response = Requests::makeRequest(
+            Servable::HttpMethod::GET, "http://localhost:12345/hello", {});
+    REQUIRE(response.code == 200);
+}
+
 TEST_CASE ("Invalid JSON Body Supplied to Servable", "[ServableRequestsTest]")
 {
 
@@ -0,0 +1,125 @@
+/* This file is part of bit-quark.
+ *
+ * Copyright (c) BitBoson
+ *
+ * bit-quark is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bit-quark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bit-quark.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+#ifndef BITQUARK_DISKCACHE_TEST_HPP
+#define BITQUARK_DISKCACHE_TEST_HPP
+
+#include <catch.hpp>
+#include <string>
+#include <filesystem>
+#include <BitBoson/BitQuark/Storage/DiskCache.h>
+
+using namespace BitBoson::BitQuark;
+
+/**
+ * Test function used to get an (empty) directory for a testing disk cache
+ *
+ * @param dirName String representing the name of the directory
+ * @return String representing the path of the directory
+ */
+std::string getTestDiskCacheDir(const std::string& dirName)
+{
+    auto cacheDir = (std::filesystem::temp_directory_path() / dirName).string();
+    std::filesystem::remove_all(cacheDir);
+    return cacheDir;
+}
+
+TEST_CASE ("Add and Invalidate Items Disk-Cache Test", "[DiskCacheTest]")
+{
+
+    // Create a disk cache and add some items to it
+    auto cacheDir = getTestDiskCacheDir("BitQuark_DiskCacheTest");
+    auto diskCache = DiskCache(cacheDir, 1024);
+    REQUIRE(diskCache.addItem("Key1", "Value1", "ETag1"));
+    REQUIRE(diskCache.addItem("Key2", std::string("Value\n\0Two", 10), "ETag2"));
+    REQUIRE(diskCache.getItemCount() == 2);
+
+    // Validate that the items are cached along with their ETags
+    std::string value;
+    std::string eTag;
+    REQUIRE(diskCache.getItem("Key1", value, eTag));
+    REQUIRE(value == "Value1");
+    REQUIRE(eTag == "ETag1");
+    REQUIRE(diskCache.getItem("Key2", value, eTag));
+    REQUIRE(value == std::string("Value\n\0Two", 10));
+    REQUIRE(eTag == "ETag2");
+    REQUIRE(!diskCache.getItem("Key3", value, eTag));
+
+    // Validate that items can be replaced and removed
+    REQUIRE(diskCache.addItem("Key1", "NewValue1", "ETag3"));
+    REQUIRE(diskCache.getItem("Key1", value, eTag));
+    REQUIRE(value == "NewValue1");
+    REQUIRE(eTag == "ETag3");
+    diskCache.removeItem("Key2");
+    REQUIRE(!diskCache.getItem("Key2", value, eTag));
+    REQUIRE(diskCache.getItemCount() == 1);
+
+    // Validate that clearing the cache removes everything
+    diskCache.clear();
+    REQUIRE(diskCache.getItemCount() == 0);
+    REQUIRE(diskCache.getSize() == 0);
+    std::filesystem::remove_all(cacheDir);
+}
+
+TEST_CASE ("Survive Restart and Evict Items Disk-Cache Test", "[DiskCacheTest]")
+{
+
+    // Create a disk cache with room for three (16-byte) object files
+    // NOTE: Each file holds a 5-byte ETag line and a 10-byte value
+    auto cacheDir = getTestDiskCacheDir("BitQuark_DiskCacheRestartTest");
+    {
+        auto diskCache = DiskCache(cacheDir, 48);
+        REQUIRE(diskCache.addItem("Key1", std::string(10, 'A'), "ETag1"));
+        REQUIRE(diskCache.addItem("Key2", std::string(10, 'B'), "ETag2"));
+        REQUIRE(diskCache.addItem("Key3", std::string(10, 'C'), "ETag3"));
+        REQUIRE(diskCache.getSize() == 48);
+
+        // Validate that adding another item evicts the least recently used item
+        REQUIRE(diskCache.addItem("Key4", std::string(10, 'D'), "ETag4"));
+        REQUIRE(diskCache.getEvictionCount() == 1);
+        REQUIRE(diskCache.getItemCount() == 3);
+
+        // Validate that items larger than the cache are never cached
+        REQUIRE(!diskCache.addItem("Key5", std::string(48, 'E'), "ETag5"));
+        REQUIRE(diskCache.getItemCount() == 3);
+    }
+
+    // Validate that the cached items are picked-up by a new instance
+    {
+        auto diskCache = DiskCache(cacheDir, 48);
+        std::string value;
+        std::string eTag;
+        REQUIRE(diskCache.getItemCount() == 3);
+        REQUIRE(diskCache.getSize() == 48);
+        REQUIRE(!diskCache.getItem("Key1", value, eTag));
+        REQUIRE(diskCache.getItem("Key4", value, eTag));
+        REQUIRE(value == std::string(10, 'D'));
+        REQUIRE(eTag == "ETag4");
+    }
+
+    // Validate that a smaller cache evicts down to its size when picked-up
+    auto smallDiskCache = DiskCache(cacheDir, 32);
+    REQUIRE(smallDiskCache.getItemCount() == 2);
+    REQUIRE(smallDiskCache.getSize() == 32);
+    std::filesystem::remove_all(cacheDir);
+}
+
+#endif //BITQUARK_DISKCACHE_TEST_HPP
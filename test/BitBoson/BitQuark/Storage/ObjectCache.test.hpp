@@ -0,0 +1,112 @@
+/* This file is part of bit-quark.
+ *
+ * Copyright (c) BitBoson
+ *
+ * bit-quark is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bit-quark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bit-quark.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+#ifndef BITQUARK_OBJECTCACHE_TEST_HPP
+#define BITQUARK_OBJECTCACHE_TEST_HPP
+
+#include <catch.hpp>
+#include <memory>
+#include <string>
+#include <BitBoson/BitQuark/Storage/ObjectCache.h>
+
+using namespace BitBoson::BitQuark;
+
+TEST_CASE ("Add and Invalidate Items Object-Cache Test", "[ObjectCacheTest]")
+{
+
+    // Create an object cache and add some items to it
+    auto objectCache = ObjectCache(100);
+    REQUIRE(objectCache.addItem("Key1", std::make_shared<const std::string>("Value1"),
+            "ETag1", objectCache.getGeneration()));
+    REQUIRE(objectCache.addItem("Key2", std::make_shared<const std::string>("Value2"),
+            "ETag2", objectCache.getGeneration()));
+    REQUIRE(objectCache.getItemCount() == 2);
+    REQUIRE(objectCache.getSize() == 12);
+
+    // Validate that the items are cached along with their ETags
+    ObjectCache::CachedObject cachedObject;
+    REQUIRE(objectCache.getItem("Key1", cachedObject));
+    REQUIRE(*cachedObject.value == "Value1");
+    REQUIRE(cachedObject.eTag == "ETag1");
+    REQUIRE(!objectCache.getItem("Key3", cachedObject));
+
+    // Validate that replacing an item replaces its size
+    REQUIRE(objectCache.addItem("Key1", std::make_shared<const std::string>("NewValue1"),
+            "ETag3", objectCache.getGeneration()));
+    REQUIRE(objectCache.getItem("Key1", cachedObject));
+    REQUIRE(*cachedObject.value == "NewValue1");
+    REQUIRE(objectCache.getSize() == 15);
+
+    // Validate that reads started before an invalidation are not cached
+    auto generation = objectCache.getGeneration();
+    objectCache.removeItem("Key2");
+    REQUIRE(!objectCache.getItem("Key2", cachedObject));
+    REQUIRE(!objectCache.addItem("Key2", std::make_shared<const std::string>("Value2"),
+            "ETag2", generation));
+    REQUIRE(objectCache.getSize() == 9);
+
+    // Validate that clearing the cache removes everything
+    objectCache.clear();
+    REQUIRE(objectCache.getItemCount() == 0);
+    REQUIRE(objectCache.getSize() == 0);
+}
+
+TEST_CASE ("Least Recently Used Eviction Object-Cache Test", "[ObjectCacheTest]")
+{
+
+    // Create an object cache with room for three (ten-byte) items
+    auto objectCache = ObjectCache(30);
+    REQUIRE(objectCache.addItem("Key1", std::make_shared<const std::string>(10, 'A'),
+            "ETag1", objectCache.getGeneration()));
+    REQUIRE(objectCache.addItem("Key2", std::make_shared<const std::string>(10, 'B'),
+            "ETag2", objectCache.getGeneration()));
+    REQUIRE(objectCache.addItem("Key3", std::make_shared<const std::string>(10, 'C'),
+            "ETag3", objectCache.getGeneration()));
+
+    // Use the first item so that the second is the least recently used
+    ObjectCache::CachedObject cachedObject;
+    REQUIRE(objectCache.getItem("Key1", cachedObject));
+
+    // Validate that adding another item evicts the least recently used item
+    REQUIRE(objectCache.addItem("Key4", std::make_shared<const std::string>(10, 'D'),
+            "ETag4", objectCache.getGeneration()));
+    REQUIRE(objectCache.getEvictionCount() == 1);
+    REQUIRE(objectCache.getItemCount() == 3);
+    REQUIRE(objectCache.getItem("Key1", cachedObject));
+    REQUIRE(!objectCache.getItem("Key2", cachedObject));
+    REQUIRE(objectCache.getItem("Key3", cachedObject));
+    REQUIRE(objectCache.getItem("Key4", cachedObject));
+
+    // Validate that items larger than the cache are never cached
+    REQUIRE(!objectCache.addItem("Key5", std::make_shared<const std::string>(31, 'E'),
+            "ETag5", objectCache.getGeneration()));
+    REQUIRE(objectCache.getEvictionCount() == 1);
+    REQUIRE(objectCache.getSize() == 30);
+
+    // Validate the hit/miss counters
+    objectCache.recordHit();
+    objectCache.recordHit();
+    objectCache.recordMiss();
+    REQUIRE(objectCache.getHitCount() == 2);
+    REQUIRE(objectCache.getMissCount() == 1);
+}
+
+#endif //BITQUARK_OBJECTCACHE_TEST_HPP
@@ -0,0 +1,85 @@
+/* This file is part of bit-quark.
+ *
+ * Copyright (c) BitBoson
+ *
+ * bit-quark is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bit-quark is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bit-quark.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+
+#ifndef BITQUARK_S3CLIENTOPTIONS_TEST_HPP
+#define BITQUARK_S3CLIENTOPTIONS_TEST_HPP
+
+#include <catch.hpp>
+#include <BitBoson/BitQuark/Storage/S3ClientOptions.h>
+
+using namespace BitBoson::BitQuark;
+
+TEST_CASE ("Default S3-Client-Options Test", "[S3ClientOptionsTest]")
+{
+
+    // Create the S3 Client Options with the defaults
+    auto s3ClientOptions = S3ClientOptions();
+    auto config = s3ClientOptions.getClientConfiguration("localhost:9000");
+
+    // Validate that the defaults match the SDK (over HTTP with path-style addressing)
+    REQUIRE(s3ClientOptions.usePathStyleAddressing());
+    REQUIRE(!s3ClientOptions.useHttps());
+    REQUIRE(config.endpointOverride == "localhost:9000");
+    REQUIRE(config.scheme == Aws::Http::Scheme::HTTP);
+    REQUIRE(config.maxConnections == 25);
+    REQUIRE(config.connectTimeoutMs == 1000);
+    REQUIRE(config.requestTimeoutMs == 3000);
+    REQUIRE(config.enableTcpKeepAlive);
+    REQUIRE(s3ClientOptions.getExecutorThreads() == 0);
+    REQUIRE(s3ClientOptions.getAsyncThreads() > 0);
+}
+
+TEST_CASE ("Configured S3-Client-Options Test", "[S3ClientOptionsTest]")
+{
+
+    // Create the S3 Client Options with some custom values
+    auto s3ClientOptions = S3ClientOptions();
+    s3ClientOptions.setMaxConnections(64);
+    s3ClientOptions.setTimeouts(500, 10000);
+    s3ClientOptions.setExecutorThreads(8);
+    s3ClientOptions.setAsyncThreads(6);
+    s3ClientOptions.setTcpKeepAlive(true, 15000);
+    s3ClientOptions.setPathStyleAddressing(false);
+    s3ClientOptions.setHttps(true);
+    auto config = s3ClientOptions.getClientConfiguration("s3.example.com");
+
+    // Validate that the values were applied to the client configuration
+    REQUIRE(!s3ClientOptions.usePathStyleAddressing());
+    REQUIRE(s3ClientOptions.getExecutorThreads() == 8);
+    REQUIRE(s3ClientOptions.getAsyncThreads() == 6);
+    REQUIRE(config.scheme == Aws::Http::Scheme::HTTPS);
+    REQUIRE(config.maxConnections == 64);
+    REQUIRE(config.connectTimeoutMs == 500);
+    REQUIRE(config.requestTimeoutMs == 10000);
+    REQUIRE(config.tcpKeepAliveIntervalMs == 15000);
+    REQUIRE(config.executor != nullptr);
+
+    // Validate that the connection pool always has at least one connection
+    s3ClientOptions.setMaxConnections(0);
+    REQUIRE(s3ClientOptions.getMaxConnections() == 1);
+
+    // Validate that the asynchronous pool always has at least one thread
+    s3ClientOptions.setAsyncThreads(0);
+    REQUIRE(s3ClientOptions.getAsyncThreads() > 0);
+}
+
+#endif //BITQUARK_S3CLIENTOPTIONS_TEST_HPP
@@ -23,9 +23,18 @@
 #define BITQUARK_S3DATASTORE_TEST_HPP
 
 #include <catch.hpp>
+#include <chrono>
+#include <future>
+#include <thread>
+#include <vector>
+#include <algorithm>
+#include <sstream>
+#include <functional>
+#include <filesystem>
 #include <iostream>
 #include <BitBoson/BitQuark/Storage/S3DataStore.h>
 #include <BitBoson/BitQuark/Storage/S3Credentials.h>
+#include <BitBoson/BitQuark/Storage/S3ClientOptions.h>
 
 using namespace BitBoson::BitQuark;
 
@@ -411,4 +420,471 @@ TEST_CASE ("Delete Data-Store with Invalid Keys S3-Data-Store Test", "[S3DataSto
     REQUIRE(dataStore.deleteEntireDataStore(true));
 }
 
+TEST_CASE ("Asynchronous S3-Data-Store Test", "[S3DataStoreTest]")
+{
+
+    // Create a s3 data-store with the given setup
+    auto s3Credentials = getTestS3Credentials("S3DataStoreTest");
+    auto dataStore = S3DataStore(s3Credentials);
+
+    // Cleanup s3-data-store instance
+    REQUIRE(dataStore.deleteEntireDataStore(true));
+
+    // Insert some data in the data-store concurrently
+    // (including overlapping writes to the same key)
+    std::vector<std::future<bool>> addFutures;
+    for (int ii = 0; ii < 20; ii++)
+        addFutures.push_back(dataStore.addItemAsync(
+            std::string("Key") + std::to_string(ii % 10), "Value1"));
+    for (auto& addFuture : addFutures)
+        REQUIRE(addFuture.get());
+
+    // Verify the size of the stored data
+    REQUIRE(dataStore.getSize() == 60);
+
+    // Retrieve the data from the data-store concurrently
+    auto getFuture1 = dataStore.getItemAsync("Key1");
+    auto getFuture2 = dataStore.getItemAsync("Key2");
+    REQUIRE(getFuture1.get() == "Value1");
+    REQUIRE(getFuture2.get() == "Value1");
+
+    // Delete some of the data from the data-store concurrently
+    auto deleteFuture1 = dataStore.deleteItemAsync("Key1");
+    auto deleteFuture2 = dataStore.deleteItemAsync("Key2");
+    REQUIRE(deleteFuture1.get());
+    REQUIRE(deleteFuture2.get());
+
+    // Verify the size of the stored data
+    REQUIRE(dataStore.getSize() == 48);
+    REQUIRE(dataStore.getItem("Key1").empty());
+
+    // Cleanup s3-data-store instance
+    REQUIRE(dataStore.deleteEntireDataStore(true));
+}
+
+TEST_CASE ("Asynchronous with Default Options S3-Data-Store Test", "[S3DataStoreTest]")
+{
+
+    // Create a s3 data-store with the default client options
+    auto s3Credentials = getTestS3Credentials("S3DataStoreTest");
+    auto dataStore = S3DataStore(s3Credentials, std::make_shared<S3ClientOptions>());
+
+    // Cleanup s3-data-store instance
+    REQUIRE(dataStore.deleteEntireDataStore(true));
+
+    // Validate that the asynchronous operations actually complete
+    auto addFuture = dataStore.addItemAsync("Key1", "Value1");
+    REQUIRE(addFuture.wait_for(std::chrono::seconds(10)) == std::future_status::ready);
+    REQUIRE(addFuture.get());
+    auto getFuture = dataStore.getItemAsync("Key1");
+    REQUIRE(getFuture.wait_for(std::chrono::seconds(10)) == std::future_status::ready);
+    REQUIRE(getFuture.get() == "Value1");
+
+    // Cleanup s3-data-store instance
+    REQUIRE(dataStore.deleteEntireDataStore(true));
+}
+
+TEST_CASE ("Batch Operations S3-Data-Store Test", "[S3DataStoreTest]")
+{
+
+    // Create a s3 data-store with the given setup
+    auto s3Credentials = getTestS3Credentials("S3DataStoreTest");
+    auto dataStore = S3DataStore(s3Credentials);
+
+    // Cleanup s3-data-store instance
+    REQUIRE(dataStore.deleteEntireDataStore(true));
+
+    // Insert some data in the data-store as a single batch
+    std::unordered_map<std::string, std::string> items;
+    for (int ii = 0; ii < 50; ii++)
+        items[std::string("Key") + std::to_string(ii)] = std::string("Value") + std::to_string(ii % 10);
+    REQUIRE(dataStore.addItems(items, 8));
+    REQUIRE(!dataStore.addItems({{".Hidden", "Value"}}));
+
+    // Verify the size of the stored data
+    REQUIRE(dataStore.getSize() == 300);
+
+    // Retrieve the data from the data-store as a single batch
+    auto values = dataStore.getItems({"Key1", "Key12", "Key49", "Missing"}, 4);
+    REQUIRE(values.size() == 4);
+    REQUIRE(values["Key1"] == "Value1");
+    REQUIRE(values["Key12"] == "Value2");
+    REQUIRE(values["Key49"] == "Value9");
+    REQUIRE(values["Missing"].empty());
+
+    // Delete some of the data using the multi-delete method
+    REQUIRE(dataStore.deleteItems({"Key1", "Key2", "Key2", "Key3"}));
+    REQUIRE(dataStore.getSize() == 282);
+    REQUIRE(dataStore.getItem("Key2").empty());
+
+    // Delete some of the data one-by-one
+    REQUIRE(dataStore.deleteItems({"Key4", "Key5"}, false));
+    REQUIRE(dataStore.getSize() == 270);
+    REQUIRE(dataStore.getItem("Key5").empty());
+    REQUIRE(dataStore.getItem("Key6") == "Value6");
+
+    // Cleanup s3-data-store instance
+    REQUIRE(dataStore.deleteEntireDataStore(true));
+}
+
+TEST_CASE ("Coalesced Metadata S3-Data-Store Test", "[S3DataStoreTest]")
+{
+
+    // Create a s3 data-store which only pushes metadata out explicitly
+    auto s3Credentials = getTestS3Credentials("S3DataStoreTest");
+    auto dataStore = S3DataStore(s3Credentials);
+    dataStore.setMetadataFlushPolicy(1000, 0);
+
+    // Cleanup s3-data-store instance
+    REQUIRE(dataStore.deleteEntireDataStore(true));
+
+    // Insert and replace some data in the data-store
+    REQUIRE(dataStore.addItem("Key1", "Value1"));
+    REQUIRE(dataStore.addItem("Key2", "Value2"));
+    REQUIRE(dataStore.addItem("Key2", "Value22"));
+    REQUIRE(dataStore.getSize() == 13);
+
+    // Validate that a second instance sees the pending metadata
+    // since the first instance's metadata is flushed for it
+    {
+        auto dataStore2 = S3DataStore(s3Credentials);
+        REQUIRE(dataStore2.getSize() == 13);
+    }
+
+    // Validate that sizes are tracked correctly from a listing
+    auto dataStore3 = S3DataStore(s3Credentials);
+    REQUIRE(dataStore3.loadObjectSizes());
+    REQUIRE(dataStore3.getObjectSize("Key2") == 7);
+    REQUIRE(dataStore3.getObjectSize("Missing") == 0);
+    REQUIRE(dataStore3.addItem("Key1", "Value"));
+    REQUIRE(dataStore3.getSize() == 12);
+    REQUIRE(dataStore3.flushMetaData());
+
+    // Validate that objects written by another instance after the listing
+    // are still looked-up rather than assumed to be missing
+    {
+        auto dataStore4 = S3DataStore(s3Credentials);
+        REQUIRE(dataStore4.addItem("Key3", "Value333"));
+    }
+    REQUIRE(dataStore3.getObjectSize("Key3") == 8);
+
+    // Cleanup s3-data-store instance
+    REQUIRE(dataStore3.deleteEntireDataStore(true));
+}
+
+TEST_CASE ("Background Reconciliation S3-Data-Store Test", "[S3DataStoreTest]")
+{
+
+    // Create a s3 data-store which reconciles written objects quickly
+    auto s3Credentials = getTestS3Credentials("S3DataStoreTest");
+    auto dataStore = S3DataStore(s3Credentials);
+    dataStore.setReconcilePolicy(4, 10, 100, 1000);
+
+    // Cleanup s3-data-store instance
+    REQUIRE(dataStore.deleteEntireDataStore(true));
+
+    // Insert some data in the data-store
+    REQUIRE(dataStore.addItem("Key1", "Value1"));
+    REQUIRE(dataStore.addItem("Key2", "Value2"));
+    REQUIRE(dataStore.addItem("Key3", "Value3"));
+    REQUIRE(dataStore.getUnreconciledCount() <= 3);
+
+    // Validate that the written objects are reconciled in the background
+    for (int ii = 0; (ii < 100) && (dataStore.getUnreconciledCount() > 0); ii++)
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    REQUIRE(dataStore.getUnreconciledCount() == 0);
+    REQUIRE(dataStore.getSize() == 18);
+
+    // Cleanup s3-data-store instance
+    REQUIRE(dataStore.deleteEntireDataStore(true));
+}
+
+TEST_CASE ("Multipart and Ranged Reads S3-Data-Store Test", "[S3DataStoreTest]")
+{
+
+    // Create a s3 data-store which uploads items in (minimum-sized) parts
+    auto s3Credentials = getTestS3Credentials("S3DataStoreTest");
+    auto dataStore = S3DataStore(s3Credentials);
+    dataStore.setMultipartPolicy(6 * 1024 * 1024, 5 * 1024 * 1024, 4);
+
+    // Cleanup s3-data-store instance
+    REQUIRE(dataStore.deleteEntireDataStore(true));
+
+    // Create a large item spanning multiple parts
+    std::string largeItem;
+    for (int ii = 0; ii < (12 * 1024 * 1024); ii++)
+        largeItem += (char) ('A' + (ii % 26));
+
+    // Insert a large (multipart) and small item into the data-store
+    REQUIRE(dataStore.addItem("LargeKey", largeItem));
+    REQUIRE(dataStore.addItem("SmallKey", "SmallValue"));
+    REQUIRE(dataStore.getItem("LargeKey") == largeItem);
+    REQUIRE(dataStore.getSize() == (long) (largeItem.size() + 10));
+
+    // Validate ranged reads (including reads past the end of the item)
+    REQUIRE(dataStore.getItemRange("SmallKey", 5, 5) == "Value");
+    REQUIRE(dataStore.getItemRange("SmallKey", 5, 100) == "Value");
+    REQUIRE(dataStore.getItemRange("SmallKey", 100, 5).empty());
+    REQUIRE(dataStore.getItemRange("LargeKey", (6 * 1024 * 1024) - 1, 3)
+            == largeItem.substr((6 * 1024 * 1024) - 1, 3));
+
+    // Validate ranged reads into a caller-provided buffer
+    char buffer[5];
+    REQUIRE(dataStore.getItemRange("SmallKey", 0, buffer, 5) == 5);
+    REQUIRE(std::string(buffer, 5) == "Small");
+    REQUIRE(dataStore.getItemRange("SmallKey", 100, buffer, 5) == 0);
+    REQUIRE(dataStore.getItemRange("MissingKey", 0, buffer, 5) == -1);
+
+    // Validate streaming reads into a sink
+    std::ostringstream largeSink;
+    REQUIRE(dataStore.getItem("LargeKey", largeSink));
+    REQUIRE(largeSink.str() == largeItem);
+    std::ostringstream smallSink;
+    REQUIRE(dataStore.getItem("SmallKey", smallSink));
+    REQUIRE(smallSink.str() == "SmallValue");
+
+    // Validate streaming reads of values around the size of the first read
+    for (long itemSize : {(64L * 1024) - 1, (64L * 1024), (64L * 1024) + 1})
+    {
+        auto boundaryItem = largeItem.substr(0, itemSize);
+        REQUIRE(dataStore.addItem("BoundaryKey", boundaryItem));
+        std::ostringstream boundarySink;
+        REQUIRE(dataStore.getItem("BoundaryKey", boundarySink));
+        REQUIRE(boundarySink.str() == boundaryItem);
+    }
+    REQUIRE(dataStore.deleteItem("BoundaryKey"));
+    std::ostringstream missingSink;
+    REQUIRE(!dataStore.getItem("MissingKey", missingSink));
+
+    // Validate that a streaming read fails (rather than mixing versions)
+    // if the value is replaced after its first part has been read
+    class ReplacingStreamBuffer : public std::stringbuf
+    {
+        public:
+            std::function<void()> onFirstWrite;
+        protected:
+            std::streamsize xsputn(const char* data, std::streamsize size) override
+            {
+                if (onFirstWrite)
+                {
+                    auto replaceFunction = std::move(onFirstWrite);
+                    onFirstWrite = nullptr;
+                    replaceFunction();
+                }
+                return std::stringbuf::xsputn(data, size);
+            }
+    };
+    ReplacingStreamBuffer replacingBuffer;
+    replacingBuffer.onFirstWrite = [&dataStore, &largeItem]()
+    {
+        REQUIRE(dataStore.addItem("LargeKey", std::string(largeItem.rbegin(), largeItem.rend())));
+    };
+    std::ostream replacingSink(&replacingBuffer);
+    REQUIRE(!dataStore.getItem("LargeKey", replacingSink));
+    REQUIRE(replacingBuffer.str().size() < largeItem.size());
+
+    // Cleanup s3-data-store instance
+    REQUIRE(dataStore.deleteEntireDataStore(true));
+}
+
+TEST_CASE ("Read-Through Object Cache S3-Data-Store Test", "[S3DataStoreTest]")
+{
+
+    // Create a s3 data-store with the object cache enabled
+    auto s3Credentials = getTestS3Credentials("S3DataStoreTest");
+    auto dataStore = S3DataStore(s3Credentials);
+    dataStore.enableObjectCache(1024);
+    auto objectCache = dataStore.getObjectCache();
+    REQUIRE(objectCache != nullptr);
+
+    // Cleanup s3-data-store instance
+    REQUIRE(dataStore.deleteEntireDataStore(true));
+
+    // Validate that the first read misses and later reads hit (after re-validation)
+    REQUIRE(dataStore.addItem("Key1", "Value1"));
+    REQUIRE(dataStore.getItem("Key1") == "Value1");
+    REQUIRE(objectCache->getMissCount() == 1);
+    REQUIRE(dataStore.getItem("Key1") == "Value1");
+    REQUIRE(dataStore.getItem("Key1") == "Value1");
+    REQUIRE(objectCache->getHitCount() == 2);
+
+    // Validate that writes and deletes invalidate the cached object
+    REQUIRE(dataStore.addItem("Key1", "NewValue1"));
+    REQUIRE(dataStore.getItem("Key1") == "NewValue1");
+    REQUIRE(objectCache->getMissCount() == 2);
+    REQUIRE(dataStore.deleteItem("Key1"));
+    REQUIRE(dataStore.getItem("Key1").empty());
+    REQUIRE(objectCache->getItemCount() == 0);
+
+    // Validate that changes made by another instance are seen
+    REQUIRE(dataStore.addItem("Key2", "Value2"));
+    REQUIRE(dataStore.getItem("Key2") == "Value2");
+    auto otherDataStore = S3DataStore(s3Credentials);
+    REQUIRE(otherDataStore.addItem("Key2", "OtherValue2"));
+    REQUIRE(dataStore.getItem("Key2") == "OtherValue2");
+
+    // Validate that the cache can be disabled
+    dataStore.enableObjectCache(0);
+    REQUIRE(dataStore.getObjectCache() == nullptr);
+    REQUIRE(dataStore.getItem("Key2") == "OtherValue2");
+
+    // Cleanup s3-data-store instance
+    REQUIRE(dataStore.deleteEntireDataStore(true));
+}
+
+TEST_CASE ("On-Disk Cache S3-Data-Store Test", "[S3DataStoreTest]")
+{
+
+    // Create a s3 data-store with only the on-disk cache enabled
+    auto s3Credentials = getTestS3Credentials("S3DataStoreTest");
+    auto cacheDir = (std::filesystem::temp_directory_path() / "BitQuark_S3DataStoreDiskCacheTest").string();
+    std::filesystem::remove_all(cacheDir);
+    {
+        auto dataStore = S3DataStore(s3Credentials);
+        dataStore.enableDiskCache(cacheDir, 1024 * 1024);
+
+        // Cleanup s3-data-store instance
+        REQUIRE(dataStore.deleteEntireDataStore(true));
+
+        // Validate that the object is cached on-disk after the first read
+        REQUIRE(dataStore.addItem("Key1", "Value1"));
+        REQUIRE(dataStore.getItem("Key1") == "Value1");
+        REQUIRE(dataStore.getDiskCache()->getMissCount() == 1);
+        REQUIRE(dataStore.getItem("Key1") == "Value1");
+        REQUIRE(dataStore.getDiskCache()->getHitCount() == 1);
+    }
+
+    // Validate that a restarted instance reads the object from disk
+    // (in front of its in-memory cache) and still sees later changes
+    auto dataStore = S3DataStore(s3Credentials);
+    dataStore.enableObjectCache(1024);
+    dataStore.enableDiskCache(cacheDir, 1024 * 1024);
+    REQUIRE(dataStore.getDiskCache()->getItemCount() == 1);
+    REQUIRE(dataStore.getItem("Key1") == "Value1");
+    REQUIRE(dataStore.getDiskCache()->getHitCount() == 1);
+    REQUIRE(dataStore.getObjectCache()->getItemCount() == 1);
+    REQUIRE(dataStore.addItem("Key1", "NewValue1"));
+    REQUIRE(dataStore.getItem("Key1") == "NewValue1");
+
+    // Cleanup s3-data-store instance
+    REQUIRE(dataStore.deleteEntireDataStore(true));
+    REQUIRE(dataStore.getDiskCache()->getItemCount() == 0);
+    std::filesystem::remove_all(cacheDir);
+}
+
+TEST_CASE ("Conditional Writes S3-Data-Store Test", "[S3DataStoreTest]")
+{
+
+    // Create a s3 data-store with the given setup
+    auto s3Credentials = getTestS3Credentials("S3DataStoreTest");
+    auto dataStore = S3DataStore(s3Credentials);
+
+    // Cleanup s3-data-store instance
+    REQUIRE(dataStore.deleteEntireDataStore(true));
+
+    // Validate that an item can only be put if it is absent
+    REQUIRE(dataStore.putIfAbsent("Key1", "Value1"));
+    REQUIRE(!dataStore.putIfAbsent("Key1", "OtherValue1"));
+    REQUIRE(dataStore.getItem("Key1") == "Value1");
+
+    // Validate that an item is only replaced if it has not changed since it was read
+    std::string eTag;
+    REQUIRE(dataStore.getItemWithETag("Key1", eTag) == "Value1");
+    REQUIRE(!eTag.empty());
+    REQUIRE(dataStore.compareAndSet("Key1", eTag, "NewValue1"));
+    REQUIRE(!dataStore.compareAndSet("Key1", eTag, "OtherValue1"));
+    REQUIRE(dataStore.getItem("Key1") == "NewValue1");
+
+    // Validate that missing items have no ETag (and cannot be compared)
+    REQUIRE(dataStore.getItemWithETag("Key2", eTag).empty());
+    REQUIRE(eTag.empty());
+    REQUIRE(!dataStore.compareAndSet("Key2", eTag, "Value2"));
+
+    // Validate that only one of many competing writers wins
+    REQUIRE(dataStore.getItemWithETag("Key1", eTag) == "NewValue1");
+    std::vector<std::future<bool>> casFutures;
+    for (int ii = 0; ii < 4; ii++)
+        casFutures.push_back(std::async(std::launch::async, [&dataStore, eTag, ii]() {
+            return dataStore.compareAndSet("Key1", eTag, "Writer" + std::to_string(ii)); }));
+    int successCount = 0;
+    for (auto& casFuture : casFutures)
+        successCount += (casFuture.get() ? 1 : 0);
+    REQUIRE(successCount == 1);
+    REQUIRE(dataStore.getSize() == 7);
+
+    // Cleanup s3-data-store instance
+    REQUIRE(dataStore.deleteEntireDataStore(true));
+}
+
+TEST_CASE ("Parallel Listing S3-Data-Store Test", "[S3DataStoreTest]")
+{
+
+    // Create a s3 data-store with the given setup
+    auto s3Credentials = getTestS3Credentials("S3DataStoreTest");
+    auto dataStore = S3DataStore(s3Credentials);
+
+    // Cleanup s3-data-store instance
+    REQUIRE(dataStore.deleteEntireDataStore(true));
+
+    // Insert items (spanning multiple pages) whose keys start with
+    // a variety of characters (including the key-range boundaries)
+    std::unordered_map<std::string, std::string> items;
+    std::string keyChars = "-0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ_abcdefghijklmnopqrstuvwxyz~";
+    for (int ii = 0; ii < 1500; ii++)
+        items[keyChars[ii % keyChars.size()] + std::to_string(ii)] = "Value";
+    for (auto keyChar : keyChars)
+        items[std::string(1, keyChar)] = "Value";
+    REQUIRE(dataStore.addItems(items));
+
+    // Validate that the sequential and parallel listings are identical and sorted
+    std::vector<std::string> sequentialKeys;
+    auto itemsGenerator = dataStore.listItems("", 1);
+    while (itemsGenerator->hasMoreItems())
+        sequentialKeys.push_back(itemsGenerator->getNextItem());
+    std::vector<std::string> parallelKeys;
+    itemsGenerator = dataStore.listItems("", 8);
+    while (itemsGenerator->hasMoreItems())
+        parallelKeys.push_back(itemsGenerator->getNextItem());
+    REQUIRE(sequentialKeys.size() == items.size());
+    REQUIRE(std::is_sorted(sequentialKeys.begin(), sequentialKeys.end()));
+    REQUIRE(parallelKeys == sequentialKeys);
+
+    // Validate that a parallel listing can be terminated early
+    itemsGenerator = dataStore.listItems("", 8);
+    for (int ii = 0; ii < 10; ii++)
+        REQUIRE(itemsGenerator->getNextItem() == sequentialKeys[ii]);
+    itemsGenerator->quitRemainingItems();
+
+    // Insert items (spanning multiple pages) with hashed (hex) keys as well
+    // as items grouped into "directories" under their own prefixes
+    std::unordered_map<std::string, std::string> prefixedItems;
+    for (unsigned long long ii = 0; ii < 1500; ii++)
+    {
+        std::stringstream hexKey;
+        hexKey << "Hashed/" << std::hex << ((ii + 1) * 0x9E3779B97F4A7C15ULL);
+        prefixedItems[hexKey.str()] = "Value";
+        prefixedItems["Grouped/Group" + std::to_string(ii % 50) + "/" + std::to_string(ii)] = "Value";
+    }
+    REQUIRE(dataStore.addItems(prefixedItems));
+
+    // Validate that the sequential and parallel listings are identical for both
+    for (const std::string listPrefix : {"Hashed/", "Grouped/"})
+    {
+        std::vector<std::string> sequentialPrefixedKeys;
+        itemsGenerator = dataStore.listItems(listPrefix, 1);
+        while (itemsGenerator->hasMoreItems())
+            sequentialPrefixedKeys.push_back(itemsGenerator->getNextItem());
+        std::vector<std::string> parallelPrefixedKeys;
+        itemsGenerator = dataStore.listItems(listPrefix, 4);
+        while (itemsGenerator->hasMoreItems())
+            parallelPrefixedKeys.push_back(itemsGenerator->getNextItem());
+        REQUIRE(sequentialPrefixedKeys.size() == 1500);
+        REQUIRE(std::is_sorted(sequentialPrefixedKeys.begin(), sequentialPrefixedKeys.end()));
+        REQUIRE(parallelPrefixedKeys == sequentialPrefixedKeys);
+    }
+
+    // Cleanup s3-data-store instance
+    REQUIRE(dataStore.deleteEntireDataStore(true));
+}
+
 #endif //BITQUARK_S3DATASTORE_TEST_HPP